@@ -1,6 +1,5 @@
 #pragma once
 #include <Arduino.h>
-#include <math.h>
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include "../../engine/GameBase.h"
 #include "../../engine/ControllerManager.h"
@@ -9,6 +8,9 @@
 #include "../../engine/Settings.h"
 #include "../../engine/UserProfiles.h"
 #include "../../component/GameOverLeaderboardView.h"
+#include "../../engine/Trig8.h"
+#include "../../engine/FixedPoint.h"
+#include "../../engine/VectorRaster.h"
 #include "AsteroidsGameConfig.h"
 
 /**
@@ -24,6 +26,11 @@
  * - We reserve a small HUD band at the top for score/lives.
  * - World wraps horizontally and vertically within the playfield area.
  * - Rendering uses simple vector primitives (pixels/lines/circles) for speed.
+ * - Physics is Q16.16 fixed point (engine/FixedPoint.h): bit-identical on every build,
+ *   so input-log replays reproduce exactly.
+ * - Angles are 256-step `Trig8::Angle`s (table sin/cos, no float trig at runtime); the
+ *   ship outline comes pre-rotated from AsteroidsGameSprites.h and is drawn with
+ *   wrap-aware lines, so it shows on both sides of the playfield seam.
  */
 class AsteroidsGame : public GameBase {
 private:
@@ -31,19 +38,23 @@ private:
     // Layout
     // ---------------------------------------------------------
     static constexpr int HUD_H = AsteroidsGameConfig::HUD_H;  // reserved for text HUD
+    // Ship lines wrap inside this area (HUD excluded).
+    static constexpr VectorRaster::WrapField PLAYFIELD = { 0, (int16_t)HUD_H, (int16_t)PANEL_RES_X, (int16_t)PANEL_RES_Y };
 
     // ---------------------------------------------------------
     // Tuning
     // ---------------------------------------------------------
     static constexpr uint32_t UPDATE_INTERVAL_MS = AsteroidsGameConfig::UPDATE_INTERVAL_MS;  // ~60Hz logic
-    static constexpr float MAX_SPEED = AsteroidsGameConfig::MAX_SPEED;
-    static constexpr float MOVE_SMOOTH = AsteroidsGameConfig::MOVE_SMOOTH;   // 0..1 (higher = snappier)
-    static constexpr float STICK_DEADZONE = AsteroidsGameConfig::STICK_DEADZONE; // 0..1
+    typedef Fixed::q16 q16;
+    static constexpr q16 ONE = Fixed::ONE;
+    static constexpr q16 MAX_SPEED = AsteroidsGameConfig::MAX_SPEED;
+    static constexpr q16 MOVE_SMOOTH = AsteroidsGameConfig::MOVE_SMOOTH;   // 0..1 (higher = snappier)
+    static constexpr q16 STICK_DEADZONE = AsteroidsGameConfig::STICK_DEADZONE; // 0..1
 
     static constexpr uint32_t SHOT_COOLDOWN_MS = AsteroidsGameConfig::SHOT_COOLDOWN_MS;
     static constexpr uint32_t BULLET_LIFE_MS = AsteroidsGameConfig::BULLET_LIFE_MS;
     static constexpr int MAX_BULLETS = AsteroidsGameConfig::MAX_BULLETS;
-    static constexpr float BULLET_SPEED = AsteroidsGameConfig::BULLET_SPEED;
+    static constexpr q16 BULLET_SPEED = AsteroidsGameConfig::BULLET_SPEED;
 
     static constexpr uint32_t RESPAWN_INVULN_MS = AsteroidsGameConfig::RESPAWN_INVULN_MS;
     static constexpr uint32_t HYPERSPACE_COOLDOWN_MS = AsteroidsGameConfig::HYPERSPACE_COOLDOWN_MS;
@@ -55,30 +66,37 @@ private:
     // ---------------------------------------------------------
     // Entities
     // ---------------------------------------------------------
+    // Playfield in fixed point: x wraps over [0, PANEL_RES_X), y over [HUD_H, PANEL_RES_Y - 1].
+    static constexpr q16 FIELD_W = Fixed::fromInt(PANEL_RES_X);
+    static constexpr q16 FIELD_TOP = Fixed::fromInt(HUD_H);
+    static constexpr q16 FIELD_BOTTOM = Fixed::fromInt(PANEL_RES_Y - 1);
+    static constexpr q16 CENTER_X = FIELD_W / 2;
+    static constexpr q16 CENTER_Y = (FIELD_TOP + FIELD_BOTTOM) / 2;
+
     struct Ship {
-        float x = PANEL_RES_X / 2.0f;
-        float y = (HUD_H + (PANEL_RES_Y - 1)) / 2.0f;
-        float vx = 0.0f;
-        float vy = 0.0f;
-        float ang = -1.5708f; // facing up (approx -pi/2)
+        q16 x = CENTER_X;
+        q16 y = CENTER_Y;
+        q16 vx = 0;
+        q16 vy = 0;
+        Trig8::Angle ang = Trig8::UP;
         uint16_t color = COLOR_GREEN;
     };
 
     struct Bullet {
-        float x;
-        float y;
-        float vx;
-        float vy;
+        q16 x;
+        q16 y;
+        q16 vx;
+        q16 vy;
         uint32_t bornMs;
         bool active;
         uint16_t color;
     };
 
     struct Asteroid {
-        float x;
-        float y;
-        float vx;
-        float vy;
+        q16 x;
+        q16 y;
+        q16 vx;
+        q16 vy;
         uint8_t size;   // 2=large, 1=medium, 0=small
         uint8_t radius; // pixels
         bool alive;
@@ -97,7 +115,6 @@ private:
     int lives = 3;
     int level = 1;
 
-    uint32_t lastTickMs = 0;
     uint32_t lastShotMs = 0;
     uint32_t respawnAtMs = 0;
     uint32_t invulnUntilMs = 0;
@@ -143,52 +160,47 @@ private:
         static bool r2(T*, ...) { return false; }
     };
 
-    static inline float clampf(float v, float lo, float hi) { return (v < lo) ? lo : (v > hi) ? hi : v; }
-    static inline float randf(float lo, float hi) {
-        const float t = (float)random(0, 10000) / 10000.0f;
-        return lo + (hi - lo) * t;
+    static inline q16 randq(q16 lo, q16 hi) {
+        const q16 t = Fixed::ratio(random(0, 10000), 10000);
+        return lo + Fixed::mul(hi - lo, t);
     }
 
-    static inline float deadzone01(float v, float dz) {
-        const float a = fabsf(v);
-        if (a <= dz) return 0.0f;
+    static inline q16 deadzone01(q16 v, q16 dz) {
+        const q16 a = Fixed::absVal(v);
+        if (a <= dz) return 0;
         // Re-scale so output is continuous from 0..1 outside deadzone.
-        const float s = (a - dz) / (1.0f - dz);
+        const q16 s = Fixed::div(a - dz, ONE - dz);
         return (v < 0) ? -s : s;
     }
 
-    static inline void normalizeStick(int16_t rawX, int16_t rawY, float& outX, float& outY) {
+    static inline void normalizeStick(int16_t rawX, int16_t rawY, q16& outX, q16& outY) {
         // Normalize to [-1..1] with a conservative divisor and clamp.
-        const float x = clampf((float)rawX / (float)AXIS_DIVISOR, -1.0f, 1.0f);
-        const float y = clampf((float)rawY / (float)AXIS_DIVISOR, -1.0f, 1.0f);
+        const q16 x = Fixed::clamp(Fixed::ratio(rawX, AXIS_DIVISOR), -ONE, ONE);
+        const q16 y = Fixed::clamp(Fixed::ratio(rawY, AXIS_DIVISOR), -ONE, ONE);
         outX = deadzone01(x, STICK_DEADZONE);
         outY = deadzone01(y, STICK_DEADZONE);
     }
 
-    static inline float dist2(float ax, float ay, float bx, float by) {
-        const float dx = ax - bx;
-        const float dy = ay - by;
-        return dx * dx + dy * dy;
+    static inline q16 dist2(q16 ax, q16 ay, q16 bx, q16 by) {
+        return Fixed::lengthSq(Fixed::Vec2{ ax - bx, ay - by });
     }
 
-    static inline void wrapX(float& x) {
-        if (x < 0) x += PANEL_RES_X;
-        else if (x >= PANEL_RES_X) x -= PANEL_RES_X;
+    static inline void wrapX(q16& x) {
+        if (x < 0) x += FIELD_W;
+        else if (x >= FIELD_W) x -= FIELD_W;
     }
 
-    static inline void wrapY(float& y) {
-        const float top = (float)HUD_H;
-        const float bottom = (float)(PANEL_RES_Y - 1);
-        if (y < top) y = bottom - (top - y);
-        else if (y > bottom) y = top + (y - bottom);
+    static inline void wrapY(q16& y) {
+        if (y < FIELD_TOP) y = FIELD_BOTTOM - (FIELD_TOP - y);
+        else if (y > FIELD_BOTTOM) y = FIELD_TOP + (y - FIELD_BOTTOM);
     }
 
     void resetShipToCenter(uint32_t now) {
-        ship.x = PANEL_RES_X / 2.0f;
-        ship.y = (HUD_H + (PANEL_RES_Y - 1)) / 2.0f;
-        ship.vx = 0.0f;
-        ship.vy = 0.0f;
-        ship.ang = -1.5708f;
+        ship.x = CENTER_X;
+        ship.y = CENTER_Y;
+        ship.vx = 0;
+        ship.vy = 0;
+        ship.ang = Trig8::UP;
         invulnUntilMs = now + RESPAWN_INVULN_MS;
     }
 
@@ -202,23 +214,23 @@ private:
         // - Add one extra large asteroid every 2 levels, capped to keep gameplay readable on 64x64.
         // - Increase drift speed slowly to avoid "instant chaos".
         const int count = (int)min(5, 1 + ((level - 1) / 2));
-        const float baseSpeed = min(0.80f, 0.22f + (level * 0.03f));
+        const q16 baseSpeed = min(Fixed::fromFloat(0.80f), Fixed::fromFloat(0.22f) + level * Fixed::fromFloat(0.03f));
 
         for (int i = 0; i < count; i++) {
             // Spawn away from the ship to reduce immediate unavoidable collisions.
-            float ax = randf(0.0f, (float)(PANEL_RES_X - 1));
-            float ay = randf((float)HUD_H, (float)(PANEL_RES_Y - 1));
+            q16 ax = randq(0, Fixed::fromInt(PANEL_RES_X - 1));
+            q16 ay = randq(FIELD_TOP, FIELD_BOTTOM);
 
             // Ensure some distance from ship center.
-            if (dist2(ax, ay, ship.x, ship.y) < 18.0f * 18.0f) {
-                ax = fmodf(ax + 24.0f, (float)PANEL_RES_X);
-                ay = clampf(ay + 14.0f, (float)HUD_H, (float)(PANEL_RES_Y - 1));
+            if (dist2(ax, ay, ship.x, ship.y) < Fixed::fromInt(18 * 18)) {
+                ax = (ax + Fixed::fromInt(24)) % FIELD_W;
+                ay = Fixed::clamp(ay + Fixed::fromInt(14), FIELD_TOP, FIELD_BOTTOM);
             }
 
-            const float ang = randf(0.0f, 6.28318f);
-            const float sp = baseSpeed * randf(0.85f, 1.15f);
-            const float vx = cosf(ang) * sp;
-            const float vy = sinf(ang) * sp;
+            const Trig8::Angle ang = (Trig8::Angle)random(0, 256);
+            const q16 sp = Fixed::mul(baseSpeed, randq(Fixed::fromFloat(0.85f), Fixed::fromFloat(1.15f)));
+            const q16 vx = Fixed::mul(Fixed::cos(ang), sp);
+            const q16 vy = Fixed::mul(Fixed::sin(ang), sp);
             // Allocate an asteroid slot.
             for (int ai = 0; ai < MAX_ASTEROIDS; ai++) {
                 if (asteroids[ai].alive) continue;
@@ -251,11 +263,12 @@ private:
         // Spawn 2 children with slight random velocity variation.
         const uint8_t childSize = (uint8_t)(a.size - 1);
         for (int i = 0; i < 2; i++) {
-            const float ang = randf(0.0f, 6.28318f);
+            const Trig8::Angle ang = (Trig8::Angle)random(0, 256);
             // Keep splits "fair": children are a bit faster than parent, but not wildly so.
-            const float sp = randf(0.35f, 0.65f);
-            const float nvx = a.vx * 0.65f + cosf(ang) * sp;
-            const float nvy = a.vy * 0.65f + sinf(ang) * sp;
+            const q16 sp = randq(Fixed::fromFloat(0.35f), Fixed::fromFloat(0.65f));
+            const q16 keep = Fixed::fromFloat(0.65f);
+            const q16 nvx = Fixed::mul(a.vx, keep) + Fixed::mul(Fixed::cos(ang), sp);
+            const q16 nvy = Fixed::mul(a.vy, keep) + Fixed::mul(Fixed::sin(ang), sp);
             for (int ai = 0; ai < MAX_ASTEROIDS; ai++) {
                 if (asteroids[ai].alive) continue;
                 Asteroid& c = asteroids[ai];
@@ -282,10 +295,10 @@ private:
         lastHyperMs = now;
 
         // Teleport to a random spot; reset velocity for fairness.
-        ship.x = randf(0.0f, (float)(PANEL_RES_X - 1));
-        ship.y = randf((float)HUD_H, (float)(PANEL_RES_Y - 1));
-        ship.vx = 0.0f;
-        ship.vy = 0.0f;
+        ship.x = randq(0, Fixed::fromInt(PANEL_RES_X - 1));
+        ship.y = randq(FIELD_TOP, FIELD_BOTTOM);
+        ship.vx = 0;
+        ship.vy = 0;
 
         // Give brief invulnerability to prevent instant death on spawn overlap.
         invulnUntilMs = now + 350;
@@ -299,18 +312,15 @@ private:
         }
         if (slot < 0) return;
 
-        const float fx = cosf(ship.ang);
-        const float fy = sinf(ship.ang);
+        const q16 fx = Fixed::cos(ship.ang);
+        const q16 fy = Fixed::sin(ship.ang);
 
         // Spawn bullet slightly in front of the ship with inherited velocity.
-        const float bx = ship.x + fx * 4.0f;
-        const float by = ship.y + fy * 4.0f;
-        const float bv = BULLET_SPEED;
         Bullet& b = bullets[slot];
-        b.x = bx;
-        b.y = by;
-        b.vx = ship.vx + fx * bv;
-        b.vy = ship.vy + fy * bv;
+        b.x = ship.x + fx * 4;
+        b.y = ship.y + fy * 4;
+        b.vx = ship.vx + Fixed::mul(fx, BULLET_SPEED);
+        b.vy = ship.vy + Fixed::mul(fy, BULLET_SPEED);
         b.bornMs = now;
         b.active = true;
         b.color = COLOR_CYAN;
@@ -330,7 +340,6 @@ public:
         ship.color = globalSettings.getPlayerColor();
 
         const uint32_t now = millis();
-        lastTickMs = now;
         lastShotMs = 0;
         lastHyperMs = 0;
         respawnAtMs = 0;
@@ -344,12 +353,11 @@ public:
         start();
     }
 
-    void update(ControllerManager* input) override {
-        if (gameOver) return;
+    uint16_t fixedStepMs() const override { return (uint16_t)UPDATE_INTERVAL_MS; }
 
-        const uint32_t now = millis();
-        if ((uint32_t)(now - lastTickMs) < UPDATE_INTERVAL_MS) return;
-        lastTickMs = now;
+    void step(ControllerManager* input, uint32_t now, uint16_t dtMs) override {
+        (void)dtMs;
+        if (gameOver) return;
 
         // Handle delayed respawn.
         // Use signed delta so this remains safe across millis() wraparound.
@@ -362,18 +370,18 @@ public:
         ControllerPtr p1 = input->getController(0);
         if (p1 && p1->isConnected()) {
             // Left stick: movement (twin-stick).
-            float lx = 0.0f, ly = 0.0f;
+            q16 lx = 0, ly = 0;
             normalizeStick(InputDetail::axisX(p1, 0), InputDetail::axisY(p1, 0), lx, ly);
 
             // Right stick: aim direction (twin-stick).
-            float rx = 0.0f, ry = 0.0f;
+            q16 rx = 0, ry = 0;
             normalizeStick(InputDetail::axisRX(p1, 0), InputDetail::axisRY(p1, 0), rx, ry);
 
             // If the right stick is moved, update ship angle.
-            const float aimMag2 = rx * rx + ry * ry;
-            if (aimMag2 > 0.001f) {
-                // Screen coordinates: +Y is down; atan2() matches our sin/cos usage.
-                ship.ang = atan2f(ry, rx);
+            const q16 aimMag2 = Fixed::lengthSq(Fixed::Vec2{ rx, ry });
+            if (aimMag2 > Fixed::fromFloat(0.001f)) {
+                // Screen coordinates: +Y is down; Trig8 angles use the same convention.
+                ship.ang = Fixed::atan2(ry, rx);
             }
 
             // Hyperspace on A (keeps B reserved for "back to menu" by the engine).
@@ -390,10 +398,10 @@ public:
 
             // Apply movement as a smoothed target velocity so it feels responsive
             // but not twitchy (and remains fair on a low-res panel).
-            const float targetVx = lx * MAX_SPEED;
-            const float targetVy = ly * MAX_SPEED;
-            ship.vx = ship.vx * (1.0f - MOVE_SMOOTH) + targetVx * MOVE_SMOOTH;
-            ship.vy = ship.vy * (1.0f - MOVE_SMOOTH) + targetVy * MOVE_SMOOTH;
+            const q16 targetVx = Fixed::mul(lx, MAX_SPEED);
+            const q16 targetVy = Fixed::mul(ly, MAX_SPEED);
+            ship.vx = Fixed::lerp(ship.vx, targetVx, MOVE_SMOOTH);
+            ship.vy = Fixed::lerp(ship.vy, targetVy, MOVE_SMOOTH);
         }
 
         // 2) Integrate ship
@@ -430,8 +438,8 @@ public:
             for (int ai = 0; ai < MAX_ASTEROIDS; ai++) {
                 Asteroid& a = asteroids[ai];
                 if (!a.alive) continue;
-                const float r = (float)a.radius;
-                if (dist2(b.x, b.y, a.x, a.y) <= (r * r)) {
+                const q16 r2 = Fixed::fromInt((int32_t)a.radius * a.radius);
+                if (dist2(b.x, b.y, a.x, a.y) <= r2) {
                     splitAsteroid(ai, now);
                     b.active = false;
                     break;
@@ -444,9 +452,9 @@ public:
             for (int ai = 0; ai < MAX_ASTEROIDS; ai++) {
                 const Asteroid& a = asteroids[ai];
                 if (!a.alive) continue;
-                const float r = (float)a.radius;
+                const q16 r = Fixed::fromInt(a.radius) + Fixed::fromFloat(2.5f);
                 // Ship approximated as a small circle.
-                if (dist2(ship.x, ship.y, a.x, a.y) <= (r + 2.5f) * (r + 2.5f)) {
+                if (dist2(ship.x, ship.y, a.x, a.y) <= Fixed::mul(r, r)) {
                     lives--;
                     for (int bi = 0; bi < MAX_BULLETS; bi++) bullets[bi].active = false;
 
@@ -456,7 +464,7 @@ public:
                         // Short delay before respawn so impact is visible.
                         respawnAtMs = now + 350;
                         invulnUntilMs = now + RESPAWN_INVULN_MS;
-                        ship.vx = ship.vy = 0.0f;
+                        ship.vx = ship.vy = 0;
                     }
                     break;
                 }
@@ -475,8 +483,8 @@ public:
         display->fillScreen(COLOR_BLACK);
 
         // HUD
-        SmallFont::drawStringF(display, 2, 6, COLOR_YELLOW, "S:%d", score);
-        SmallFont::drawStringF(display, 34, 6, COLOR_CYAN, "L:%d", lives);
+        SmallFont::drawValue(display, 2, 6, COLOR_YELLOW, "S:", score);
+        SmallFont::drawValue(display, 34, 6, COLOR_CYAN, "L:", lives);
 
         // Divider line under HUD
         for (int x = 0; x < PANEL_RES_X; x += 2) display->drawPixel(x, HUD_H, COLOR_BLUE);
@@ -492,14 +500,14 @@ public:
         for (int ai = 0; ai < MAX_ASTEROIDS; ai++) {
             const Asteroid& a = asteroids[ai];
             if (!a.alive) continue;
-            display->drawCircle((int)a.x, (int)a.y, (int)a.radius, a.color);
+            display->drawCircle(Fixed::toInt(a.x), Fixed::toInt(a.y), (int)a.radius, a.color);
         }
 
         // Bullets
         for (int bi = 0; bi < MAX_BULLETS; bi++) {
             const Bullet& b = bullets[bi];
             if (!b.active) continue;
-            display->drawPixel((int)b.x, (int)b.y, b.color);
+            display->drawPixel(Fixed::toInt(b.x), Fixed::toInt(b.y), b.color);
         }
 
         // Ship (blinks while invulnerable)
@@ -507,24 +515,17 @@ public:
         const bool invuln = ((int32_t)(invulnUntilMs - now) > 0);
         const bool showShip = !invuln || ((now / 120) % 2 == 0);
         if (showShip) {
-            const float fx = cosf(ship.ang);
-            const float fy = sinf(ship.ang);
-            const float lx = cosf(ship.ang + 2.55f);
-            const float ly = sinf(ship.ang + 2.55f);
-            const float rx = cosf(ship.ang - 2.55f);
-            const float ry = sinf(ship.ang - 2.55f);
-
-            const int x0 = (int)(ship.x + fx * 4.0f);
-            const int y0 = (int)(ship.y + fy * 4.0f);
-            const int x1 = (int)(ship.x + lx * 3.0f);
-            const int y1 = (int)(ship.y + ly * 3.0f);
-            const int x2 = (int)(ship.x + rx * 3.0f);
-            const int y2 = (int)(ship.y + ry * 3.0f);
-
-            display->drawLine(x0, y0, x1, y1, ship.color);
-            display->drawLine(x1, y1, x2, y2, ship.color);
-            display->drawLine(x2, y2, x0, y0, ship.color);
-            display->drawPixel((int)ship.x, (int)ship.y, COLOR_WHITE);
+            // Pre-rotated outline (1/256 px offsets) + ship center in the same units.
+            const int32_t sx = ship.x >> 8;
+            const int32_t sy = ship.y >> 8;
+            int xs[AsteroidsGameConfig::SHIP_VERTS];
+            int ys[AsteroidsGameConfig::SHIP_VERTS];
+            for (uint8_t v = 0; v < AsteroidsGameConfig::SHIP_VERTS; v++) {
+                xs[v] = (int)((sx + AsteroidsGameConfig::SHIP_OUTLINE.dx[ship.ang][v]) >> 8);
+                ys[v] = (int)((sy + AsteroidsGameConfig::SHIP_OUTLINE.dy[ship.ang][v]) >> 8);
+            }
+            VectorRaster::drawPolygon(display, xs, ys, AsteroidsGameConfig::SHIP_VERTS, ship.color, PLAYFIELD);
+            display->drawPixel(Fixed::toInt(ship.x), Fixed::toInt(ship.y), COLOR_WHITE);
         }
     }
 
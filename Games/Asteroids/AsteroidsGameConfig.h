@@ -9,6 +9,8 @@
 #pragma once
 
 #include <Arduino.h>
+#include "../../engine/Trig8.h"
+#include "../../engine/FixedPoint.h"
 
 namespace AsteroidsGameConfig {
 
@@ -18,10 +20,10 @@ static constexpr int HUD_H = 8;
 // Tick
 static constexpr uint32_t UPDATE_INTERVAL_MS = 16; // ~60Hz logic
 
-// Movement / input
-static constexpr float MAX_SPEED = 2.6f;
-static constexpr float MOVE_SMOOTH = 0.18f;    // 0..1 (higher = snappier)
-static constexpr float STICK_DEADZONE = 0.18f; // 0..1
+// Movement / input (Q16.16 fixed point, see engine/FixedPoint.h)
+static constexpr Fixed::q16 MAX_SPEED = Fixed::fromFloat(2.6f);
+static constexpr Fixed::q16 MOVE_SMOOTH = Fixed::fromFloat(0.18f);    // 0..1 (higher = snappier)
+static constexpr Fixed::q16 STICK_DEADZONE = Fixed::fromFloat(0.18f); // 0..1
 static constexpr int16_t AXIS_DIVISOR = 512;   // Bluepad32 commonly uses ~[-512..512]
 static constexpr uint16_t TRIGGER_THRESHOLD = 360; // analog trigger threshold (0..1023-ish)
 
@@ -29,7 +31,13 @@ static constexpr uint16_t TRIGGER_THRESHOLD = 360; // analog trigger threshold (
 static constexpr uint32_t SHOT_COOLDOWN_MS = 180;
 static constexpr uint32_t BULLET_LIFE_MS = 700;
 static constexpr uint8_t MAX_BULLETS = 6;
-static constexpr float BULLET_SPEED = 3.2f;
+static constexpr Fixed::q16 BULLET_SPEED = Fixed::fromFloat(3.2f);
+
+// Ship outline (vector triangle): nose at SHIP_NOSE_R px, wing tips at SHIP_WING_R px,
+// SHIP_WING_ANGLE (256 steps per turn; 104 ~= 146 deg) either side of the nose.
+static constexpr int16_t SHIP_NOSE_R = 4;
+static constexpr int16_t SHIP_WING_R = 3;
+static constexpr Trig8::Angle SHIP_WING_ANGLE = 104;
 
 // Respawn / hyperspace
 static constexpr uint32_t RESPAWN_INVULN_MS = 1500;
@@ -10,4 +10,34 @@
 
 // No bitmap sprites required right now.
 
+// -----------------------------------------------------------------------------
+// Ship outline, pre-rotated for every angle (constexpr, flash)
+// -----------------------------------------------------------------------------
+// Vertex offsets from the ship center in 1/256 px: [angle][vertex], vertex 0 = nose,
+// 1 = left wing, 2 = right wing. Drawing is a lookup + add per vertex, no trig.
+static constexpr uint8_t SHIP_VERTS = 3;
+
+struct ShipOutline {
+    int16_t dx[256][SHIP_VERTS];
+    int16_t dy[256][SHIP_VERTS];
+};
+
+constexpr ShipOutline buildShipOutline() {
+    ShipOutline o{};
+    for (int a = 0; a < 256; a++) {
+        const Trig8::Angle nose = (Trig8::Angle)a;
+        const Trig8::Angle left = (Trig8::Angle)(a + SHIP_WING_ANGLE);
+        const Trig8::Angle right = (Trig8::Angle)(a - SHIP_WING_ANGLE);
+        o.dx[a][0] = (int16_t)Trig8::cosMul(nose, SHIP_NOSE_R);
+        o.dy[a][0] = (int16_t)Trig8::sinMul(nose, SHIP_NOSE_R);
+        o.dx[a][1] = (int16_t)Trig8::cosMul(left, SHIP_WING_R);
+        o.dy[a][1] = (int16_t)Trig8::sinMul(left, SHIP_WING_R);
+        o.dx[a][2] = (int16_t)Trig8::cosMul(right, SHIP_WING_R);
+        o.dy[a][2] = (int16_t)Trig8::sinMul(right, SHIP_WING_R);
+    }
+    return o;
+}
+
+static inline constexpr ShipOutline SHIP_OUTLINE = buildShipOutline();
+
 
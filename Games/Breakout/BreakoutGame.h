@@ -5,6 +5,9 @@
 #include "../../engine/ControllerManager.h"
 #include "../../engine/config.h"
 #include "../../engine/AudioManager.h"
+#include "../../engine/FixedPoint.h"
+#include "../../engine/ParticleSystem.h"
+#include "../../engine/Pool.h"
 #include "../../component/SmallFont.h"
 #include "../../engine/Settings.h"
 #include "../../engine/UserProfiles.h"
@@ -27,6 +30,8 @@
  *   - **Purple**: explode 5 random bricks (animated)
  *   - **Cyan**: duplicate a random active ball
  * - **FX**: small particle bursts when bricks break / explode.
+ *
+ * Ball, paddle and powerup motion is Q16.16 fixed point (engine/FixedPoint.h).
  */
 class BreakoutGame : public GameBase {
 private:
@@ -40,11 +45,13 @@ private:
         static int16_t axisX(T*, ...) { return 0; }
     };
 
-    static inline float clampf(float v, float lo, float hi) { return (v < lo) ? lo : (v > hi) ? hi : v; }
-    static inline float deadzone01(float v, float dz) {
-        const float a = fabsf(v);
-        if (a <= dz) return 0.0f;
-        const float s = (a - dz) / (1.0f - dz);
+    typedef Fixed::q16 q16;
+    static constexpr q16 ONE = Fixed::ONE;
+
+    static inline q16 deadzone01(q16 v, q16 dz) {
+        const q16 a = Fixed::absVal(v);
+        if (a <= dz) return 0;
+        const q16 s = Fixed::div(a - dz, ONE - dz);
         return (v < 0) ? -s : s;
     }
 
@@ -73,7 +80,7 @@ private:
     // ---------------------------------------------------------
     // Tuning (BreakoutGameConfig.h)
     // ---------------------------------------------------------
-    static constexpr float STICK_DEADZONE = BreakoutGameConfig::STICK_DEADZONE;
+    static constexpr q16 STICK_DEADZONE = BreakoutGameConfig::STICK_DEADZONE;
     static constexpr int16_t AXIS_DIVISOR = BreakoutGameConfig::AXIS_DIVISOR;
     static constexpr uint16_t UPDATE_INTERVAL_MS = BreakoutGameConfig::UPDATE_INTERVAL_MS;
 
@@ -89,15 +96,15 @@ private:
     static constexpr int BRICK_SPACING = BreakoutGameConfig::BRICK_SPACING;
 
     static constexpr int BALL_SIZE_PX = BreakoutGameConfig::BALL_SIZE_PX;
-    static inline float ballHalf() { return BreakoutGameConfig::BALL_HALF; }
-    static constexpr float BALL_SPEED = BreakoutGameConfig::BALL_SPEED;
-    static constexpr float BALL_SHOT_MULT = BreakoutGameConfig::BALL_SHOT_MULT;
-    static constexpr float BALL_MAX_SPEED = BreakoutGameConfig::BALL_MAX_SPEED;
+    static inline q16 ballHalf() { return BreakoutGameConfig::BALL_HALF; }
+    static constexpr q16 BALL_SPEED = BreakoutGameConfig::BALL_SPEED;
+    static constexpr q16 BALL_SHOT_MULT = BreakoutGameConfig::BALL_SHOT_MULT;
+    static constexpr q16 BALL_MAX_SPEED = BreakoutGameConfig::BALL_MAX_SPEED;
 
     static constexpr int MAX_BALLS = BreakoutGameConfig::MAX_BALLS;
     static constexpr int MAX_BRICKS = BreakoutGameConfig::MAX_BRICKS;
     static constexpr int MAX_POWERUPS = BreakoutGameConfig::MAX_POWERUPS;
-    static constexpr int MAX_PARTICLES = BreakoutGameConfig::MAX_PARTICLES;
+    static constexpr uint16_t MAX_PARTICLES = BreakoutGameConfig::MAX_PARTICLES;
 
     // Powerups (color-coded)
     enum PowerUpType : uint8_t { PU_RED = 0, PU_BLUE = 1, PU_GREEN = 2, PU_PURPLE = 3, PU_CYAN = 4 };
@@ -110,10 +117,10 @@ private:
 
     struct Player {
         bool enabled = false;
-        float x = 0.0f;
+        q16 x = 0;
         int y = 0;
         int width = 10;      // default shorter; upgraded by red powerup
-        float speed = 2.4f;
+        q16 speed = Fixed::fromFloat(2.4f);
         uint16_t color = COLOR_CYAN;
         int lives = 3;
         uint8_t paddleTier = 0;       // red powerup tier 0..5
@@ -124,15 +131,14 @@ private:
         bool attached = false;  // follows paddle until launched
         bool shotStyle = false; // green powerup style
         uint8_t owner = 0;      // last paddle touched
-        float x = 0.0f;
-        float y = 0.0f;
-        float vx = 0.0f;
-        float vy = 0.0f;
+        q16 x = 0;
+        q16 y = 0;
+        q16 vx = 0;
+        q16 vy = 0;
         uint16_t color = COLOR_WHITE;
     };
 
     struct Brick {
-        bool active = false;
         int x = 0;
         float y = 0.0f;
         uint8_t hp = 1;
@@ -144,29 +150,29 @@ private:
 
     struct PowerUp {
         bool active = false;
-        float x = 0.0f;
-        float y = 0.0f;
-        float vx = 0.0f;
-        float vy = 0.0f;
+        q16 x = 0;
+        q16 y = 0;
+        q16 vx = 0;
+        q16 vy = 0;
         uint8_t type = 0;
         uint8_t tier = 0; // reserved for future tiers
     };
 
-    struct Particle {
-        bool active = false;
-        float x = 0.0f;
-        float y = 0.0f;
-        float vx = 0.0f;
-        float vy = 0.0f;
-        uint16_t color = COLOR_WHITE;
-        uint32_t endMs = 0;
-    };
+    typedef ParticleSystem<MAX_PARTICLES> Particles;
+
+    static Particles::Params particleParams() {
+        Particles::Params p;
+        p.drag = Fixed::fromFloat(0.97f);
+        p.gravity = Fixed::fromFloat(0.015f);
+        p.clipY0 = HUD_H; // keep sparks out of the HUD
+        return p;
+    }
 
     Player players[MAX_GAMEPADS] = {};
     Ball balls[MAX_BALLS] = {};
-    Brick bricks[MAX_BRICKS] = {};
+    Pool<Brick, MAX_BRICKS> bricks; // live bricks are dense: loops visit bricks.size(), not MAX_BRICKS
     PowerUp powerups[MAX_POWERUPS] = {};
-    Particle particles[MAX_PARTICLES] = {};
+    Particles particles{ particleParams() };
 
     bool gameOver = false;
     int score = 0;
@@ -185,7 +191,6 @@ private:
     // This lock prevents repeated triggering while the field is empty.
     bool allClearLock = false;
 
-    uint32_t lastUpdateMs = 0;
     uint32_t lastScrollMs = 0;
     uint32_t lastRowSpawnMs = 0;
 
@@ -234,10 +239,10 @@ private:
         return bricksStartX() + col * (BRICK_WIDTH + BRICK_SPACING);
     }
 
-    static inline bool checkRectCollision(float bx, float by, int rx, int ry, int rw, int rh) {
-        const float h = ballHalf();
-        return (bx + h >= (float)rx && bx - h <= (float)(rx + rw) &&
-                by + h >= (float)ry && by - h <= (float)(ry + rh));
+    static inline bool checkRectCollision(q16 bx, q16 by, int rx, int ry, int rw, int rh) {
+        const q16 h = ballHalf();
+        return (bx + h >= Fixed::fromInt(rx) && bx - h <= Fixed::fromInt(rx + rw) &&
+                by + h >= Fixed::fromInt(ry) && by - h <= Fixed::fromInt(ry + rh));
     }
 
     // ---------------------------------------------------------
@@ -268,13 +273,13 @@ private:
         return (uint16_t)min<uint32_t>(60000u, ms);
     }
 
-    float baseBallSpeed() const {
+    q16 baseBallSpeed() const {
         // IMPORTANT: Do not scale ball speed with level.
         // Level increases should affect brick difficulty / stream pacing only.
         return BALL_SPEED;
     }
 
-    float maxBallSpeed() const {
+    q16 maxBallSpeed() const {
         // Safety clamp: prevents the ball from feeling "too fast" after collisions.
         return BALL_MAX_SPEED;
     }
@@ -295,9 +300,10 @@ private:
     // ---------------------------------------------------------
     void clearPools() {
         for (int i = 0; i < MAX_BALLS; i++) balls[i].active = false;
-        for (int i = 0; i < MAX_BRICKS; i++) bricks[i].active = false;
+        bricks.clear();
         for (int i = 0; i < MAX_POWERUPS; i++) powerups[i].active = false;
-        for (int i = 0; i < MAX_PARTICLES; i++) particles[i].active = false;
+        particles.clear();
+        bricks.resetStats();
     }
 
     int alivePlayerCount() const {
@@ -328,7 +334,7 @@ private:
             players[i].enabled = (i < n);
             players[i].color = playerColorForIndex(i);
             players[i].y = PADDLE_BASE_Y - i * PADDLE_STACK_SPACING_Y;
-            players[i].x = PANEL_RES_X / 2.0f - (float)players[i].width / 2.0f;
+            players[i].x = (Fixed::fromInt(PANEL_RES_X) - Fixed::fromInt(players[i].width)) / 2;
         }
     }
 
@@ -342,19 +348,19 @@ private:
             balls[i].attached = true;
             balls[i].shotStyle = shotStyle;
             balls[i].owner = owner;
-            balls[i].vx = 0.0f;
-            balls[i].vy = 0.0f;
+            balls[i].vx = 0;
+            balls[i].vy = 0;
             // Balls are always white; colors are reserved for powerups.
             balls[i].color = COLOR_WHITE;
             // IMPORTANT: initialize position immediately so the first draw frame
             // doesn't render the ball at (0,0) before the first update tick.
             if (owner < MAX_GAMEPADS) {
                 const Player& p = players[owner];
-                balls[i].x = p.x + (float)p.width * 0.5f;
-                balls[i].y = (float)p.y - 2.0f;
+                balls[i].x = p.x + Fixed::fromInt(p.width) / 2;
+                balls[i].y = Fixed::fromInt(p.y - 2);
             } else {
-                balls[i].x = (float)(PANEL_RES_X / 2);
-                balls[i].y = (float)(PADDLE_BASE_Y - 2);
+                balls[i].x = Fixed::fromInt(PANEL_RES_X / 2);
+                balls[i].y = Fixed::fromInt(PADDLE_BASE_Y - 2);
             }
             return i;
         }
@@ -367,21 +373,21 @@ private:
             if (!b.active || !b.attached) continue;
             if (b.owner >= MAX_GAMEPADS) b.owner = 0;
             const Player& p = players[b.owner];
-            b.x = p.x + (float)p.width * 0.5f;
-            b.y = (float)p.y - 2.0f;
+            b.x = p.x + Fixed::fromInt(p.width) / 2;
+            b.y = Fixed::fromInt(p.y - 2);
         }
     }
 
     bool launchOneAttachedBall(uint8_t owner, bool preferStraightShot) {
-        const float sp = baseBallSpeed();
+        const q16 sp = baseBallSpeed();
         for (int i = 0; i < MAX_BALLS; i++) {
             Ball& b = balls[i];
             if (!b.active || !b.attached || b.owner != owner) continue;
             b.attached = false;
             const bool shot = preferStraightShot || b.shotStyle;
-            const float s = shot ? (sp * BALL_SHOT_MULT) : sp;
+            const q16 s = shot ? Fixed::mul(sp, BALL_SHOT_MULT) : sp;
             b.vy = -s;
-            b.vx = shot ? 0.0f : ((random(0, 2) == 0) ? -s : s);
+            b.vx = shot ? 0 : ((random(0, 2) == 0) ? -s : s);
             b.shotStyle = shot;
             b.color = COLOR_WHITE;
             return true;
@@ -390,46 +396,32 @@ private:
     }
 
     void clampBallSpeed(Ball& b) const {
-        const float v = sqrtf(b.vx * b.vx + b.vy * b.vy);
-        if (v <= 0.0001f) return;
-        const float vmax = maxBallSpeed();
-        if (v > vmax) {
-            const float k = vmax / v;
-            b.vx *= k;
-            b.vy *= k;
-        }
+        const Fixed::Vec2 v = Fixed::clampLength(Fixed::Vec2{ b.vx, b.vy }, 0, maxBallSpeed());
+        b.vx = v.x;
+        b.vy = v.y;
     }
 
     void bounceBallOffPaddle(Ball& ball, const Player& p) {
         // Keep speed stable and avoid "too horizontal" rebounds which feel like
         // the paddle injected excessive momentum.
-        const float hitPos = constrain(((ball.x - p.x) / (float)p.width) * 2.0f - 1.0f, -1.0f, 1.0f);
-        const float sp = baseBallSpeed();
+        const q16 hitPos = Fixed::clamp(Fixed::div(ball.x - p.x, Fixed::fromInt(p.width)) * 2 - ONE, -ONE, ONE);
+        const q16 sp = baseBallSpeed();
 
         // Direction vector, then normalized to speed:
         // - vx scales with hit position
         // - vy stays strongly negative so the ball doesn't become a fast wall-hugger
-        const float vxN = hitPos;
-        const float vyN = -(1.15f - 0.35f * fabsf(hitPos));
-        const float vn = sqrtf(vxN * vxN + vyN * vyN);
-        if (vn > 0.0001f) {
-            ball.vx = (vxN / vn) * sp;
-            ball.vy = (vyN / vn) * sp;
-        } else {
-            ball.vx = 0.0f;
-            ball.vy = -sp;
-        }
+        // (vyN <= -0.8, so the direction is never zero.)
+        const q16 vxN = hitPos;
+        const q16 vyN = -(Fixed::fromFloat(1.15f) - Fixed::mul(Fixed::fromFloat(0.35f), Fixed::absVal(hitPos)));
+        const Fixed::Vec2 v = Fixed::withLength(Fixed::Vec2{ vxN, vyN }, sp);
+        ball.vx = v.x;
+        ball.vy = v.y;
         clampBallSpeed(ball);
     }
 
     // ---------------------------------------------------------
     // Bricks
     // ---------------------------------------------------------
-    int allocBrickSlot() {
-        for (int i = 0; i < MAX_BRICKS; i++) if (!bricks[i].active) return i;
-        return -1;
-    }
-
     uint16_t baseBrickColorForColumn(int col) const {
         static const uint16_t palette[] = { COLOR_RED, COLOR_ORANGE, COLOR_YELLOW, COLOR_GREEN, COLOR_CYAN, COLOR_BLUE, COLOR_PURPLE, COLOR_MAGENTA };
         return palette[col % (sizeof(palette) / sizeof(palette[0]))];
@@ -437,10 +429,9 @@ private:
 
     void spawnBrickRow(float y) {
         for (int col = 0; col < BRICK_COLS; col++) {
-            const int slot = allocBrickSlot();
-            if (slot < 0) break;
-            Brick& br = bricks[slot];
-            br.active = true;
+            Brick* slot = bricks.acquire();
+            if (!slot) break;
+            Brick& br = *slot;
             br.exploding = false;
             br.explodeStartMs = 0;
             br.x = brickXForCol(col);
@@ -457,9 +448,7 @@ private:
     }
 
     int activeBrickCount() const {
-        int c = 0;
-        for (int i = 0; i < MAX_BRICKS; i++) if (bricks[i].active) c++;
-        return c;
+        return (int)bricks.size();
     }
 
     bool handleAllClearBonus(uint32_t now) {
@@ -485,7 +474,7 @@ private:
         lastRowSpawnMs = now;
 
         // Small celebration burst (cheap, visible).
-        spawnParticles((float)(PANEL_RES_X / 2), (float)(HUD_H + 6), COLOR_YELLOW, 10, now);
+        spawnParticles(Fixed::fromInt(PANEL_RES_X / 2), Fixed::fromInt(HUD_H + 6), COLOR_YELLOW, 10, now);
 
         playSfxPatternCooldown(
             BreakoutGameAudio::SFX_ALL_CLEAR,
@@ -499,41 +488,23 @@ private:
     }
 
     void moveBricksDownOnePixel() {
-        for (int i = 0; i < MAX_BRICKS; i++) if (bricks[i].active) bricks[i].y += 1.0f;
+        for (uint16_t i = 0; i < bricks.size(); i++) bricks[i].y += 1.0f;
     }
 
     // ---------------------------------------------------------
     // Particles / FX
     // ---------------------------------------------------------
-    void spawnParticles(float x, float y, uint16_t color, uint8_t count, uint32_t now) {
+    void spawnParticles(q16 x, q16 y, uint16_t color, uint8_t count, uint32_t now) {
         // Density tuning: keep FX quality but reduce total particle count (cheaper on ESP32).
         const uint8_t tunedCount = max<uint8_t>(1, (uint8_t)(count / 2));
-        for (uint8_t n = 0; n < tunedCount; n++) {
-            int slot = -1;
-            for (int i = 0; i < MAX_PARTICLES; i++) if (!particles[i].active) { slot = i; break; }
-            if (slot < 0) return;
-            Particle& p = particles[slot];
-            p.active = true;
-            p.x = x;
-            p.y = y;
-            p.vx = ((float)random(-70, 71) / 100.0f) * 0.9f;
-            p.vy = ((float)random(-70, 71) / 100.0f) * 0.9f;
-            p.color = color;
-            p.endMs = now + (uint32_t)random(220, 520);
+        for (uint8_t n = 0; n < tunedCount && !particles.full(); n++) {
+            const q16 vx = Fixed::mul(Fixed::ratio(random(-70, 71), 100), Fixed::fromFloat(0.9f));
+            const q16 vy = Fixed::mul(Fixed::ratio(random(-70, 71), 100), Fixed::fromFloat(0.9f));
+            particles.spawn(x, y, vx, vy, color, now + (uint32_t)random(220, 520));
         }
     }
 
-    void updateParticles(uint32_t now) {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) continue;
-            if ((int32_t)(particles[i].endMs - now) <= 0) { particles[i].active = false; continue; }
-            particles[i].x += particles[i].vx;
-            particles[i].y += particles[i].vy;
-            particles[i].vx *= 0.97f;
-            particles[i].vy *= 0.97f;
-            particles[i].vy += 0.015f;
-        }
-    }
+    void updateParticles(uint32_t now) { particles.update(now); }
 
     // ---------------------------------------------------------
     // Powerups
@@ -550,12 +521,13 @@ private:
     }
 
     // Powerup motion tuning (floatier / slower overall)
-    static constexpr float POWERUP_GRAVITY = 0.010f;
-    static constexpr float POWERUP_DRAG = 0.984f;
-    static constexpr float POWERUP_BOUNCE = 0.78f; // energy kept on wall bounce (lower => slower after bounces)
+    static constexpr q16 POWERUP_GRAVITY = Fixed::fromFloat(0.010f);
+    static constexpr q16 POWERUP_DRAG = Fixed::fromFloat(0.984f);
+    static constexpr q16 POWERUP_BOUNCE = Fixed::fromFloat(0.78f); // energy kept on wall bounce (lower => slower after bounces)
+    static constexpr q16 POWERUP_MAX_V = Fixed::fromFloat(0.85f);
     static constexpr int POWERUP_SIZE_PX = 2;       // powerups render as 2x2
 
-    void maybeDropPowerup(float x, float y, float kickVx, float kickVy) {
+    void maybeDropPowerup(q16 x, q16 y, q16 kickVx, q16 kickVy) {
         const int baseChance = 18;
         const int chance = min(28, baseChance + level / 3);
         if (random(0, 100) >= chance) return;
@@ -578,8 +550,8 @@ private:
         powerups[slot].y = y;
         // Shoot out from the brick explosion with strong sideways kick (harder to catch),
         // but slower gravity so the player has time to chase.
-        powerups[slot].vx = kickVx + ((float)random(-80, 81) / 100.0f) * 0.28f;
-        powerups[slot].vy = kickVy + ((float)random(-20, 41) / 100.0f) * 0.08f;
+        powerups[slot].vx = kickVx + Fixed::mul(Fixed::ratio(random(-80, 81), 100), Fixed::fromFloat(0.28f));
+        powerups[slot].vy = kickVy + Fixed::mul(Fixed::ratio(random(-20, 41), 100), Fixed::fromFloat(0.08f));
         powerups[slot].tier = 0;
     }
 
@@ -592,7 +564,7 @@ private:
         if (type == PU_RED) {
             p.paddleTier = min<uint8_t>(5, (uint8_t)(p.paddleTier + 1));
             p.width = 10 + (int)p.paddleTier * 2;
-            p.x = constrain(p.x, 0.0f, (float)(PANEL_RES_X - p.width));
+            p.x = Fixed::clamp(p.x, 0, Fixed::fromInt(PANEL_RES_X - p.width));
         } else if (type == PU_BLUE) {
             floorShieldArmed = true;
         } else if (type == PU_GREEN) {
@@ -603,11 +575,11 @@ private:
     }
 
     void triggerPurpleExplosion(uint32_t now) {
+        if (bricks.empty()) return;
         int marked = 0;
         for (int tries = 0; tries < 60 && marked < 5; tries++) {
-            const int idx = random(0, MAX_BRICKS);
-            Brick& b = bricks[idx];
-            if (!b.active || b.exploding) continue;
+            Brick& b = bricks[(uint16_t)random(0, bricks.size())];
+            if (b.exploding) continue;
             b.exploding = true;
             b.explodeStartMs = now;
             marked++;
@@ -632,8 +604,8 @@ private:
         balls[dst] = balls[src];
         balls[dst].active = true;
         balls[dst].attached = false;
-        balls[dst].vx += ((float)random(-30, 31) / 100.0f) * 0.6f;
-        balls[dst].vy *= 0.98f;
+        balls[dst].vx += Fixed::mul(Fixed::ratio(random(-30, 31), 100), Fixed::fromFloat(0.6f));
+        balls[dst].vy = Fixed::mul(balls[dst].vy, Fixed::fromFloat(0.98f));
         balls[dst].color = COLOR_WHITE;
     }
 
@@ -645,40 +617,42 @@ private:
             pu.x += pu.vx;
             pu.y += pu.vy;
             pu.vy += POWERUP_GRAVITY;
-            pu.vx *= POWERUP_DRAG;
-            pu.vy *= POWERUP_DRAG;
+            pu.vx = Fixed::mul(pu.vx, POWERUP_DRAG);
+            pu.vy = Fixed::mul(pu.vy, POWERUP_DRAG);
 
             // Keep powerups inside screen bounds by bouncing off walls.
             // (Powerups are 2x2 pixels.)
-            const float maxX = (float)(PANEL_RES_X - POWERUP_SIZE_PX);
-            if (pu.x < 0.0f) {
-                pu.x = 0.0f;
-                pu.vx = fabsf(pu.vx) * POWERUP_BOUNCE;
+            const q16 maxX = Fixed::fromInt(PANEL_RES_X - POWERUP_SIZE_PX);
+            if (pu.x < 0) {
+                pu.x = 0;
+                pu.vx = Fixed::mul(Fixed::absVal(pu.vx), POWERUP_BOUNCE);
             } else if (pu.x > maxX) {
                 pu.x = maxX;
-                pu.vx = -fabsf(pu.vx) * POWERUP_BOUNCE;
+                pu.vx = -Fixed::mul(Fixed::absVal(pu.vx), POWERUP_BOUNCE);
             }
 
             // If launched upward into the top band, bounce down.
-            const float minY = (float)(HUD_H + 1);
+            const q16 minY = Fixed::fromInt(HUD_H + 1);
             if (pu.y < minY) {
                 pu.y = minY;
-                pu.vy = fabsf(pu.vy) * POWERUP_BOUNCE;
+                pu.vy = Fixed::mul(Fixed::absVal(pu.vy), POWERUP_BOUNCE);
             }
 
             // Extra safety clamp: avoid ultra-fast outliers from random kicks.
-            pu.vx = clampf(pu.vx, -0.85f, 0.85f);
-            pu.vy = clampf(pu.vy, -0.85f, 0.85f);
+            pu.vx = Fixed::clamp(pu.vx, -POWERUP_MAX_V, POWERUP_MAX_V);
+            pu.vy = Fixed::clamp(pu.vy, -POWERUP_MAX_V, POWERUP_MAX_V);
 
             // Catch by any paddle
             for (int pi = 0; pi < MAX_GAMEPADS; pi++) {
                 if (!players[pi].enabled || players[pi].lives <= 0) continue;
-                const int px = (int)players[pi].x;
+                const int px = Fixed::toInt(players[pi].x);
                 const int py = players[pi].y;
                 const int pw = players[pi].width;
+                const int ux = Fixed::toInt(pu.x);
+                const int uy = Fixed::toInt(pu.y);
 
-                if ((int)pu.y >= py - 1 && (int)pu.y <= py + 1 &&
-                    (int)pu.x >= px - 1 && (int)pu.x <= px + pw) {
+                if (uy >= py - 1 && uy <= py + 1 &&
+                    ux >= px - 1 && ux <= px + pw) {
                     // Pickup SFX (type-specific).
                     if (pu.type == PU_RED) {
                         playSfxPatternCooldown(BreakoutGameAudio::SFX_PICKUP_RED, BreakoutGameAudio::SFX_PICKUP_RED_N, BreakoutGameConfig::SFX_PICKUP_COOLDOWN_MS, now, sfx.lastPickupMs);
@@ -701,7 +675,7 @@ private:
             }
 
             if (!pu.active) continue;
-            if (pu.y > (float)(PANEL_RES_Y + 6)) pu.active = false;
+            if (pu.y > Fixed::fromInt(PANEL_RES_Y + 6)) pu.active = false;
         }
     }
 
@@ -709,8 +683,8 @@ private:
     // Brick hit / destroy
     // ---------------------------------------------------------
     void destroyBrick(Brick& b, uint32_t now, uint8_t owner) {
-        const float cx = (float)b.x + (float)BRICK_WIDTH * 0.5f;
-        const float cy = b.y + (float)BRICK_HEIGHT * 0.5f;
+        const q16 cx = Fixed::fromInt(b.x) + Fixed::fromInt(BRICK_WIDTH) / 2;
+        const q16 cy = Fixed::fromInt((int)b.y) + Fixed::fromInt(BRICK_HEIGHT) / 2;
         score += 8 + (int)b.maxHp * 4;
         bricksDestroyed++;
         recomputeLevel();
@@ -725,13 +699,11 @@ private:
         );
 
         // Strong sideways kick to make powerups harder to catch.
-        const float kickVx = ((float)random(-100, 101) / 100.0f) * 0.70f;  // -0.70..0.70 (a bit lighter/slower)
-        const float kickVy = -(((float)random(20, 80) / 100.0f) * 0.10f);   // -0.020..-0.080
-        maybeDropPowerup(cx - 1.0f, cy - 1.0f, kickVx, kickVy);
+        const q16 kickVx = Fixed::mul(Fixed::ratio(random(-100, 101), 100), Fixed::fromFloat(0.70f));  // -0.70..0.70 (a bit lighter/slower)
+        const q16 kickVy = -Fixed::mul(Fixed::ratio(random(20, 80), 100), Fixed::fromFloat(0.10f));    // -0.020..-0.080
+        maybeDropPowerup(cx - ONE, cy - ONE, kickVx, kickVy);
         (void)owner;
-        b.active = false;
-        b.exploding = false;
-        b.explodeStartMs = 0;
+        bricks.release(&b);
     }
 
     // ---------------------------------------------------------
@@ -764,15 +736,15 @@ private:
             ControllerPtr ctl = input ? input->getController(i) : nullptr;
             if (!(ctl && ctl->isConnected())) continue;
 
-            const float raw = clampf((float)InputDetail::axisX(ctl, 0) / (float)AXIS_DIVISOR, -1.0f, 1.0f);
-            float sx = deadzone01(raw, STICK_DEADZONE);
-            if (sx == 0.0f) {
+            const q16 raw = Fixed::clamp(Fixed::ratio(InputDetail::axisX(ctl, 0), AXIS_DIVISOR), -ONE, ONE);
+            q16 sx = deadzone01(raw, STICK_DEADZONE);
+            if (sx == 0) {
                 const uint8_t dpad = ctl->dpad();
-                if (dpad & 0x08) sx = -1.0f;
-                else if (dpad & 0x04) sx = 1.0f;
+                if (dpad & 0x08) sx = -ONE;
+                else if (dpad & 0x04) sx = ONE;
             }
-            p.x += sx * p.speed;
-            p.x = constrain(p.x, 0.0f, (float)(PANEL_RES_X - p.width));
+            p.x += Fixed::mul(sx, p.speed);
+            p.x = Fixed::clamp(p.x, 0, Fixed::fromInt(PANEL_RES_X - p.width));
         }
     }
 
@@ -802,7 +774,7 @@ private:
     }
 
     void updateBallsAndCollisions(uint32_t now) {
-        const float h = ballHalf();
+        const q16 h = ballHalf();
         for (int bi = 0; bi < MAX_BALLS; bi++) {
             Ball& ball = balls[bi];
             if (!ball.active || ball.attached) continue;
@@ -811,24 +783,24 @@ private:
             ball.y += ball.vy;
 
             // Walls
-            if (ball.x - h <= 0.0f || ball.x + h >= (float)PANEL_RES_X) {
+            if (ball.x - h <= 0 || ball.x + h >= Fixed::fromInt(PANEL_RES_X)) {
                 ball.vx = -ball.vx;
-                ball.x = constrain(ball.x, h, (float)PANEL_RES_X - h);
+                ball.x = Fixed::clamp(ball.x, h, Fixed::fromInt(PANEL_RES_X) - h);
                 clampBallSpeed(ball);
             }
-            if (ball.y - h <= (float)(HUD_H + 1)) {
+            if (ball.y - h <= Fixed::fromInt(HUD_H + 1)) {
                 ball.vy = -ball.vy;
-                ball.y = (float)(HUD_H + 1) + h;
+                ball.y = Fixed::fromInt(HUD_H + 1) + h;
                 clampBallSpeed(ball);
             }
 
             // Global floor shield (one-hit, full width).
             // Only interacts with descending balls near the bottom.
-            if (floorShieldArmed && ball.vy > 0.0f) {
+            if (floorShieldArmed && ball.vy > 0) {
                 const int sy = PANEL_RES_Y - 1;
                 if (checkRectCollision(ball.x, ball.y, 0, sy, PANEL_RES_X, 1)) {
-                    ball.vy = -fabsf(ball.vy);
-                    ball.y = (float)sy - h;
+                    ball.vy = -Fixed::absVal(ball.vy);
+                    ball.y = Fixed::fromInt(sy) - h;
                     floorShieldArmed = false;
                     spawnParticles(ball.x, ball.y, COLOR_BLUE, 10, now);
                     clampBallSpeed(ball);
@@ -848,14 +820,14 @@ private:
                 Player& p = players[pi];
                 if (!p.enabled || p.lives <= 0) continue;
 
-                const int px = (int)p.x;
+                const int px = Fixed::toInt(p.x);
                 const int py = p.y;
                 const int pw = p.width;
 
                 if (checkRectCollision(ball.x, ball.y, px, py, pw, PADDLE_H)) {
                     ball.owner = (uint8_t)pi;
                     bounceBallOffPaddle(ball, p);
-                    ball.y = (float)py - h;
+                    ball.y = Fixed::fromInt(py) - h;
 
                     playSfxPatternCooldown(
                         BreakoutGameAudio::SFX_PADDLE_HIT,
@@ -869,21 +841,21 @@ private:
             }
 
             // Bricks (one hit per tick per ball)
-            for (int ri = 0; ri < MAX_BRICKS; ri++) {
+            for (uint16_t ri = 0; ri < bricks.size(); ri++) {
                 Brick& br = bricks[ri];
-                if (!br.active || br.exploding) continue;
+                if (br.exploding) continue;
                 const int bx = br.x;
                 const int by = (int)br.y;
                 if (!checkRectCollision(ball.x, ball.y, bx, by, BRICK_WIDTH, BRICK_HEIGHT)) continue;
 
                 if (br.hp > 0) br.hp--;
 
-                const float brickCenterX = (float)bx + (float)BRICK_WIDTH * 0.5f;
-                const float brickCenterY = (float)by + (float)BRICK_HEIGHT * 0.5f;
-                const float dx = ball.x - brickCenterX;
-                const float dy = ball.y - brickCenterY;
-                if (fabsf(dx) > fabsf(dy)) ball.vx = (dx > 0) ? fabsf(ball.vx) : -fabsf(ball.vx);
-                else ball.vy = (dy > 0) ? fabsf(ball.vy) : -fabsf(ball.vy);
+                const q16 brickCenterX = Fixed::fromInt(bx) + Fixed::fromInt(BRICK_WIDTH) / 2;
+                const q16 brickCenterY = Fixed::fromInt(by) + Fixed::fromInt(BRICK_HEIGHT) / 2;
+                const q16 dx = ball.x - brickCenterX;
+                const q16 dy = ball.y - brickCenterY;
+                if (Fixed::absVal(dx) > Fixed::absVal(dy)) ball.vx = (dx > 0) ? Fixed::absVal(ball.vx) : -Fixed::absVal(ball.vx);
+                else ball.vy = (dy > 0) ? Fixed::absVal(ball.vy) : -Fixed::absVal(ball.vy);
                 clampBallSpeed(ball);
 
                 spawnParticles(brickCenterX, brickCenterY, br.baseColor, 4, now);
@@ -899,7 +871,7 @@ private:
             }
 
             // Lost
-            if (ball.y > (float)PANEL_RES_Y + h + 2.0f) ball.active = false;
+            if (ball.y > Fixed::fromInt(PANEL_RES_Y + 2) + h) ball.active = false;
         }
     }
 
@@ -933,15 +905,15 @@ private:
         const int topPaddleY = highestPaddleY();
         const int breachY = topPaddleY - 2;
         bool breached = false;
-        for (int i = 0; i < MAX_BRICKS; i++) if (bricks[i].active && (int)bricks[i].y >= breachY) { breached = true; break; }
+        for (uint16_t i = 0; i < bricks.size(); i++) if ((int)bricks[i].y >= breachY) { breached = true; break; }
         if (breached) {
             for (int pi = 0; pi < MAX_GAMEPADS; pi++) if (players[pi].enabled && players[pi].lives > 0) loseLife((uint8_t)pi, now);
             const int clearY = topPaddleY - 10;
-            for (int i = 0; i < MAX_BRICKS; i++) {
-                if (!bricks[i].active) continue;
-                if ((int)bricks[i].y >= clearY) {
-                    spawnParticles((float)bricks[i].x + 2.0f, bricks[i].y + 1.0f, bricks[i].baseColor, 6, now);
-                    bricks[i].active = false;
+            for (uint16_t i = bricks.size(); i-- > 0;) {
+                Brick& b = bricks[i];
+                if ((int)b.y >= clearY) {
+                    spawnParticles(Fixed::fromInt(b.x + 2), Fixed::fromInt((int)b.y + 1), b.baseColor, 6, now);
+                    bricks.release(&b);
                 }
             }
         }
@@ -949,11 +921,11 @@ private:
 
     void updatePurpleExplosions(uint32_t now) {
         static constexpr uint32_t LIFE_MS = 360;
-        for (int i = 0; i < MAX_BRICKS; i++) {
+        for (uint16_t i = bricks.size(); i-- > 0;) {
             Brick& b = bricks[i];
-            if (!b.active || !b.exploding) continue;
+            if (!b.exploding) continue;
             const uint32_t age = (uint32_t)(now - b.explodeStartMs);
-            if ((age % 90) < 16) spawnParticles((float)b.x + 2.0f, b.y + 1.0f, COLOR_PURPLE, 5, now);
+            if ((age % 90) < 16) spawnParticles(Fixed::fromInt(b.x + 2), Fixed::fromInt((int)b.y + 1), COLOR_PURPLE, 5, now);
             if (age >= LIFE_MS) { b.hp = 0; destroyBrick(b, now, 0); }
         }
     }
@@ -985,7 +957,7 @@ private:
         for (int i = 0; i < MAX_GAMEPADS; i++) {
             const Player& p = players[i];
             if (!p.enabled || p.lives <= 0) continue;
-            const int x = (int)p.x;
+            const int x = Fixed::toInt(p.x);
             const int y = p.y;
 
             display->fillRect(x, y, p.width, PADDLE_H, p.color);
@@ -1009,29 +981,20 @@ private:
     }
 
     void drawBall(MatrixPanel_I2S_DMA* display, const Ball& b) const {
-        const int x = (int)b.x - 1;
-        const int y = (int)b.y - 1;
+        const int x = Fixed::toInt(b.x) - 1;
+        const int y = Fixed::toInt(b.y) - 1;
         display->fillRect(x, y, BALL_SIZE_PX, BALL_SIZE_PX, b.color);
     }
 
     void drawPowerup(MatrixPanel_I2S_DMA* display, const PowerUp& pu) const {
-        const int x = (int)pu.x;
-        const int y = (int)pu.y;
+        const int x = Fixed::toInt(pu.x);
+        const int y = Fixed::toInt(pu.y);
         const uint16_t c = powerupColor(pu.type);
         display->fillRect(x, y, 2, 2, c);
         display->drawPixel(x, y, brightenColor(c, 28));
     }
 
-    void drawParticles(MatrixPanel_I2S_DMA* display, uint32_t now) const {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) continue;
-            if ((int32_t)(particles[i].endMs - now) <= 0) continue;
-            const int x = (int)particles[i].x;
-            const int y = (int)particles[i].y;
-            if (x < 0 || x >= PANEL_RES_X || y < HUD_H || y >= PANEL_RES_Y) continue;
-            display->drawPixel(x, y, particles[i].color);
-        }
-    }
+    void drawParticles(MatrixPanel_I2S_DMA* display, uint32_t now) const { particles.draw(display, now); }
 
 public:
     BreakoutGame() = default;
@@ -1047,7 +1010,6 @@ public:
         phase = PHASE_COUNTDOWN;
         phaseStartMs = (uint32_t)millis();
 
-        lastUpdateMs = phaseStartMs;
         lastScrollMs = phaseStartMs;
         lastRowSpawnMs = phaseStartMs;
 
@@ -1073,11 +1035,11 @@ public:
         start();
     }
 
-    void update(ControllerManager* input) override {
+    uint16_t fixedStepMs() const override { return (uint16_t)UPDATE_INTERVAL_MS; }
+
+    void step(ControllerManager* input, uint32_t now, uint16_t dtMs) override {
+        (void)dtMs;
         if (gameOver) return;
-        const uint32_t now = (uint32_t)millis();
-        if ((uint32_t)(now - lastUpdateMs) < UPDATE_INTERVAL_MS) return;
-        lastUpdateMs = now;
 
         if (phase == PHASE_COUNTDOWN) {
             if ((uint32_t)(now - phaseStartMs) >= COUNTDOWN_MS) phase = PHASE_PLAYING;
@@ -1103,6 +1065,7 @@ public:
         if (alivePlayerCount() <= 0) {
             gameOver = true;
             phase = PHASE_GAME_OVER;
+            bricks.logStats("Breakout.bricks");
 
             playSfxPatternCooldown(
                 BreakoutGameAudio::SFX_GAME_OVER,
@@ -1128,8 +1091,8 @@ public:
         }
 
         // HUD
-        SmallFont::drawStringF(display, 2, 6, COLOR_YELLOW, "S:%d", score);
-        SmallFont::drawStringF(display, 34, 6, COLOR_WHITE, "W:%d", level);
+        SmallFont::drawValue(display, 2, 6, COLOR_YELLOW, "S:", score);
+        SmallFont::drawValue(display, 34, 6, COLOR_WHITE, "W:", level);
         for (int x = 0; x < PANEL_RES_X; x += 2) display->drawPixel(x, HUD_H - 1, COLOR_BLUE);
 
         if (phase == PHASE_COUNTDOWN) {
@@ -1141,7 +1104,7 @@ public:
         }
 
         // Bricks
-        for (int i = 0; i < MAX_BRICKS; i++) if (bricks[i].active) drawBrickShaded(display, bricks[i], now);
+        for (uint16_t i = 0; i < bricks.size(); i++) drawBrickShaded(display, bricks[i], now);
 
         // Powerups
         for (int i = 0; i < MAX_POWERUPS; i++) if (powerups[i].active) drawPowerup(display, powerups[i]);
@@ -13,13 +13,14 @@
 
 #include <Arduino.h>
 #include "../../engine/config.h"
+#include "../../engine/FixedPoint.h"
 
 namespace BreakoutGameConfig {
 
 // -----------------------------------------------------------------------------
 // Input / tick
 // -----------------------------------------------------------------------------
-static constexpr float STICK_DEADZONE = 0.18f;
+static constexpr Fixed::q16 STICK_DEADZONE = Fixed::fromFloat(0.18f);
 static constexpr int16_t AXIS_DIVISOR = 512;
 static constexpr uint16_t UPDATE_INTERVAL_MS = 16; // ~60 FPS logic tick
 
@@ -62,15 +63,15 @@ static constexpr int BRICK_SPACING = 1;
 // Ball
 // -----------------------------------------------------------------------------
 static constexpr int BALL_SIZE_PX = 2;
-static inline constexpr float BALL_HALF = 1.0f; // 2x2 render => half-size ~1px
+static inline constexpr Fixed::q16 BALL_HALF = Fixed::fromFloat(1.0f); // 2x2 render => half-size ~1px
 
 // IMPORTANT:
 // - Ball speed should NOT scale with "level".
 // - Difficulty is controlled via brick HP / scroll / spawn pacing instead.
-// - Values are in "pixels per logic tick" (tick ~60 FPS by default).
-static constexpr float BALL_SPEED = 0.95f;
-static constexpr float BALL_SHOT_MULT = 1.35f;  // green powerup / straight-shot launch boost
-static constexpr float BALL_MAX_SPEED = 1.65f;  // absolute clamp to prevent runaway spikes
+// - Values are in "pixels per logic tick" (tick ~60 FPS by default), Q16.16 fixed point.
+static constexpr Fixed::q16 BALL_SPEED = Fixed::fromFloat(0.95f);
+static constexpr Fixed::q16 BALL_SHOT_MULT = Fixed::fromFloat(1.35f);  // green powerup / straight-shot launch boost
+static constexpr Fixed::q16 BALL_MAX_SPEED = Fixed::fromFloat(1.65f);  // absolute clamp to prevent runaway spikes
 
 // -----------------------------------------------------------------------------
 // Pools (avoid heap churn on ESP32)
@@ -78,7 +79,7 @@ static constexpr float BALL_MAX_SPEED = 1.65f;  // absolute clamp to prevent run
 static constexpr int MAX_BALLS = 8;
 static constexpr int MAX_BRICKS = 240;
 static constexpr int MAX_POWERUPS = 10;
-static constexpr int MAX_PARTICLES = 90;
+static constexpr uint16_t MAX_PARTICLES = 90; // particle budget (engine/ParticleSystem.h)
 
 // -----------------------------------------------------------------------------
 // Powerups
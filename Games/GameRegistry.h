@@ -0,0 +1,95 @@
+#pragma once
+#include <Arduino.h>
+#include "../engine/GameDescriptor.h"
+#include "../engine/config.h"
+
+#include "Snake/SnakeGame.h"
+#include "Tron/TronGame.h"
+#include "Pong/PongGame.h"
+#include "Breakout/BreakoutGame.h"
+#include "Shooter/ShooterGame.h"
+#include "Labyrinth/LabyrinthGame.h"
+#include "Tetris/TetrisGame.h"
+#include "Asteroids/AsteroidsGame.h"
+#include "Music/MusicApp.h"
+#include "MVisual/MVisualApp.h"
+
+/**
+ * GameRegistry
+ * ------------
+ * The single list of launchable games / applets. Menu order == entry order, and the
+ * entry index is the "game slot" used by the engine (profiler context, input logs).
+ *
+ * To add a game: include its header and append one `GameDescriptor::of<T>()` line.
+ * Menu visibility (player counts), launch and the leaderboard browser follow automatically.
+ */
+namespace GameRegistry {
+
+static constexpr GameDescriptor ENTRIES[] = {
+    GameDescriptor::of<SnakeGame>("Snake", "snake"),
+    GameDescriptor::of<TronGame>("Tron", "tron"),
+    GameDescriptor::of<PongGame>("Pong", "pong"),
+    GameDescriptor::of<BreakoutGame>("Breakout", "breakout"),
+    GameDescriptor::of<ShooterGame>("Shooter", "shooter"),
+    GameDescriptor::of<LabyrinthGame>("Labyrinth", "labyrinth"),
+    GameDescriptor::of<TetrisGame>("Tetris", "tetris", 1, 1),
+    GameDescriptor::of<AsteroidsGame>("Asteroids", "asteroids", 1, 1),
+    GameDescriptor::of<MusicApp>("Music", nullptr),
+    GameDescriptor::of<MVisualApp>("MVisual", nullptr),
+};
+
+static constexpr uint8_t COUNT = (uint8_t)(sizeof(ENTRIES) / sizeof(ENTRIES[0]));
+
+// Largest / strictest entry (sizes the engine's GameArena).
+static constexpr size_t maxBytesFrom(uint8_t i) {
+    return (i >= COUNT) ? 0
+         : (ENTRIES[i].staticBytes > maxBytesFrom((uint8_t)(i + 1))) ? ENTRIES[i].staticBytes
+         : maxBytesFrom((uint8_t)(i + 1));
+}
+static constexpr size_t maxAlignFrom(uint8_t i) {
+    return (i >= COUNT) ? 1
+         : (ENTRIES[i].alignBytes > maxAlignFrom((uint8_t)(i + 1))) ? ENTRIES[i].alignBytes
+         : maxAlignFrom((uint8_t)(i + 1));
+}
+static constexpr size_t MAX_GAME_BYTES = maxBytesFrom(0);
+static constexpr size_t MAX_GAME_ALIGN = maxAlignFrom(0);
+
+static GameLaunchStats launchStats[COUNT];
+
+static inline const GameDescriptor* at(int slot) {
+    return (slot >= 0 && slot < (int)COUNT) ? &ENTRIES[slot] : nullptr;
+}
+
+// Leaderboard browser: entries with a leaderboard id, in registry order.
+static inline uint8_t leaderboardCount() {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < COUNT; i++) if (ENTRIES[i].hasLeaderboard()) n++;
+    return n;
+}
+
+static inline const GameDescriptor* leaderboardAt(int index) {
+    for (uint8_t i = 0; i < COUNT; i++) {
+        if (!ENTRIES[i].hasLeaderboard()) continue;
+        if (index-- == 0) return &ENTRIES[i];
+    }
+    return nullptr;
+}
+
+/** Serial table: slot, name, players, FPS, object size, launch latency. */
+static inline void dump(Print& out) {
+    out.print(F("[Games] arena bytes="));
+    out.println((unsigned long)MAX_GAME_BYTES);
+    out.println(F("[Games] slot name       players fps  bytes  launches last_us max_us"));
+    for (uint8_t i = 0; i < COUNT; i++) {
+        const GameDescriptor& d = ENTRIES[i];
+        const GameLaunchStats& s = launchStats[i];
+        char line[96];
+        snprintf(line, sizeof(line), "[Games] %-4u %-10s %u-%u     %-4u %-6lu %-8lu %-7lu %lu",
+                 (unsigned)i, d.name, (unsigned)d.minPlayers, (unsigned)d.maxPlayers,
+                 (unsigned)d.preferredFps, (unsigned long)d.staticBytes,
+                 (unsigned long)s.launches, (unsigned long)s.lastUs, (unsigned long)s.maxUs);
+        out.println(line);
+    }
+}
+
+} // namespace GameRegistry
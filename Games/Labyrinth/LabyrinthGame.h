@@ -8,6 +8,8 @@
 #include "../../engine/Settings.h"
 #include "../../engine/UserProfiles.h"
 #include "../../component/GameOverLeaderboardView.h"
+#include "../../component/TileLayer.h"
+#include "../../engine/IndexedCanvas.h"
 #include "LabyrinthGameConfig.h"
 
 /**
@@ -88,8 +90,18 @@ private:
     int mazeOriginX = 0; // screen-space origin for drawing (centered)
     int mazeOriginY = HUD_H; // screen-space origin for drawing (centered within playfield)
     
+    // Indexed-canvas palette: the maze and player entries (IDX_WALL..IDX_PLAYER, in
+    // this order) fade; HUD entries do not.
+    enum PaletteIndex : uint8_t {
+        IDX_BLACK = 0, IDX_WALL, IDX_PATH, IDX_EXIT, IDX_PLAYER,
+        IDX_SCORE, IDX_TIME, IDX_DIVIDER
+    };
+    static constexpr uint8_t FADED_COLORS = IDX_PLAYER - IDX_WALL + 1;
+
     // Maze data: 0 = wall, 1 = path, 2 = start, 3 = exit
     uint8_t maze[MAX_MAZE_H][MAX_MAZE_W];
+    // Incremental maze renderer (re-attached per level; repaints only cells the player crossed).
+    TileLayer<MAX_MAZE_W, MAX_MAZE_H> mazeLayer;
     int exitX, exitY;
     // IMPORTANT (ESP32):
     // Do NOT allocate large temporary buffers as class members (heap) or locals (stack).
@@ -462,6 +474,8 @@ private:
         // Mark start & exit
         maze[startY][startX] = 2;
         maze[exitY][exitX] = 3;
+        mazeLayer.attach(&maze[0][0], (uint16_t)mazeW, (uint16_t)mazeH, MAX_MAZE_W,
+                         (uint8_t)cellSizePx, (int16_t)mazeOriginX, (int16_t)mazeOriginY);
 
         // Reset player position (TOP-LEFT of the player rect, in SCREEN coords)
         // Center the player inside the start tile.
@@ -533,19 +547,6 @@ private:
         return (s > 60) ? 60 : s;
     }
 
-    static inline uint16_t scaleColor565(uint16_t c, uint8_t alpha) {
-        // Scale an RGB565 color toward black using alpha in [0..255].
-        // 0 -> black, 255 -> original color.
-        const uint16_t r5 = (uint16_t)((c >> 11) & 0x1Fu);
-        const uint16_t g6 = (uint16_t)((c >> 5) & 0x3Fu);
-        const uint16_t b5 = (uint16_t)(c & 0x1Fu);
-
-        const uint16_t r5s = (uint16_t)((r5 * (uint16_t)alpha + 127u) / 255u);
-        const uint16_t g6s = (uint16_t)((g6 * (uint16_t)alpha + 127u) / 255u);
-        const uint16_t b5s = (uint16_t)((b5 * (uint16_t)alpha + 127u) / 255u);
-        return (uint16_t)((r5s << 11) | (g6s << 5) | b5s);
-    }
-
     void beginFade(AnimMode mode, uint32_t nowMs, uint16_t durationMs) {
         animMode = mode;
         animStartMs = nowMs;
@@ -594,10 +595,11 @@ public:
         start();
     }
 
-    void update(ControllerManager* input) override {
+    uint16_t fixedStepMs() const override { return (uint16_t)UPDATE_INTERVAL_MS; }
+
+    void step(ControllerManager* input, uint32_t nowMs, uint16_t dtMs) override {
+        (void)dtMs;
         if (gameOver) return;
-        
-        const uint32_t nowMs = (uint32_t)millis();
 
         // Intro fade-in blocks gameplay and freezes timer until complete.
         if (!levelComplete && animMode == ANIM_FADE_IN) {
@@ -641,10 +643,6 @@ public:
             return;
         }
         
-        // Throttle updates
-        if (nowMs - (uint32_t)lastUpdate < (uint32_t)UPDATE_INTERVAL_MS) return;
-        lastUpdate = nowMs;
-
         // Timer (1 minute per level)
         if (levelStartTimeMs != 0) {
             cachedSecondsLeft = computeSecondsLeft(nowMs);
@@ -736,6 +734,7 @@ public:
 
         if (gameOver) {
             display->fillScreen(COLOR_BLACK);
+            mazeLayer.invalidate();
             char tag[4];
             UserProfiles::getPadTag(0, tag);
             GameOverLeaderboardView::draw(display, "GAME OVER", leaderboardId(), leaderboardScore(), tag);
@@ -747,74 +746,81 @@ public:
             // Keep HUD visible; only clear the labyrinth area.
             // HUD
             display->fillScreen(COLOR_BLACK);
-            SmallFont::drawStringF(display, 2, 6, COLOR_YELLOW, "S:%lu", (unsigned long)score);
+            mazeLayer.invalidate();
+            SmallFont::drawValue(display, 2, 6, COLOR_YELLOW, "S:", (int32_t)score);
             char tbuf[10];
-            snprintf(tbuf, sizeof(tbuf), "T:%u", (unsigned int)cachedSecondsLeft);
+            const int tlen = 2 + (int)SmallFont::formatUInt(tbuf, sizeof(tbuf), (uint32_t)cachedSecondsLeft); // "T:" + digits
             const int approxCharW = 4;
-            const int tx = PANEL_RES_X - 2 - ((int)strlen(tbuf) * approxCharW);
-            SmallFont::drawString(display, tx, 6, tbuf, COLOR_CYAN);
+            const int tx = PANEL_RES_X - 2 - (tlen * approxCharW);
+            SmallFont::drawValue(display, tx, 6, COLOR_CYAN, "T:", (int32_t)cachedSecondsLeft);
             for (int x = 0; x < PANEL_RES_X; x += 2) display->drawPixel(x, HUD_H-1, COLOR_BLUE);
 
             // Labyrinth area (no HUD fade)
             display->fillRect(mazeOriginX, mazeOriginY, mazeW * cellSizePx, mazeH * cellSizePx, COLOR_BLACK);
             SmallFont::drawString(display, mazeOriginX + 10, mazeOriginY + 20, "COMPLETED", COLOR_GREEN);
-            SmallFont::drawStringF(display, mazeOriginX + 12, mazeOriginY + 30, COLOR_YELLOW, "+%u", (unsigned int)(secondsLeftAtComplete + 10));
+            SmallFont::drawValue(display, mazeOriginX + 12, mazeOriginY + 30, COLOR_YELLOW, "+", (int32_t)(secondsLeftAtComplete + 10));
             return;
         }
         
-        display->fillScreen(COLOR_BLACK);
-        
+        // Playfield goes through the shared indexed canvas: fades only rewrite palette entries,
+        // so neither the maze nor the index buffer is touched while fading.
+        IndexedCanvas& canvas = IndexedCanvas::shared();
+
+        // Softer colors for walls/exit (below HUD)
+        const uint16_t mazeColors[FADED_COLORS] = {
+            display->color565(80, 120, 200),  // wall: soft blue
+            display->color565(10, 20, 40),    // path: near black
+            display->color565(120, 220, 120), // exit: soft green
+            player.color
+        };
+
+        // Apply fade brightness ONLY to labyrinth content (not HUD).
+        const uint8_t a = currentFadeAlpha(nowMs);
+        canvas.setColor(IDX_BLACK, COLOR_BLACK);
+        canvas.fadeColors(IDX_WALL, mazeColors, FADED_COLORS, a);
+        canvas.setColor(IDX_SCORE, COLOR_YELLOW);
+        canvas.setColor(IDX_TIME, COLOR_CYAN);
+        canvas.setColor(IDX_DIVIDER, COLOR_BLUE);
+
+        // Tile ids: 0 wall, 1 path, 2 start (drawn as path), 3 exit -> palette indices.
+        static const uint16_t TILE_INDEX[4] = { IDX_WALL, IDX_PATH, IDX_PATH, IDX_EXIT };
+        mazeLayer.setPalette(TILE_INDEX, 4);
+        if (mazeLayer.needsFullRepaint()) {
+            canvas.fillScreen(IDX_BLACK);
+            canvas.invalidate();
+        } else {
+            mazeLayer.clearOutside(&canvas, IDX_BLACK);
+        }
+
+        // Draw maze (layer first; HUD and player go on top)
+        mazeLayer.draw(&canvas);
+
         // HUD
-        SmallFont::drawStringF(display, 2, 6, COLOR_YELLOW, "S:%lu", (unsigned long)score);
+        SmallFont::drawValue(&canvas, 2, 6, IDX_SCORE, "S:", (int32_t)score);
 
         // Right-aligned timer (T:60 .. T:0)
         char tbuf[10];
-        snprintf(tbuf, sizeof(tbuf), "T:%u", (unsigned int)cachedSecondsLeft);
+        const int tlen = 2 + (int)SmallFont::formatUInt(tbuf, sizeof(tbuf), (uint32_t)cachedSecondsLeft); // "T:" + digits
         const int approxCharW = 4; // TomThumb is ~3px wide with spacing; 4 is a good estimate.
-        const int tx = PANEL_RES_X - 2 - ((int)strlen(tbuf) * approxCharW);
-        SmallFont::drawString(display, tx, 6, tbuf, COLOR_CYAN);
+        const int tx = PANEL_RES_X - 2 - (tlen * approxCharW);
+        SmallFont::drawValue(&canvas, tx, 6, IDX_TIME, "T:", (int32_t)cachedSecondsLeft);
 
         // Divider under HUD
-        for (int x = 0; x < PANEL_RES_X; x += 2) display->drawPixel(x, HUD_H-1, COLOR_BLUE);
-
-        // Softer colors for walls/exit (below HUD)
-        uint16_t wallColor = display->color565(80, 120, 200);   // soft blue
-        uint16_t pathColor = display->color565(10, 20, 40);     // near black
-        uint16_t exitColor = display->color565(120, 220, 120);  // soft green
-
-        // Apply fade brightness ONLY to labyrinth content (not HUD).
-        const uint8_t a = currentFadeAlpha(nowMs);
-        if (a != 255) {
-            wallColor = scaleColor565(wallColor, a);
-            pathColor = scaleColor565(pathColor, a);
-            exitColor = scaleColor565(exitColor, a);
-        }
+        for (int x = 0; x < PANEL_RES_X; x += 2) canvas.drawPixel(x, HUD_H-1, IDX_DIVIDER);
 
-        // Draw maze
-        for (int y = 0; y < mazeH; y++) {
-            for (int x = 0; x < mazeW; x++) {
-                const int screenX = mazeOriginX + x * cellSizePx;
-                const int screenY = mazeOriginY + y * cellSizePx;
-                
-                if (maze[y][x] == 0) {
-                    if (cellSizePx == 1) display->drawPixel(screenX, screenY, wallColor);
-                    else display->fillRect(screenX, screenY, cellSizePx, cellSizePx, wallColor);
-                } else if (maze[y][x] == 3) {
-                    if (cellSizePx == 1) display->drawPixel(screenX, screenY, exitColor);
-                    else display->fillRect(screenX, screenY, cellSizePx, cellSizePx, exitColor);
-                } else {
-                    if (cellSizePx == 1) display->drawPixel(screenX, screenY, pathColor);
-                    else display->fillRect(screenX, screenY, cellSizePx, cellSizePx, pathColor);
-                }
-            }
-        }
-        
         // Draw player
         const int px = fpToIntFloor(player.x_fp);
         const int py = fpToIntFloor(player.y_fp);
-        const uint16_t playerColor = (a == 255) ? player.color : scaleColor565(player.color, a);
-        if (player.sizePx <= 1) display->drawPixel(px, py, playerColor);
-        else display->fillRect(px, py, player.sizePx, player.sizePx, playerColor);
+        if (player.sizePx <= 1) canvas.drawPixel(px, py, IDX_PLAYER);
+        else canvas.fillRect(px, py, player.sizePx, player.sizePx, IDX_PLAYER);
+        mazeLayer.markPixelRectDirty(px, py, max(1, (int)player.sizePx), max(1, (int)player.sizePx));
+
+        canvas.resolve(display);
+    }
+
+    void onCanvasLost() override {
+        mazeLayer.invalidate();
+        IndexedCanvas::shared().invalidate();
     }
 
     bool isGameOver() override {
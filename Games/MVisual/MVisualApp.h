@@ -124,10 +124,9 @@ public:
 
     bool isGameOver() override { return gameOver; } // applet: never "game over"
 
-    uint16_t preferredRenderFps() const override {
-        // This is mostly a shader-like display; 30 FPS is plenty and reduces HUB75 artifacts.
-        return 30;
-    }
+    // This is mostly a shader-like display; 30 FPS is plenty and reduces HUB75 artifacts.
+    static constexpr uint16_t RENDER_FPS = 30;
+    uint16_t preferredRenderFps() const override { return RENDER_FPS; }
 
 private:
     // -------------------------------------------------------------------------
@@ -366,12 +365,12 @@ private:
         for (int x = 0; x < PANEL_RES_X; x += 2) d->drawPixel(x, MVisualAppConfig::HUD_H - 1, COLOR_BLUE);
 
         SmallFont::drawString(d, 2, 6, "MVIS", COLOR_CYAN);
-        SmallFont::drawStringF(d, 32, 6, COLOR_YELLOW, "B%02d", (int)bars);
+        SmallFont::drawValue(d, 32, 6, COLOR_YELLOW, "B", (int32_t)bars, 2);
 
         if (colorMode == MODE_MONO_GRADIENT) {
-            SmallFont::drawStringF(d, 48, 6, COLOR_WHITE, "M%d", (int)monoColorIndex + 1);
+            SmallFont::drawValue(d, 48, 6, COLOR_WHITE, "M", (int32_t)monoColorIndex + 1);
         } else {
-            SmallFont::drawStringF(d, 48, 6, COLOR_WHITE, "R%d", (int)rainbowEffectIndex + 1);
+            SmallFont::drawValue(d, 48, 6, COLOR_WHITE, "R", (int32_t)rainbowEffectIndex + 1);
         }
         const char sc = (shadingMode == SHADING_HORIZONTAL) ? 'H' : (shadingMode == SHADING_VERTICAL) ? 'V' : ' ';
         char sbuf[2] = { sc, '\0' };
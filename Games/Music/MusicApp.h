@@ -79,7 +79,7 @@ public:
         for (int x = 0; x < PANEL_RES_X; x += 2) display->drawPixel(x, HUD_H - 1, COLOR_BLUE);
 
         // Right side HUD: volume + playing marker.
-        SmallFont::drawStringF(display, 38, 6, COLOR_YELLOW, "V%02d", (int)globalSettings.getSoundVolumeLevel());
+        SmallFont::drawValue(display, 38, 6, COLOR_YELLOW, "V", (int32_t)globalSettings.getSoundVolumeLevel(), 2);
         if (playingIndex >= 0) {
             SmallFont::drawString(display, 56, 6, "PL", COLOR_GREEN);
         } else {
@@ -95,7 +95,8 @@ public:
 
     bool isGameOver() override { return false; }
 
-    uint16_t preferredRenderFps() const override { return 30; }
+    static constexpr uint16_t RENDER_FPS = 30;
+    uint16_t preferredRenderFps() const override { return RENDER_FPS; }
 
     // -----------------------------------------------------
     // ListModel
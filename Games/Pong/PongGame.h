@@ -1,11 +1,11 @@
 #pragma once
 #include <Arduino.h>
-#include <math.h>
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include "../../engine/GameBase.h"
 #include "../../engine/ControllerManager.h"
 #include "../../engine/config.h"
 #include "../../engine/AudioManager.h"
+#include "../../engine/FixedPoint.h"
 #include "../../component/SmallFont.h"
 #include "../../engine/Settings.h"
 #include "../../engine/UserProfiles.h"
@@ -16,6 +16,9 @@
 /**
  * PongGame - Classic Pong game implementation
  * Supports 1-2 players with paddle controls
+ *
+ * Ball and paddle physics are Q16.16 fixed point (engine/FixedPoint.h), so the
+ * simulation is bit-identical across builds (replays).
  */
 class PongGame : public GameBase {
 private:
@@ -29,36 +32,41 @@ private:
         static int16_t axisY(T*, ...) { return 0; }
     };
 
-    static inline float clampf(float v, float lo, float hi) { return (v < lo) ? lo : (v > hi) ? hi : v; }
-    static inline float deadzone01(float v, float dz) {
-        const float a = fabsf(v);
-        if (a <= dz) return 0.0f;
-        const float s = (a - dz) / (1.0f - dz);
+    typedef Fixed::q16 q16;
+    static constexpr q16 ONE = Fixed::ONE;
+
+    static inline q16 deadzone01(q16 v, q16 dz) {
+        const q16 a = Fixed::absVal(v);
+        if (a <= dz) return 0;
+        const q16 s = Fixed::div(a - dz, ONE - dz);
         return (v < 0) ? -s : s;
     }
 
     // Paddle structure
     struct Paddle {
         int x;
-        float y;
+        q16 y;
         int width;
         int height;
         int score;
         uint16_t color;
         
         Paddle(int xPos, int yPos, int w, int h, uint16_t c) 
-            : x(xPos), y((float)yPos), width(w), height(h), score(0), color(c) {}
+            : x(xPos), y(Fixed::fromInt(yPos)), width(w), height(h), score(0), color(c) {}
+
+        q16 centerY() const { return y + Fixed::fromInt(height) / 2; }
+        q16 maxY() const { return Fixed::fromInt(PANEL_RES_Y - height); }
     };
     
     // Ball structure
     struct Ball {
-        float x;
-        float y;
-        float vx;
-        float vy;
+        q16 x;
+        q16 y;
+        q16 vx;
+        q16 vy;
         uint16_t color;
         
-        Ball() : x(32.0f), y(32.0f), vx(1.5f), vy(1.0f), color(COLOR_WHITE) {}
+        Ball() : x(Fixed::fromInt(32)), y(Fixed::fromInt(32)), vx(Fixed::fromFloat(1.5f)), vy(ONE), color(COLOR_WHITE) {}
     };
     
     Paddle leftPaddle;
@@ -66,24 +74,39 @@ private:
     Ball ball;
     bool gameOver;
     bool twoPlayer;
-    unsigned long lastUpdate;
     static constexpr int UPDATE_INTERVAL_MS = PongGameConfig::UPDATE_INTERVAL_MS;  // ~60 FPS
 
+    // Positions at the start of the current step (render interpolation, see drawInterpolated()).
+    q16 prevBallX = Fixed::fromInt(32);
+    q16 prevBallY = Fixed::fromInt(32);
+    q16 prevLeftY = 0;
+    q16 prevRightY = 0;
+
+    inline void snapPrevPositions() {
+        prevBallX = ball.x;
+        prevBallY = ball.y;
+        prevLeftY = leftPaddle.y;
+        prevRightY = rightPaddle.y;
+    }
+
     // Gameplay tuning
     static constexpr int BALL_SIZE_PX = PongGameConfig::BALL_SIZE_PX;            // drawn size (minimum 2x2 as requested)
-    static constexpr float BALL_HALF = PongGameConfig::BALL_HALF;                // half-size for collision checks (center-based)
-    static inline float ballStartSpeed() { return PongGameConfig::ballStartSpeed(); } // slower start speed
-    static inline float ballMaxSpeed() { return PongGameConfig::ballMaxSpeed(); }     // cap to keep it playable on 64x64
-    static constexpr float PLAYER_SPEED = PongGameConfig::PLAYER_SPEED;          // px per tick at full stick
-    static constexpr float STICK_DEADZONE = PongGameConfig::STICK_DEADZONE;      // 0..1
+    static constexpr q16 BALL_HALF = PongGameConfig::BALL_HALF;                  // half-size for collision checks (center-based)
+    static inline q16 ballStartSpeed() { return PongGameConfig::ballStartSpeed(); } // slower start speed
+    static inline q16 ballMaxSpeed() { return PongGameConfig::ballMaxSpeed(); }     // cap to keep it playable on 64x64
+    static constexpr q16 PLAYER_SPEED = PongGameConfig::PLAYER_SPEED;            // px per tick at full stick
+    static constexpr q16 STICK_DEADZONE = PongGameConfig::STICK_DEADZONE;        // 0..1
     static constexpr int16_t AXIS_DIVISOR = PongGameConfig::AXIS_DIVISOR;        // Bluepad32 commonly ~[-512..512]
 
     // CPU difficulty (intentionally beatable)
-    static constexpr uint16_t AI_THINK_MS = PongGameConfig::AI_THINK_MS;         // reaction delay
-    static constexpr float AI_SPEED = PongGameConfig::AI_SPEED;                  // slower than player
+    static constexpr uint16_t AI_REACTION_MS = PongGameConfig::AI_REACTION_MS;   // reaction delay
+    static constexpr q16 AI_SPEED = PongGameConfig::AI_SPEED;                    // slower than player
     static constexpr int AI_ERROR_PX = PongGameConfig::AI_ERROR_PX;              // aim error range (+/-)
-    uint32_t lastAiThinkMs = 0;
-    float aiAimY = 32.0f;
+    static constexpr int AI_ERROR_PER_BOUNCE_PX = PongGameConfig::AI_ERROR_PER_BOUNCE_PX;
+    q16 aiAimY = Fixed::fromInt(32);        // where the CPU paddle center is heading
+    q16 aiPendingAimY = Fixed::fromInt(32); // latest plan, taken over at aiReactAtMs
+    q16 aiErrorY = 0;                       // prediction error for the current approach
+    uint32_t aiReactAtMs = 0;
 
     // Round flow: visual feedback + countdown between points (and on start).
     enum RoundPhase : uint8_t { PHASE_COUNTDOWN, PHASE_PLAYING, PHASE_POINT_FLASH };
@@ -137,51 +160,97 @@ private:
      * Reset ball to center with random direction
      */
     void resetBall(int serveDir /* -1 left, +1 right */) {
-        ball.x = PANEL_RES_X / 2.0f;
-        ball.y = PANEL_RES_Y / 2.0f;
+        ball.x = Fixed::fromInt(PANEL_RES_X) / 2;
+        ball.y = Fixed::fromInt(PANEL_RES_Y) / 2;
         ball.vx = (serveDir >= 0) ? ballStartSpeed() : -ballStartSpeed();
-        ball.vy = (random(-100, 100) / 100.0f) * 0.55f;
+        ball.vy = Fixed::mul(Fixed::ratio(random(-100, 100), 100), Fixed::fromFloat(0.55f));
+        // Teleport: don't interpolate from the old position.
+        snapPrevPositions();
     }
     
     /**
      * Check collision between ball and paddle
      */
     bool checkPaddleCollision(const Paddle& paddle) {
-        if (ball.x + BALL_HALF >= paddle.x &&
-            ball.x - BALL_HALF <= paddle.x + paddle.width &&
+        if (ball.x + BALL_HALF >= Fixed::fromInt(paddle.x) &&
+            ball.x - BALL_HALF <= Fixed::fromInt(paddle.x + paddle.width) &&
             ball.y + BALL_HALF >= paddle.y &&
-            ball.y - BALL_HALF <= paddle.y + paddle.height) {
+            ball.y - BALL_HALF <= paddle.y + Fixed::fromInt(paddle.height)) {
             return true;
         }
         return false;
     }
     
+    // Paddle "english": vy gained per pixel of hit offset from the paddle center.
+    static constexpr q16 PADDLE_SPIN = Fixed::fromFloat(0.09f);
+
+    /** Keep the ball's speed within [start, max] after a paddle hit (direction unchanged). */
+    void clampBallSpeed() {
+        const Fixed::Vec2 v = Fixed::clampLength(Fixed::Vec2{ ball.vx, ball.vy }, ballStartSpeed(), ballMaxSpeed());
+        ball.vx = v.x;
+        ball.vy = v.y;
+    }
+
+    /**
+     * Ball center y when it reaches the CPU paddle's contact x, in closed form: the
+     * straight path is unfolded (y + vy * ticks) and folded back into the band between
+     * the top / bottom bounce lines (period = 2 x band height). `bounces` = wall
+     * reflections on the way.
+     */
+    q16 predictBallYAtCpu(uint8_t& bounces) const {
+        bounces = 0;
+        const q16 lo = BALL_HALF;
+        const q16 span = Fixed::fromInt(PANEL_RES_Y) - 2 * BALL_HALF;
+        const q16 contactX = Fixed::fromInt(rightPaddle.x) - BALL_HALF;
+        if (ball.vx <= 0 || span <= 0 || ball.x >= contactX) return ball.y;
+
+        const q16 ticks = Fixed::div(contactX - ball.x, ball.vx);
+        const int64_t u = (int64_t)(ball.y - lo) + (((int64_t)ball.vy * ticks) >> Fixed::SHIFT);
+        const int64_t period = 2 * (int64_t)span;
+        int64_t m = u % period;
+        if (m < 0) m += period;
+        const int64_t folds = (u >= 0) ? (u / span) : ((span - 1 - u) / span);
+        bounces = (uint8_t)((folds > 255) ? 255 : folds);
+        return lo + (q16)((m <= span) ? m : (period - m));
+    }
+
+    /**
+     * Re-plan the CPU paddle. Runs on ball events only (serve, paddle hit, wall bounce),
+     * not per tick. `newApproach` (serve / paddle hit) draws a fresh error, larger with
+     * every wall bounce ahead, and restarts the reaction delay; wall bounces only refine
+     * the prediction for the approach already running.
+     */
+    void planAI(uint32_t now, bool newApproach) {
+        if (twoPlayer) return;
+        if (ball.vx > 0) {
+            uint8_t bounces = 0;
+            const q16 hitY = predictBallYAtCpu(bounces);
+            if (newApproach) {
+                const int err = AI_ERROR_PX + AI_ERROR_PER_BOUNCE_PX * bounces;
+                aiErrorY = Fixed::fromInt(random(-err, err + 1));
+            }
+            aiPendingAimY = hitY + aiErrorY;
+        } else if (newApproach) {
+            // When ball moves away, drift to center with slight wobble.
+            aiPendingAimY = Fixed::fromInt(PANEL_RES_Y) / 2 + Fixed::fromInt(random(-2, 3));
+        }
+        if (newApproach) aiReactAtMs = now + AI_REACTION_MS;
+    }
+
     /**
-     * Update AI paddle (right paddle in single player mode)
+     * Update AI paddle (right paddle in single player mode): head for the planned point
+     * once the reaction delay has passed.
      */
     void updateAI(uint32_t now) {
         if (!twoPlayer) {
-            // Beatable CPU:
-            // - Only "thinks" every AI_THINK_MS (reaction delay)
-            // - Adds aiming error so it sometimes misses
-            // - Tracks the ball mainly when it is moving towards the CPU
-            if ((uint32_t)(now - lastAiThinkMs) >= AI_THINK_MS) {
-                lastAiThinkMs = now;
-
-                const float centerY = rightPaddle.y + rightPaddle.height / 2.0f;
-                if (ball.vx > 0.0f) {
-                    aiAimY = ball.y + (float)random(-AI_ERROR_PX, AI_ERROR_PX + 1);
-                } else {
-                    // When ball moves away, drift to center with slight wobble.
-                    aiAimY = (PANEL_RES_Y / 2.0f) + (float)random(-2, 3);
-                }
+            if ((int32_t)(now - aiReactAtMs) >= 0) aiAimY = aiPendingAimY;
 
-                const float dead = 1.2f;
-                if (aiAimY < centerY - dead) rightPaddle.y -= AI_SPEED;
-                else if (aiAimY > centerY + dead) rightPaddle.y += AI_SPEED;
-            }
+            const q16 centerY = rightPaddle.centerY();
+            const q16 dead = Fixed::fromFloat(1.2f);
+            if (aiAimY < centerY - dead) rightPaddle.y -= AI_SPEED;
+            else if (aiAimY > centerY + dead) rightPaddle.y += AI_SPEED;
 
-            rightPaddle.y = clampf(rightPaddle.y, 0.0f, (float)(PANEL_RES_Y - rightPaddle.height));
+            rightPaddle.y = Fixed::clamp(rightPaddle.y, 0, rightPaddle.maxY());
         }
     }
 
@@ -190,20 +259,20 @@ public:
         : leftPaddle(2, PANEL_RES_Y / 2 - 6, 1, 12, COLOR_GREEN),
           rightPaddle(PANEL_RES_X - 3, PANEL_RES_Y / 2 - 6, 1, 12, COLOR_CYAN),
           gameOver(false),
-          twoPlayer(false),
-          lastUpdate(0) {
+          twoPlayer(false) {
         resetBall(1);
     }
 
     void start() override {
         gameOver = false;
-        lastUpdate = millis();
         lastWallSfxMs = 0;
         lastPaddleSfxMs = 0;
-        lastAiThinkMs = 0;
-        aiAimY = PANEL_RES_Y / 2.0f;
+        aiAimY = Fixed::fromInt(PANEL_RES_Y) / 2;
+        aiPendingAimY = aiAimY;
+        aiErrorY = 0;
+        aiReactAtMs = 0;
         phase = PHASE_COUNTDOWN;
-        phaseStartMs = lastUpdate;
+        phaseStartMs = millis();
         lastPointWinner = 0;
         
         // Determine if two players based on connected controllers
@@ -215,8 +284,8 @@ public:
         // Reset scores and positions
         leftPaddle.score = 0;
         rightPaddle.score = 0;
-        leftPaddle.y = (float)(PANEL_RES_Y / 2 - leftPaddle.height / 2);
-        rightPaddle.y = (float)(PANEL_RES_Y / 2 - rightPaddle.height / 2);
+        leftPaddle.y = Fixed::fromInt(PANEL_RES_Y / 2 - leftPaddle.height / 2);
+        rightPaddle.y = Fixed::fromInt(PANEL_RES_Y / 2 - rightPaddle.height / 2);
         
         // Countdown on start, then serve to the right.
         resetBall(+1);
@@ -226,13 +295,13 @@ public:
         start();
     }
 
-    void update(ControllerManager* input) override {
+    uint16_t fixedStepMs() const override { return (uint16_t)UPDATE_INTERVAL_MS; }
+
+    void step(ControllerManager* input, uint32_t now, uint16_t dtMs) override {
+        (void)dtMs;
         if (gameOver) return;
-        
-        // Throttle updates for smooth gameplay
-        const unsigned long now = millis();
-        if (now - lastUpdate < UPDATE_INTERVAL_MS) return;
-        lastUpdate = now;
+
+        snapPrevPositions();
 
         // -----------------------------------------------------
         // Round phases (flash -> countdown -> play)
@@ -251,6 +320,7 @@ public:
             if ((uint32_t)(now - phaseStartMs) >= COUNTDOWN_MS) {
                 phase = PHASE_PLAYING;
                 phaseStartMs = now;
+                planAI((uint32_t)now, true);
             }
             // Still allow paddle movement during countdown.
         }
@@ -258,34 +328,34 @@ public:
         // Update left paddle (Player 1) - analog stick (fallback to dpad)
         ControllerPtr p1 = input->getController(0);
         if (p1 && p1->isConnected()) {
-            const float raw = clampf((float)InputDetail::axisY(p1, 0) / (float)AXIS_DIVISOR, -1.0f, 1.0f);
-            float sy = deadzone01(raw, STICK_DEADZONE);
+            const q16 raw = Fixed::clamp(Fixed::ratio(InputDetail::axisY(p1, 0), AXIS_DIVISOR), -ONE, ONE);
+            q16 sy = deadzone01(raw, STICK_DEADZONE);
 
-            if (sy == 0.0f) {
+            if (sy == 0) {
                 const uint8_t dpad = p1->dpad();
-                if (dpad & 0x01) sy = -1.0f; // UP
-                else if (dpad & 0x02) sy = 1.0f; // DOWN
+                if (dpad & 0x01) sy = -ONE; // UP
+                else if (dpad & 0x02) sy = ONE; // DOWN
             }
 
-            leftPaddle.y += sy * PLAYER_SPEED;
-            leftPaddle.y = clampf(leftPaddle.y, 0.0f, (float)(PANEL_RES_Y - leftPaddle.height));
+            leftPaddle.y += Fixed::mul(sy, PLAYER_SPEED);
+            leftPaddle.y = Fixed::clamp(leftPaddle.y, 0, leftPaddle.maxY());
         }
         
         // Update right paddle (Player 2 or AI) - analog stick for player 2
         if (twoPlayer) {
             ControllerPtr p2 = input->getController(1);
             if (p2 && p2->isConnected()) {
-                const float raw = clampf((float)InputDetail::axisY(p2, 0) / (float)AXIS_DIVISOR, -1.0f, 1.0f);
-                float sy = deadzone01(raw, STICK_DEADZONE);
+                const q16 raw = Fixed::clamp(Fixed::ratio(InputDetail::axisY(p2, 0), AXIS_DIVISOR), -ONE, ONE);
+                q16 sy = deadzone01(raw, STICK_DEADZONE);
 
-                if (sy == 0.0f) {
+                if (sy == 0) {
                     const uint8_t dpad = p2->dpad();
-                    if (dpad & 0x01) sy = -1.0f; // UP
-                    else if (dpad & 0x02) sy = 1.0f; // DOWN
+                    if (dpad & 0x01) sy = -ONE; // UP
+                    else if (dpad & 0x02) sy = ONE; // DOWN
                 }
 
-                rightPaddle.y += sy * PLAYER_SPEED;
-                rightPaddle.y = clampf(rightPaddle.y, 0.0f, (float)(PANEL_RES_Y - rightPaddle.height));
+                rightPaddle.y += Fixed::mul(sy, PLAYER_SPEED);
+                rightPaddle.y = Fixed::clamp(rightPaddle.y, 0, rightPaddle.maxY());
             }
         } else {
             updateAI((uint32_t)now);
@@ -299,39 +369,30 @@ public:
         ball.y += ball.vy;
         
         // Ball collision with top/bottom walls
-        if (ball.y - BALL_HALF <= 0 || ball.y + BALL_HALF >= PANEL_RES_Y) {
+        if (ball.y - BALL_HALF <= 0 || ball.y + BALL_HALF >= Fixed::fromInt(PANEL_RES_Y)) {
             ball.vy = -ball.vy;
-            ball.y = constrain(ball.y, BALL_HALF, PANEL_RES_Y - BALL_HALF);
+            ball.y = Fixed::clamp(ball.y, BALL_HALF, Fixed::fromInt(PANEL_RES_Y) - BALL_HALF);
             sfxWallHit((uint32_t)now);
+            planAI((uint32_t)now, false);
         }
         
         // Ball collision with paddles
         if (checkPaddleCollision(leftPaddle)) {
-            ball.vx = abs(ball.vx);  // Ensure ball goes right
-            ball.vy += (ball.y - (leftPaddle.y + leftPaddle.height / 2.0f)) * 0.09f;
-            ball.x = leftPaddle.x + leftPaddle.width + BALL_HALF;
+            ball.vx = Fixed::absVal(ball.vx);  // Ensure ball goes right
+            ball.vy += Fixed::mul(ball.y - leftPaddle.centerY(), PADDLE_SPIN);
+            ball.x = Fixed::fromInt(leftPaddle.x + leftPaddle.width) + BALL_HALF;
             sfxPaddleHit((uint32_t)now);
-            // Normalize velocity
-            float speed = sqrt(ball.vx * ball.vx + ball.vy * ball.vy);
-            if (speed > 0) {
-                float target = clampf(speed, ballStartSpeed(), ballMaxSpeed());
-                ball.vx = (ball.vx / speed) * target;
-                ball.vy = (ball.vy / speed) * target;
-            }
+            clampBallSpeed();
+            planAI((uint32_t)now, true);
         }
         
         if (checkPaddleCollision(rightPaddle)) {
-            ball.vx = -abs(ball.vx);  // Ensure ball goes left
-            ball.vy += (ball.y - (rightPaddle.y + rightPaddle.height / 2.0f)) * 0.09f;
-            ball.x = rightPaddle.x - BALL_HALF;
+            ball.vx = -Fixed::absVal(ball.vx);  // Ensure ball goes left
+            ball.vy += Fixed::mul(ball.y - rightPaddle.centerY(), PADDLE_SPIN);
+            ball.x = Fixed::fromInt(rightPaddle.x) - BALL_HALF;
             sfxPaddleHit((uint32_t)now);
-            // Normalize velocity
-            float speed = sqrt(ball.vx * ball.vx + ball.vy * ball.vy);
-            if (speed > 0) {
-                float target = clampf(speed, ballStartSpeed(), ballMaxSpeed());
-                ball.vx = (ball.vx / speed) * target;
-                ball.vy = (ball.vy / speed) * target;
-            }
+            clampBallSpeed();
+            planAI((uint32_t)now, true);
         }
         
         // Score points
@@ -346,7 +407,7 @@ public:
                 phaseStartMs = now;
                 sfxScore();
             }
-        } else if (ball.x > PANEL_RES_X + BALL_HALF) {
+        } else if (ball.x > Fixed::fromInt(PANEL_RES_X) + BALL_HALF) {
             leftPaddle.score++;
             if (leftPaddle.score >= 5) {
                 gameOver = true;
@@ -361,6 +422,22 @@ public:
     }
 
     void draw(MatrixPanel_I2S_DMA* display) override {
+        drawInterpolated(display, 1.0f);
+    }
+
+    /**
+     * Ball and paddles are drawn between their previous and current step positions
+     * (alpha from the engine's fixed-step clock), so motion stays smooth even when the
+     * render rate doesn't divide the 60 Hz simulation rate.
+     */
+    void drawInterpolated(MatrixPanel_I2S_DMA* display, float alpha) override {
+        // Render-only: alpha comes from the engine clock, the simulation never sees it.
+        const q16 t = Fixed::fromFloat(alpha);
+        const int ballX = Fixed::toInt(Fixed::lerp(prevBallX, ball.x, t));
+        const int ballY = Fixed::toInt(Fixed::lerp(prevBallY, ball.y, t));
+        const int leftY = Fixed::toInt(Fixed::lerp(prevLeftY, leftPaddle.y, t));
+        const int rightY = Fixed::toInt(Fixed::lerp(prevRightY, rightPaddle.y, t));
+
         display->fillScreen(COLOR_BLACK);
         
         if (gameOver) {
@@ -377,11 +454,11 @@ public:
 
         // HUD
         if (twoPlayer) {
-            SmallFont::drawStringF(display, 2, 6, leftPaddle.color, "P1:%d", leftPaddle.score);
-            SmallFont::drawStringF(display, 38, 6, rightPaddle.color, "P2:%d", rightPaddle.score);
+            SmallFont::drawValue(display, 2, 6, leftPaddle.color, "P1:", leftPaddle.score);
+            SmallFont::drawValue(display, 38, 6, rightPaddle.color, "P2:", rightPaddle.score);
         } else {
-            SmallFont::drawStringF(display, 2, 6, leftPaddle.color, "P1:%d", leftPaddle.score);
-            SmallFont::drawStringF(display, 38, 6, COLOR_CYAN, "CPU:%d", rightPaddle.score);
+            SmallFont::drawValue(display, 2, 6, leftPaddle.color, "P1:", leftPaddle.score);
+            SmallFont::drawValue(display, 38, 6, COLOR_CYAN, "CPU:", rightPaddle.score);
         }
         
         // Draw center line
@@ -392,7 +469,7 @@ public:
         // Draw paddles
         display->fillRect(
             leftPaddle.x, 
-            (int)leftPaddle.y, 
+            leftY, 
             leftPaddle.width, 
             leftPaddle.height, 
             leftPaddle.color
@@ -400,7 +477,7 @@ public:
         
         display->fillRect(
             rightPaddle.x, 
-            (int)rightPaddle.y, 
+            rightY, 
             rightPaddle.width, 
             rightPaddle.height, 
             rightPaddle.color
@@ -428,12 +505,12 @@ public:
             char c[2] = { (char)('0' + secsLeft), '\0' };
             SmallFont::drawString(display, 30, 30, c, COLOR_YELLOW);
             // Draw the ball in its serve position so the player sees where it'll start.
-            display->fillRect((int)ball.x - 1, (int)ball.y - 1, BALL_SIZE_PX, BALL_SIZE_PX, ball.color);
+            display->fillRect(ballX - 1, ballY - 1, BALL_SIZE_PX, BALL_SIZE_PX, ball.color);
             return;
         }
 
         // Draw ball (2x2)
-        display->fillRect((int)ball.x - 1, (int)ball.y - 1, BALL_SIZE_PX, BALL_SIZE_PX, ball.color);
+        display->fillRect(ballX - 1, ballY - 1, BALL_SIZE_PX, BALL_SIZE_PX, ball.color);
     }
 
     bool isGameOver() override {
@@ -9,27 +9,30 @@
 #pragma once
 
 #include <Arduino.h>
+#include "../../engine/FixedPoint.h"
 
 namespace PongGameConfig {
 
 // Main logic tick (~60fps).
 static constexpr uint16_t UPDATE_INTERVAL_MS = 16;
 
-// Ball
+// Ball (speeds / sizes are Q16.16 fixed point, see engine/FixedPoint.h)
 static constexpr int BALL_SIZE_PX = 2;     // drawn size (minimum 2x2 as requested)
-static constexpr float BALL_HALF = 1.0f;   // half-size for collision checks (center-based)
-static inline constexpr float ballStartSpeed() { return 0.95f; } // slower start speed
-static inline constexpr float ballMaxSpeed() { return 1.35f; }   // cap to keep playable on 64x64
+static constexpr Fixed::q16 BALL_HALF = Fixed::fromFloat(1.0f);   // half-size for collision checks (center-based)
+static inline constexpr Fixed::q16 ballStartSpeed() { return Fixed::fromFloat(0.95f); } // slower start speed
+static inline constexpr Fixed::q16 ballMaxSpeed() { return Fixed::fromFloat(1.35f); }   // cap to keep playable on 64x64
 
 // Player input
-static constexpr float PLAYER_SPEED = 2.4f;    // px per tick at full stick
-static constexpr float STICK_DEADZONE = 0.18f; // 0..1
+static constexpr Fixed::q16 PLAYER_SPEED = Fixed::fromFloat(2.4f);    // px per tick at full stick
+static constexpr Fixed::q16 STICK_DEADZONE = Fixed::fromFloat(0.18f); // 0..1
 static constexpr int16_t AXIS_DIVISOR = 512;   // Bluepad32 commonly ~[-512..512]
 
-// CPU difficulty (intentionally beatable)
-static constexpr uint16_t AI_THINK_MS = 70; // reaction delay
-static constexpr float AI_SPEED = 1.4f;     // slower than player
-static constexpr int AI_ERROR_PX = 7;       // aim error range (+/-)
+// CPU difficulty (intentionally beatable). The CPU predicts where the ball meets its
+// paddle; difficulty is how wrong that prediction is and how late it reacts.
+static constexpr uint16_t AI_REACTION_MS = 120;                 // delay before acting on a new prediction
+static constexpr Fixed::q16 AI_SPEED = Fixed::fromFloat(0.32f); // px per tick (slower than player)
+static constexpr int AI_ERROR_PX = 5;                           // aim error range (+/-)
+static constexpr int AI_ERROR_PER_BOUNCE_PX = 3;                // extra error per wall bounce still ahead
 
 // Round flow
 static constexpr uint16_t POINT_FLASH_MS = 450;
@@ -5,6 +5,9 @@
 #include "../../engine/ControllerManager.h"
 #include "../../engine/config.h"
 #include "../../engine/AudioManager.h"
+#include "../../engine/ParticleSystem.h"
+#include "../../engine/Pool.h"
+#include "../../engine/SpatialGrid.h"
 #include "../../component/SmallFont.h"
 #include "../../engine/Settings.h"
 #include "../../engine/UserProfiles.h"
@@ -148,18 +151,17 @@ private:
         float y;
         float vx;      // px per tick
         float vy;      // px per tick
-        bool active;
         uint16_t color; // base color for head
         uint8_t dmg;    // damage dealt on hit
     };
 
+    // Powerup packs move in Q16.16 fixed point (engine/FixedPoint.h).
     struct PowerUp {
-        float x;
-        float y;
+        Fixed::q16 x;
+        Fixed::q16 y;
         uint8_t type;   // 0=shield(blue), 1=weapon(red), 2=life(green), 3=rockets(purple)
-        bool active;
-        float vx;
-        float vy;
+        Fixed::q16 vx;
+        Fixed::q16 vy;
         uint8_t tier;   // 1..5 for red/blue, unused for green
     };
     
@@ -169,15 +171,14 @@ private:
         float y;
         float vx;
         float vy;
-        bool alive;
         int type;            // 0..3
         uint32_t nextShotMs; // per-enemy firing timer
         uint8_t hp;          // current health 1..4
         uint8_t maxHp;       // max health for pips
         
-        Enemy() : x(0), y(0), vx(0), vy(0), alive(false), type(0), nextShotMs(0), hp(1), maxHp(1) {}
+        Enemy() : x(0), y(0), vx(0), vy(0), type(0), nextShotMs(0), hp(1), maxHp(1) {}
         Enemy(float xPos, float yPos, int t, float vxIn, float vyIn, uint32_t now) 
-            : x(xPos), y(yPos), vx(vxIn), vy(vyIn), alive(true), type(t), nextShotMs(now), hp(1), maxHp(1) {}
+            : x(xPos), y(yPos), vx(vxIn), vy(vyIn), type(t), nextShotMs(now), hp(1), maxHp(1) {}
     };
 
     // ---------------------------------------------------------
@@ -224,7 +225,6 @@ private:
 
     // Boss projectiles
     struct StarShot {
-        bool active = false;
         float x = 0.0f;
         float y = 0.0f;
         float vx = 0.0f;
@@ -232,7 +232,6 @@ private:
         uint32_t startMs = 0;
     };
     struct Rocket {
-        bool active = false;
         float x = 0.0f;
         float y = 0.0f;
         float vx = 0.0f;
@@ -243,12 +242,12 @@ private:
 
     static constexpr int MAX_STAR_SHOTS = ShooterGameConfig::MAX_STAR_SHOTS;
     static constexpr int MAX_ROCKETS = ShooterGameConfig::MAX_ROCKETS;
-    StarShot starShots[MAX_STAR_SHOTS] = {};
-    Rocket rockets[MAX_ROCKETS] = {};
+    Pool<StarShot, MAX_STAR_SHOTS> starShots;
+    Pool<Rocket, MAX_ROCKETS> rockets;
 
     // Player guided rockets (from purple powerup): max 2.
     static constexpr int MAX_PLAYER_ROCKETS = ShooterGameConfig::MAX_PLAYER_ROCKETS;
-    Rocket playerRockets[MAX_PLAYER_ROCKETS] = {};
+    Pool<Rocket, MAX_PLAYER_ROCKETS> playerRockets;
 
     // ---------------------------------------------------------
     // Background clouds (2-layer parallax)
@@ -268,16 +267,22 @@ private:
     
     Ship player;
 
-    // Avoid heap churn: keep fixed-size pools for bullets and powerups.
+    // Avoid heap churn: fixed-size pools (engine/Pool.h) for bullets, enemies and powerups.
+    // Loops walk the live entries backwards so the current one can be released in place.
     static constexpr int MAX_PLAYER_BULLETS = ShooterGameConfig::MAX_PLAYER_BULLETS;
     static constexpr int MAX_ENEMY_BULLETS  = ShooterGameConfig::MAX_ENEMY_BULLETS;
     static constexpr int MAX_ENEMIES        = ShooterGameConfig::MAX_ENEMIES;
     static constexpr int MAX_POWERUPS       = ShooterGameConfig::MAX_POWERUPS;
 
-    Bullet playerBullets[MAX_PLAYER_BULLETS] = {};
-    Bullet enemyBullets[MAX_ENEMY_BULLETS] = {};
-    Enemy enemies[MAX_ENEMIES] = {};
-    PowerUp powerups[MAX_POWERUPS] = {};
+    Pool<Bullet, MAX_PLAYER_BULLETS> playerBullets;
+    Pool<Bullet, MAX_ENEMY_BULLETS> enemyBullets;
+    Pool<Enemy, MAX_ENEMIES> enemies;
+    Pool<PowerUp, MAX_POWERUPS> powerups;
+
+    // Collision broadphase: enemy boxes by pool slot in 8x8 px cells (see handleCollisions()).
+    typedef SpatialGrid<3> EnemyGrid;
+    static_assert(MAX_ENEMIES <= EnemyGrid::MAX_ITEMS, "enemy slots must fit the grid masks");
+    EnemyGrid enemyGrid;
 
     bool gameOver;
     int score;
@@ -383,69 +388,35 @@ private:
     // ---------------------------------------------------------
     // Particle FX (Breakout-style sparkle bursts; cheap and fun)
     // ---------------------------------------------------------
-    struct Particle {
-        bool active;
-        float x;
-        float y;
-        float vx;
-        float vy;
-        uint16_t color;
-        uint32_t endMs;
-    };
-    static constexpr int MAX_PARTICLES = ShooterGameConfig::MAX_PARTICLES;
-    Particle particles[MAX_PARTICLES] = {};
+    static constexpr uint16_t MAX_PARTICLES = ShooterGameConfig::MAX_PARTICLES;
+    typedef ParticleSystem<MAX_PARTICLES> Particles;
 
-    void clearParticles() {
-        for (int i = 0; i < MAX_PARTICLES; i++) particles[i].active = false;
+    static Particles::Params particleParams() {
+        Particles::Params p;
+        p.drag = Fixed::fromFloat(0.97f);
+        p.gravity = Fixed::fromFloat(0.018f); // mild gravity
+        return p;
     }
+    Particles particles{ particleParams() };
+
+    void clearParticles() { particles.clear(); }
 
     void spawnParticles(float x, float y, uint16_t color, uint8_t count, uint32_t now) {
         // Keep it modest: looks good on 64×64 without being too heavy.
         const uint8_t tuned = max<uint8_t>(1, (uint8_t)(count / 2));
-        for (uint8_t n = 0; n < tuned; n++) {
-            int slot = -1;
-            for (int i = 0; i < MAX_PARTICLES; i++) {
-                if (!particles[i].active) { slot = i; break; }
-            }
-            if (slot < 0) return;
-            Particle& p = particles[slot];
-            p.active = true;
-            p.x = x;
-            p.y = y;
+        const Fixed::q16 fx = Fixed::fromFloat(x);
+        const Fixed::q16 fy = Fixed::fromFloat(y);
+        for (uint8_t n = 0; n < tuned && !particles.full(); n++) {
             // Strong sideways variety, mild upward kick (looks like debris).
-            p.vx = ((float)random(-100, 101) / 100.0f) * 0.75f;
-            p.vy = ((float)random(-90, 41) / 100.0f) * 0.65f;
-            p.color = color;
-            p.endMs = now + (uint32_t)random(240, 560);
+            const Fixed::q16 vx = Fixed::mul(Fixed::ratio(random(-100, 101), 100), Fixed::fromFloat(0.75f));
+            const Fixed::q16 vy = Fixed::mul(Fixed::ratio(random(-90, 41), 100), Fixed::fromFloat(0.65f));
+            particles.spawn(fx, fy, vx, vy, color, now + (uint32_t)random(240, 560));
         }
     }
 
-    void updateParticles(uint32_t now) {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) continue;
-            if ((int32_t)(particles[i].endMs - now) <= 0) {
-                particles[i].active = false;
-                continue;
-            }
-            particles[i].x += particles[i].vx;
-            particles[i].y += particles[i].vy;
-            particles[i].vx *= 0.97f;
-            particles[i].vy *= 0.97f;
-            particles[i].vy += 0.018f; // mild gravity
-        }
-    }
+    void updateParticles(uint32_t now) { particles.update(now); }
 
-    void drawParticles(MatrixPanel_I2S_DMA* display, uint32_t now) {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) continue;
-            const uint32_t age = (uint32_t)(now - (particles[i].endMs - 560)); // rough age baseline
-            (void)age;
-            const int x = (int)particles[i].x;
-            const int y = (int)particles[i].y;
-            if (x < 0 || x >= PANEL_RES_X || y < 0 || y >= PANEL_RES_Y) continue;
-            display->drawPixel(x, y, particles[i].color);
-        }
-    }
+    void drawParticles(MatrixPanel_I2S_DMA* display, uint32_t now) { particles.draw(display, now); }
 
     void spawnExplosion(int x, int y, uint16_t color, uint32_t now) {
         for (int i = 0; i < MAX_EXPLOSIONS; i++) {
@@ -564,18 +535,39 @@ private:
     }
 
     void clearBullets() {
-        for (int i = 0; i < MAX_PLAYER_BULLETS; i++) playerBullets[i].active = false;
-        for (int i = 0; i < MAX_ENEMY_BULLETS; i++) enemyBullets[i].active = false;
+        playerBullets.clear();
+        enemyBullets.clear();
     }
 
     void clearPowerups() {
-        for (int i = 0; i < MAX_POWERUPS; i++) powerups[i].active = false;
+        powerups.clear();
     }
 
     void clearBossProjectiles() {
-        for (int i = 0; i < MAX_STAR_SHOTS; i++) starShots[i].active = false;
-        for (int i = 0; i < MAX_ROCKETS; i++) rockets[i].active = false;
-        for (int i = 0; i < MAX_PLAYER_ROCKETS; i++) playerRockets[i].active = false;
+        starShots.clear();
+        rockets.clear();
+        playerRockets.clear();
+    }
+
+    // Pool telemetry (DEBUG_POOLS): peak use / failed spawns per run, logged at game over.
+    void resetPoolStats() {
+        playerBullets.resetStats();
+        enemyBullets.resetStats();
+        enemies.resetStats();
+        powerups.resetStats();
+        starShots.resetStats();
+        rockets.resetStats();
+        playerRockets.resetStats();
+    }
+
+    void logPoolStats() const {
+        playerBullets.logStats("Shooter.playerBullets");
+        enemyBullets.logStats("Shooter.enemyBullets");
+        enemies.logStats("Shooter.enemies");
+        powerups.logStats("Shooter.powerups");
+        starShots.logStats("Shooter.starShots");
+        rockets.logStats("Shooter.rockets");
+        playerRockets.logStats("Shooter.playerRockets");
     }
 
     void startBossDeath(uint32_t now) {
@@ -634,19 +626,16 @@ private:
         }
     }
 
-    void spawnPowerupForced(uint8_t type, float x, float y, float kickVx, float kickVy) {
+    void spawnPowerupForced(uint8_t type, Fixed::q16 x, Fixed::q16 y, Fixed::q16 kickVx, Fixed::q16 kickVy) {
         // Direct spawn of a powerup pack (used for boss loot).
-        for (int i = 0; i < MAX_POWERUPS; i++) {
-            if (powerups[i].active) continue;
-            powerups[i].active = true;
-            powerups[i].type = type;
-            powerups[i].x = x;
-            powerups[i].y = y;
-            powerups[i].vx = kickVx;
-            powerups[i].vy = kickVy;
-            powerups[i].tier = 0;
-            return;
-        }
+        PowerUp* p = powerups.acquire();
+        if (!p) return;
+        p->type = type;
+        p->x = x;
+        p->y = y;
+        p->vx = kickVx;
+        p->vy = kickVy;
+        p->tier = 0;
     }
 
     static inline void shuffleU8(uint8_t* a, int n) {
@@ -670,8 +659,8 @@ private:
             // Spawn one of each loot (blue/red/green/purple), but randomize the fan-out so
             // the pattern doesn't look identical every boss kill.
             // type: 0=shield(blue), 1=weapon(red), 2=life(green), 3=rockets(purple)
-            const float x = (float)bossDeathCx;
-            const float y = (float)bossDeathCy;
+            const Fixed::q16 x = Fixed::fromInt(bossDeathCx);
+            const Fixed::q16 y = Fixed::fromInt(bossDeathCy);
 
             // Shuffle loot types so the same item isn't always tied to the same trajectory.
             uint8_t types[4] = { 0, 1, 2, 3 };
@@ -679,27 +668,28 @@ private:
 
             // Build a symmetric set of base X velocities, then shuffle them so the overall
             // pattern varies run-to-run even before jitter.
-            const float s = ShooterGameConfig::BOSS_LOOT_VX_SPREAD;
-            float baseVx[4] = { -s, -0.35f * s, 0.35f * s, s };
+            const Fixed::q16 s = ShooterGameConfig::BOSS_LOOT_VX_SPREAD;
+            const Fixed::q16 inner = Fixed::mul(Fixed::fromFloat(0.35f), s);
+            const Fixed::q16 baseVx[4] = { -s, -inner, inner, s };
             // Shuffle baseVx by shuffling indices (keep code tiny, avoid templates).
             uint8_t idx[4] = { 0, 1, 2, 3 };
             shuffleU8(idx, 4);
 
             for (int i = 0; i < 4; i++) {
                 // Small spawn position jitter so packs don't stack perfectly.
-                const float ox = ((float)random(-100, 101) / 100.0f) * ShooterGameConfig::BOSS_LOOT_POS_JITTER_PX;
-                const float oy = ((float)random(-100, 101) / 100.0f) * ShooterGameConfig::BOSS_LOOT_POS_JITTER_PX;
+                const Fixed::q16 ox = Fixed::mul(Fixed::ratio(random(-100, 101), 100), ShooterGameConfig::BOSS_LOOT_POS_JITTER_PX);
+                const Fixed::q16 oy = Fixed::mul(Fixed::ratio(random(-100, 101), 100), ShooterGameConfig::BOSS_LOOT_POS_JITTER_PX);
 
                 // Randomized kick:
                 // - VX: symmetric fan-out + per-item jitter (clamped to match powerup safety).
                 // - VY: random upward kick within [min..max] plus a tiny jitter.
-                float vx = baseVx[idx[i]] + ((float)random(-100, 101) / 100.0f) * ShooterGameConfig::BOSS_LOOT_VX_JITTER;
-                float vy = ShooterGameConfig::BOSS_LOOT_VY_BASE_MIN +
-                           ((float)random(0, 101) / 100.0f) * (ShooterGameConfig::BOSS_LOOT_VY_BASE_MAX - ShooterGameConfig::BOSS_LOOT_VY_BASE_MIN);
-                vy += ((float)random(-100, 101) / 100.0f) * ShooterGameConfig::BOSS_LOOT_VY_JITTER;
+                Fixed::q16 vx = baseVx[idx[i]] + Fixed::mul(Fixed::ratio(random(-100, 101), 100), ShooterGameConfig::BOSS_LOOT_VX_JITTER);
+                Fixed::q16 vy = ShooterGameConfig::BOSS_LOOT_VY_BASE_MIN +
+                                Fixed::mul(Fixed::ratio(random(0, 101), 100), ShooterGameConfig::BOSS_LOOT_VY_BASE_MAX - ShooterGameConfig::BOSS_LOOT_VY_BASE_MIN);
+                vy += Fixed::mul(Fixed::ratio(random(-100, 101), 100), ShooterGameConfig::BOSS_LOOT_VY_JITTER);
 
-                vx = clampf(vx, -0.85f, 0.85f);
-                vy = clampf(vy, -0.85f, 0.85f);
+                vx = Fixed::clamp(vx, -POWERUP_MAX_V, POWERUP_MAX_V);
+                vy = Fixed::clamp(vy, -POWERUP_MAX_V, POWERUP_MAX_V);
 
                 spawnPowerupForced(types[i], x + ox, y + oy, vx, vy);
             }
@@ -734,9 +724,8 @@ private:
         // If they die, add their points to the score before GAME OVER.
         const int r = (int)ShooterGameConfig::PLAYER_DEATH_AOE_RADIUS_PX;
         const int r2 = r * r;
-        for (int ei = 0; ei < MAX_ENEMIES; ei++) {
+        for (uint16_t ei = enemies.size(); ei-- > 0;) {
             Enemy& e = enemies[ei];
-            if (!e.alive) continue;
 
             const int ex = (int)e.x + (int)(ENEMY_W / 2);
             const int ey = (int)e.y + (int)(ENEMY_H / 2);
@@ -749,11 +738,11 @@ private:
                 e.hp = (uint8_t)(e.hp - dmg);
             } else {
                 e.hp = 0;
-                e.alive = false;
                 kills++;
                 score += 10 + (e.type * 5);
                 spawnExplosion(ex, ey, ShooterGameConfig::ENEMY_COLORS[e.type & 3], now);
                 spawnParticles((float)ex, (float)ey, ShooterGameConfig::ENEMY_COLORS[e.type & 3], 14, now);
+                enemies.release(&e);
             }
         }
     }
@@ -820,18 +809,12 @@ private:
     }
 
     int aliveEnemyCount() const {
-        int c = 0;
-        for (int i = 0; i < MAX_ENEMIES; i++) if (enemies[i].alive) c++;
-        return c;
+        return (int)enemies.size();
     }
     
     void spawnEnemy(uint32_t now) {
-        // Find a free slot.
-        int slot = -1;
-        for (int i = 0; i < MAX_ENEMIES; i++) {
-            if (!enemies[i].alive) { slot = i; break; }
-        }
-        if (slot < 0) return;
+        Enemy* slot = enemies.acquire();
+        if (!slot) return;
 
         // Spawn behavior (requested):
         // Enemies should not "pop" into existence in the playfield. They enter from the top
@@ -848,7 +831,7 @@ private:
         // Advance faster (3x vs previous)
         const float vy = 4.0f * (0.05f + 0.004f * (float)min(12, max(0, level - 1)));
 
-        enemies[slot] = Enemy(x, y, type, vx, vy, now);
+        *slot = Enemy(x, y, type, vx, vy, now);
 
         // Health progression: start with 1HP, increase odds/strength with level.
         // maxHP is 1..4 and is shown as 4 pips above the enemy.
@@ -859,11 +842,11 @@ private:
         if (lvl >= 3 && r < 25) hp = 2;
         if (lvl >= 6 && r < 18) hp = 3;
         if (lvl >= 10 && r < 12) hp = 4;
-        enemies[slot].hp = hp;
-        enemies[slot].maxHp = hp;
+        slot->hp = hp;
+        slot->maxHp = hp;
 
         // Avoid immediate "spawn shot" spikes; feels like difficulty didn't reset.
-        enemies[slot].nextShotMs = now + (uint32_t)random(1200, 3200);
+        slot->nextShotMs = now + (uint32_t)random(1200, 3200);
     }
 
     void spawnBoss(uint32_t now) {
@@ -956,90 +939,76 @@ private:
     // Powerup pack physics (ported from Breakout tuning):
     // - More sideways launch variety, slower gravity
     // - Bounce off walls so packs don't exit the screen
-    static constexpr float POWERUP_GRAVITY = ShooterGameConfig::POWERUP_GRAVITY;
-    static constexpr float POWERUP_DRAG = ShooterGameConfig::POWERUP_DRAG;
-    static constexpr float POWERUP_BOUNCE = ShooterGameConfig::POWERUP_BOUNCE;
+    static constexpr Fixed::q16 POWERUP_GRAVITY = ShooterGameConfig::POWERUP_GRAVITY;
+    static constexpr Fixed::q16 POWERUP_DRAG = ShooterGameConfig::POWERUP_DRAG;
+    static constexpr Fixed::q16 POWERUP_BOUNCE = ShooterGameConfig::POWERUP_BOUNCE;
+    static constexpr Fixed::q16 POWERUP_MAX_V = ShooterGameConfig::POWERUP_MAX_V;
     static constexpr int POWERUP_SIZE_PX = ShooterGameConfig::POWERUP_SIZE_PX; // drawn as 2x2 box
 
     void spawnPlayerBullet(int x, int y, uint16_t color, uint8_t dmg) {
-        for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
-            if (playerBullets[i].active) continue;
-            playerBullets[i].active = true;
-            playerBullets[i].x = (float)x;
-            playerBullets[i].y = (float)y;
-            playerBullets[i].vx = 0.0f;
-            playerBullets[i].vy = -ShooterGameConfig::PLAYER_BULLET_SPEED;
-            // Color/damage are decided by the firing logic so we can support mixed-color spreads.
-            playerBullets[i].color = color;
-            playerBullets[i].dmg = max<uint8_t>(1, dmg);
-            return;
-        }
+        Bullet* b = playerBullets.acquire();
+        if (!b) return;
+        b->x = (float)x;
+        b->y = (float)y;
+        b->vx = 0.0f;
+        b->vy = -ShooterGameConfig::PLAYER_BULLET_SPEED;
+        // Color/damage are decided by the firing logic so we can support mixed-color spreads.
+        b->color = color;
+        b->dmg = max<uint8_t>(1, dmg);
     }
 
     void spawnEnemyBullet(int x, int y, uint8_t type) {
-        for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
-            if (enemyBullets[i].active) continue;
-            enemyBullets[i].active = true;
-            enemyBullets[i].x = (float)x;
-            enemyBullets[i].y = (float)y;
-            // Aim at the player *at fire time* (straight shot, no trajectory changes after spawn).
-            const float tx = player.x + (float)SHIP_W * 0.5f;
-            const float ty = player.y + (float)SHIP_H * 0.5f;
-            const float dx = tx - enemyBullets[i].x;
-            const float dy = ty - enemyBullets[i].y;
-            const float len = sqrtf(dx * dx + dy * dy);
-            const float inv = (len > 0.001f) ? (1.0f / len) : 0.0f;
-            const float s = ShooterGameConfig::ENEMY_BULLET_SPEED; // requested: 2x slower
-            enemyBullets[i].vx = dx * inv * s;
-            enemyBullets[i].vy = dy * inv * s;
-            enemyBullets[i].color = ShooterGameConfig::ENEMY_COLORS[type % 4];
-            enemyBullets[i].dmg = 1;
-            return;
-        }
+        Bullet* b = enemyBullets.acquire();
+        if (!b) return;
+        b->x = (float)x;
+        b->y = (float)y;
+        // Aim at the player *at fire time* (straight shot, no trajectory changes after spawn).
+        const float tx = player.x + (float)SHIP_W * 0.5f;
+        const float ty = player.y + (float)SHIP_H * 0.5f;
+        const float dx = tx - b->x;
+        const float dy = ty - b->y;
+        const float len = sqrtf(dx * dx + dy * dy);
+        const float inv = (len > 0.001f) ? (1.0f / len) : 0.0f;
+        const float s = ShooterGameConfig::ENEMY_BULLET_SPEED; // requested: 2x slower
+        b->vx = dx * inv * s;
+        b->vy = dy * inv * s;
+        b->color = ShooterGameConfig::ENEMY_COLORS[type % 4];
+        b->dmg = 1;
     }
 
     // ---------------------------------------------------------
     // Boss projectiles
     // ---------------------------------------------------------
     void spawnStarShot(float x, float y, float vx, float vy, uint32_t now) {
-        for (int i = 0; i < MAX_STAR_SHOTS; i++) {
-            if (starShots[i].active) continue;
-            starShots[i].active = true;
-            starShots[i].x = x;
-            starShots[i].y = y;
-            starShots[i].vx = vx;
-            starShots[i].vy = vy;
-            starShots[i].startMs = now;
-            return;
-        }
+        StarShot* st = starShots.acquire();
+        if (!st) return;
+        st->x = x;
+        st->y = y;
+        st->vx = vx;
+        st->vy = vy;
+        st->startMs = now;
     }
 
     void spawnRocket(float x, float y, float vx, float vy, uint32_t now) {
-        for (int i = 0; i < MAX_ROCKETS; i++) {
-            if (rockets[i].active) continue;
-            rockets[i].active = true;
-            rockets[i].x = x;
-            rockets[i].y = y;
-            rockets[i].vx = vx;
-            rockets[i].vy = vy;
-            rockets[i].startMs = now;
-            rockets[i].nextTrailMs = now;
-            return;
-        }
+        Rocket* r = rockets.acquire();
+        if (!r) return;
+        r->x = x;
+        r->y = y;
+        r->vx = vx;
+        r->vy = vy;
+        r->startMs = now;
+        r->nextTrailMs = now;
     }
 
     void spawnPlayerRocket(float x, float y, uint32_t now) {
-        for (int i = 0; i < MAX_PLAYER_ROCKETS; i++) {
-            if (playerRockets[i].active) continue;
-            playerRockets[i].active = true;
-            playerRockets[i].x = x;
-            playerRockets[i].y = y;
-            playerRockets[i].vx = 0.0f;
-            playerRockets[i].vy = -0.40f; // starts going up, then homes
-            playerRockets[i].startMs = now;
-            playerRockets[i].nextTrailMs = now;
-            return;
-        }
+        Rocket* r = playerRockets.acquire();
+        if (!r) return;
+        r->x = x;
+        r->y = y;
+        r->vx = 0.0f;
+        r->vy = -0.40f; // starts going up, then homes
+        r->startMs = now;
+        r->nextTrailMs = now;
     }
 
     void bossFireStarBurst(uint32_t now) {
@@ -1096,31 +1065,31 @@ private:
 
     void updateBossProjectiles(uint32_t now) {
         // Stars
-        for (int i = 0; i < MAX_STAR_SHOTS; i++) {
-            if (!starShots[i].active) continue;
-            starShots[i].x += starShots[i].vx;
-            starShots[i].y += starShots[i].vy;
-            if (starShots[i].x < -2 || starShots[i].x > PANEL_RES_X + 2 ||
-                starShots[i].y < HUD_H - 2 || starShots[i].y > PANEL_RES_Y + 2) {
-                starShots[i].active = false;
+        for (uint16_t i = starShots.size(); i-- > 0;) {
+            StarShot& st = starShots[i];
+            st.x += st.vx;
+            st.y += st.vy;
+            if (st.x < -2 || st.x > PANEL_RES_X + 2 ||
+                st.y < HUD_H - 2 || st.y > PANEL_RES_Y + 2) {
+                starShots.release(&st);
             }
         }
 
         // Rockets (homing)
         const float tx = player.x + 2.0f;
         const float ty = (float)((int)player.y + 2);
-        for (int i = 0; i < MAX_ROCKETS; i++) {
-            if (!rockets[i].active) continue;
+        for (uint16_t i = rockets.size(); i-- > 0;) {
+            Rocket& r = rockets[i];
 
             // Lifespan (requested): prevent unavoidable forever-rockets.
-            if ((uint32_t)(now - rockets[i].startMs) >= (uint32_t)ShooterGameConfig::ENEMY_ROCKET_LIFE_MS) {
-                rockets[i].active = false;
+            if ((uint32_t)(now - r.startMs) >= (uint32_t)ShooterGameConfig::ENEMY_ROCKET_LIFE_MS) {
+                rockets.release(&r);
                 continue;
             }
 
             // Desired direction toward player
-            float dx = tx - rockets[i].x;
-            float dy = ty - rockets[i].y;
+            float dx = tx - r.x;
+            float dy = ty - r.y;
             const float d = sqrtf(dx * dx + dy * dy);
             if (d > 0.001f) { dx /= d; dy /= d; }
             const float desiredVx = dx * 0.55f;
@@ -1128,32 +1097,32 @@ private:
 
             // Steer (slow but persistent)
             const float steer = 0.08f;
-            rockets[i].vx = rockets[i].vx * (1.0f - steer) + desiredVx * steer;
-            rockets[i].vy = rockets[i].vy * (1.0f - steer) + desiredVy * steer;
+            r.vx = r.vx * (1.0f - steer) + desiredVx * steer;
+            r.vy = r.vy * (1.0f - steer) + desiredVy * steer;
 
-            rockets[i].x += rockets[i].vx;
-            rockets[i].y += rockets[i].vy;
+            r.x += r.vx;
+            r.y += r.vy;
 
             // Trail/fire particles
-            if (now >= rockets[i].nextTrailMs) {
-                rockets[i].nextTrailMs = now + 70;
-                spawnParticles(rockets[i].x, rockets[i].y, COLOR_ORANGE, 6, now);
+            if (now >= r.nextTrailMs) {
+                r.nextTrailMs = now + 70;
+                spawnParticles(r.x, r.y, COLOR_ORANGE, 6, now);
             }
 
-            if (rockets[i].x < -3 || rockets[i].x > PANEL_RES_X + 3 ||
-                rockets[i].y < HUD_H - 3 || rockets[i].y > PANEL_RES_Y + 3) {
-                rockets[i].active = false;
+            if (r.x < -3 || r.x > PANEL_RES_X + 3 ||
+                r.y < HUD_H - 3 || r.y > PANEL_RES_Y + 3) {
+                rockets.release(&r);
             }
         }
     }
 
     void updatePlayerRockets(uint32_t now) {
         // Target: boss if active, else nearest enemy, else keep going up.
-        for (int i = 0; i < MAX_PLAYER_ROCKETS; i++) {
-            if (!playerRockets[i].active) continue;
+        for (uint16_t i = playerRockets.size(); i-- > 0;) {
+            Rocket& r = playerRockets[i];
 
-            float tx = playerRockets[i].x;
-            float ty = playerRockets[i].y - 10.0f;
+            float tx = r.x;
+            float ty = r.y - 10.0f;
             bool hasTarget = false;
 
             if (boss.active) {
@@ -1162,12 +1131,11 @@ private:
                 hasTarget = true;
             } else {
                 float bestD2 = 1e9f;
-                for (int ei = 0; ei < MAX_ENEMIES; ei++) {
-                    if (!enemies[ei].alive) continue;
+                for (uint16_t ei = 0; ei < enemies.size(); ei++) {
                     const float ex = enemies[ei].x + (float)(ENEMY_W / 2);
                     const float ey = enemies[ei].y + (float)(ENEMY_H / 2);
-                    const float dx = ex - playerRockets[i].x;
-                    const float dy = ey - playerRockets[i].y;
+                    const float dx = ex - r.x;
+                    const float dy = ey - r.y;
                     const float d2 = dx * dx + dy * dy;
                     if (d2 < bestD2) {
                         bestD2 = d2;
@@ -1179,49 +1147,45 @@ private:
             }
 
             if (hasTarget) {
-                float dx = tx - playerRockets[i].x;
-                float dy = ty - playerRockets[i].y;
+                float dx = tx - r.x;
+                float dy = ty - r.y;
                 const float d = sqrtf(dx * dx + dy * dy);
                 if (d > 0.001f) { dx /= d; dy /= d; }
 
                 const float desiredVx = dx * 0.70f;
                 const float desiredVy = dy * 0.70f;
                 const float steer = 0.12f;
-                playerRockets[i].vx = playerRockets[i].vx * (1.0f - steer) + desiredVx * steer;
-                playerRockets[i].vy = playerRockets[i].vy * (1.0f - steer) + desiredVy * steer;
+                r.vx = r.vx * (1.0f - steer) + desiredVx * steer;
+                r.vy = r.vy * (1.0f - steer) + desiredVy * steer;
             } else {
                 // No target: keep going upward slowly.
-                playerRockets[i].vx *= 0.98f;
-                playerRockets[i].vy = min(playerRockets[i].vy, -0.35f);
+                r.vx *= 0.98f;
+                r.vy = min(r.vy, -0.35f);
             }
 
-            playerRockets[i].x += playerRockets[i].vx;
-            playerRockets[i].y += playerRockets[i].vy;
+            r.x += r.vx;
+            r.y += r.vy;
 
             // Trail
-            if (now >= playerRockets[i].nextTrailMs) {
-                playerRockets[i].nextTrailMs = now + 70;
-                spawnParticles(playerRockets[i].x, playerRockets[i].y, COLOR_PURPLE, 8, now);
+            if (now >= r.nextTrailMs) {
+                r.nextTrailMs = now + 70;
+                spawnParticles(r.x, r.y, COLOR_PURPLE, 8, now);
             }
 
-            if (playerRockets[i].x < -4 || playerRockets[i].x > PANEL_RES_X + 4 ||
-                playerRockets[i].y < -6 || playerRockets[i].y > PANEL_RES_Y + 6) {
-                playerRockets[i].active = false;
+            if (r.x < -4 || r.x > PANEL_RES_X + 4 ||
+                r.y < -6 || r.y > PANEL_RES_Y + 6) {
+                playerRockets.release(&r);
             }
         }
     }
 
-    void maybeDropPowerup(float x, float y, float kickVx, float kickVy) {
+    void maybeDropPowerup(Fixed::q16 x, Fixed::q16 y, Fixed::q16 kickVx, Fixed::q16 kickVy) {
         // Keep it occasional.
         const int dropChance = ShooterGameConfig::POWERUP_DROP_CHANCE_PERCENT; // % (tunable)
         if (random(0, 100) >= dropChance) return;
 
-        // Find slot.
-        int slot = -1;
-        for (int i = 0; i < MAX_POWERUPS; i++) {
-            if (!powerups[i].active) { slot = i; break; }
-        }
-        if (slot < 0) return;
+        PowerUp* slot = powerups.acquire();
+        if (!slot) return;
 
         // Choose type by weights (config-driven).
         // NOTE: White is intentionally only available from normal drops (this function),
@@ -1250,15 +1214,14 @@ private:
             t = ShooterGameConfig::POWERUP_POINTS_YELLOW;
         }
 
-        powerups[slot].active = true;
-        powerups[slot].x = x;
-        powerups[slot].y = y;
-        powerups[slot].type = t;
+        slot->x = x;
+        slot->y = y;
+        slot->type = t;
         // Launch away from explosion so it's harder to catch (strong sideways variety),
         // but keep overall fall speed floaty/slower.
-        powerups[slot].vx = kickVx + ((float)random(-80, 81) / 100.0f) * 0.28f;
-        powerups[slot].vy = kickVy + ((float)random(-20, 41) / 100.0f) * 0.08f;
-        powerups[slot].tier = 0;
+        slot->vx = kickVx + Fixed::mul(Fixed::ratio(random(-80, 81), 100), Fixed::fromFloat(0.28f));
+        slot->vy = kickVy + Fixed::mul(Fixed::ratio(random(-20, 41), 100), Fixed::fromFloat(0.08f));
+        slot->tier = 0;
     }
 
     void applyPowerup(uint8_t type, uint32_t now) {
@@ -1286,19 +1249,18 @@ private:
             if (ShooterGameConfig::CYAN_POWERUP_KIND == 3) {
                 // SMART_BOMB: instant effect (no timer needed).
                 // Kill all normal enemies and clear enemy bullets for readability.
-                for (int i = 0; i < MAX_ENEMIES; i++) {
+                for (uint16_t i = enemies.size(); i-- > 0;) {
                     Enemy& e = enemies[i];
-                    if (!e.alive) continue;
                     const int ex = (int)e.x + (int)(ENEMY_W / 2);
                     const int ey = (int)e.y + (int)(ENEMY_H / 2);
-                    e.alive = false;
                     kills++;
                     const int mult = (ShooterGameConfig::CYAN_POWERUP_KIND == 4 && (int32_t)(cyanUntilMs - now) > 0) ? (int)ShooterGameConfig::CYAN_SCORE_MULT : 1;
                     score += mult * (10 + (e.type * 5));
                     spawnExplosion(ex, ey, COLOR_WHITE, now);
                     spawnParticles((float)ex, (float)ey, COLOR_CYAN, 10, now);
                 }
-                for (int i = 0; i < MAX_ENEMY_BULLETS; i++) enemyBullets[i].active = false;
+                enemies.clear();
+                enemyBullets.clear();
             } else {
                 // Tiered duration (match the red/shield feel): picking up another cyan increases tier.
                 // Tier caps at 5.
@@ -1319,122 +1281,122 @@ private:
 
     void updateBulletsAndPowerups(uint32_t now) {
         // Player bullets
-        for (int i = 0; i < MAX_PLAYER_BULLETS; i++) {
-            if (!playerBullets[i].active) continue;
-            playerBullets[i].x += playerBullets[i].vx;
-            playerBullets[i].y += playerBullets[i].vy;
-            if (playerBullets[i].y < (float)HUD_H || playerBullets[i].y > (float)(PANEL_RES_Y + 2) ||
-                playerBullets[i].x < -2.0f || playerBullets[i].x > (float)(PANEL_RES_X + 2)) {
-                playerBullets[i].active = false;
+        for (uint16_t i = playerBullets.size(); i-- > 0;) {
+            Bullet& b = playerBullets[i];
+            b.x += b.vx;
+            b.y += b.vy;
+            if (b.y < (float)HUD_H || b.y > (float)(PANEL_RES_Y + 2) ||
+                b.x < -2.0f || b.x > (float)(PANEL_RES_X + 2)) {
+                playerBullets.release(&b);
             }
         }
 
         // Enemy bullets
-        for (int i = 0; i < MAX_ENEMY_BULLETS; i++) {
-            if (!enemyBullets[i].active) continue;
-            enemyBullets[i].x += enemyBullets[i].vx;
-            enemyBullets[i].y += enemyBullets[i].vy;
-            if (enemyBullets[i].y < -2.0f || enemyBullets[i].y > (float)(PANEL_RES_Y + 2) ||
-                enemyBullets[i].x < -2.0f || enemyBullets[i].x > (float)(PANEL_RES_X + 2)) {
-                enemyBullets[i].active = false;
+        for (uint16_t i = enemyBullets.size(); i-- > 0;) {
+            Bullet& b = enemyBullets[i];
+            b.x += b.vx;
+            b.y += b.vy;
+            if (b.y < -2.0f || b.y > (float)(PANEL_RES_Y + 2) ||
+                b.x < -2.0f || b.x > (float)(PANEL_RES_X + 2)) {
+                enemyBullets.release(&b);
             }
         }
 
         // Powerups
-        for (int i = 0; i < MAX_POWERUPS; i++) {
-            if (!powerups[i].active) continue;
+        for (uint16_t i = powerups.size(); i-- > 0;) {
+            PowerUp& pu = powerups[i];
             // Cyan MAGNET powerup: attract all powerups toward the ship.
             if (ShooterGameConfig::CYAN_POWERUP_KIND == 0 && cyanTier > 0 && (int32_t)(cyanUntilMs - now) > 0) {
-                const float tx = player.x + (float)SHIP_W * 0.5f;
-                const float ty = player.y + (float)SHIP_H * 0.5f;
-                const float dx = tx - powerups[i].x;
-                const float dy = ty - powerups[i].y;
+                // Ship position is still float; convert once at the boundary.
+                const Fixed::q16 tx = Fixed::fromFloat(player.x + (float)SHIP_W * 0.5f);
+                const Fixed::q16 ty = Fixed::fromFloat(player.y + (float)SHIP_H * 0.5f);
+                const Fixed::q16 dx = tx - pu.x;
+                const Fixed::q16 dy = ty - pu.y;
                 // Tiered attraction: tier 0 -> no attraction, tier 5 -> very strong
                 // (slightly stronger than gravity; see config).
-                const float tier01 = (float)min<uint8_t>(ShooterGameConfig::CYAN_TIER_MAX, cyanTier) / (float)max<uint8_t>(1, ShooterGameConfig::CYAN_TIER_MAX);
-                const float amax = ShooterGameConfig::CYAN_MAGNET_ACCEL_MAX_AT_TIER5 * tier01;
-                const float k = ShooterGameConfig::CYAN_MAGNET_K_AT_TIER5 * tier01;
-                powerups[i].vx += clampf(dx * k, -amax, amax);
-                powerups[i].vy += clampf(dy * k, -amax, amax);
+                const Fixed::q16 tier01 = Fixed::ratio(min<uint8_t>(ShooterGameConfig::CYAN_TIER_MAX, cyanTier), max<uint8_t>(1, ShooterGameConfig::CYAN_TIER_MAX));
+                const Fixed::q16 amax = Fixed::mul(ShooterGameConfig::CYAN_MAGNET_ACCEL_MAX_AT_TIER5, tier01);
+                const Fixed::q16 k = Fixed::mul(ShooterGameConfig::CYAN_MAGNET_K_AT_TIER5, tier01);
+                pu.vx += Fixed::clamp(Fixed::mul(dx, k), -amax, amax);
+                pu.vy += Fixed::clamp(Fixed::mul(dy, k), -amax, amax);
             }
             // Ballistic motion (kick + gravity + drag) + wall bounces.
-            powerups[i].x += powerups[i].vx;
-            powerups[i].y += powerups[i].vy;
-            powerups[i].vy += POWERUP_GRAVITY;
-            powerups[i].vx *= POWERUP_DRAG;
-            powerups[i].vy *= POWERUP_DRAG;
+            pu.x += pu.vx;
+            pu.y += pu.vy;
+            pu.vy += POWERUP_GRAVITY;
+            pu.vx = Fixed::mul(pu.vx, POWERUP_DRAG);
+            pu.vy = Fixed::mul(pu.vy, POWERUP_DRAG);
 
             // Bounce off left/right bounds so packs stay on-screen.
-            const float minX = 0.0f;
-            const float maxX = (float)(PANEL_RES_X - POWERUP_SIZE_PX);
-            if (powerups[i].x < minX) {
-                powerups[i].x = minX;
-                powerups[i].vx = fabsf(powerups[i].vx) * POWERUP_BOUNCE;
-            } else if (powerups[i].x > maxX) {
-                powerups[i].x = maxX;
-                powerups[i].vx = -fabsf(powerups[i].vx) * POWERUP_BOUNCE;
+            const Fixed::q16 minX = 0;
+            const Fixed::q16 maxX = Fixed::fromInt(PANEL_RES_X - POWERUP_SIZE_PX);
+            if (pu.x < minX) {
+                pu.x = minX;
+                pu.vx = Fixed::mul(Fixed::absVal(pu.vx), POWERUP_BOUNCE);
+            } else if (pu.x > maxX) {
+                pu.x = maxX;
+                pu.vx = -Fixed::mul(Fixed::absVal(pu.vx), POWERUP_BOUNCE);
             }
 
             // Bounce out of the HUD band if launched upward.
-            const float minY = (float)(HUD_H + 1);
-            if (powerups[i].y < minY) {
-                powerups[i].y = minY;
-                powerups[i].vy = fabsf(powerups[i].vy) * POWERUP_BOUNCE;
+            const Fixed::q16 minY = Fixed::fromInt(HUD_H + 1);
+            if (pu.y < minY) {
+                pu.y = minY;
+                pu.vy = Fixed::mul(Fixed::absVal(pu.vy), POWERUP_BOUNCE);
             }
 
             // Safety clamp: keep extremes in check.
-            powerups[i].vx = clampf(powerups[i].vx, -0.85f, 0.85f);
-            powerups[i].vy = clampf(powerups[i].vy, -0.85f, 0.85f);
+            pu.vx = Fixed::clamp(pu.vx, -POWERUP_MAX_V, POWERUP_MAX_V);
+            pu.vy = Fixed::clamp(pu.vy, -POWERUP_MAX_V, POWERUP_MAX_V);
 
             // Catch by player ship bounds
             const int px = (int)player.x;
             const int py = (int)player.y;
-            if (powerups[i].y >= (float)py - 1 &&
-                powerups[i].x >= (float)(px - 1) &&
-                powerups[i].x <= (float)(px + SHIP_W)) {
+            if (pu.y >= Fixed::fromInt(py - 1) &&
+                pu.x >= Fixed::fromInt(px - 1) &&
+                pu.x <= Fixed::fromInt(px + SHIP_W)) {
                 // Pickup sparkle (colored by pack).
                 const uint16_t c =
-                    (powerups[i].type == ShooterGameConfig::POWERUP_SHIELD_BLUE) ? COLOR_BLUE :
-                    (powerups[i].type == ShooterGameConfig::POWERUP_WEAPON_RED) ? COLOR_RED :
-                    (powerups[i].type == ShooterGameConfig::POWERUP_LIFE_GREEN) ? COLOR_GREEN :
-                    (powerups[i].type == ShooterGameConfig::POWERUP_ROCKET_PURPLE) ? COLOR_PURPLE :
-                    (powerups[i].type == ShooterGameConfig::POWERUP_POINTS_YELLOW) ? COLOR_YELLOW :
-                    (powerups[i].type == ShooterGameConfig::POWERUP_FUN_CYAN) ? COLOR_CYAN :
+                    (pu.type == ShooterGameConfig::POWERUP_SHIELD_BLUE) ? COLOR_BLUE :
+                    (pu.type == ShooterGameConfig::POWERUP_WEAPON_RED) ? COLOR_RED :
+                    (pu.type == ShooterGameConfig::POWERUP_LIFE_GREEN) ? COLOR_GREEN :
+                    (pu.type == ShooterGameConfig::POWERUP_ROCKET_PURPLE) ? COLOR_PURPLE :
+                    (pu.type == ShooterGameConfig::POWERUP_POINTS_YELLOW) ? COLOR_YELLOW :
+                    (pu.type == ShooterGameConfig::POWERUP_FUN_CYAN) ? COLOR_CYAN :
                     COLOR_WHITE;
-                spawnParticles(powerups[i].x + 1.0f, powerups[i].y + 1.0f, c, 10, now);
+                spawnParticles(Fixed::toFloat(pu.x + Fixed::ONE), Fixed::toFloat(pu.y + Fixed::ONE), c, 10, now);
 
                 // Pickup SFX (type-specific).
-                if (powerups[i].type == ShooterGameConfig::POWERUP_SHIELD_BLUE) {
+                if (pu.type == ShooterGameConfig::POWERUP_SHIELD_BLUE) {
                     playSfxPatternCooldown(ShooterGameAudio::SFX_PICKUP_BLUE, ShooterGameAudio::SFX_PICKUP_BLUE_N, ShooterGameConfig::SFX_PICKUP_COOLDOWN_MS, now, sfx.lastPickupMs);
-                } else if (powerups[i].type == ShooterGameConfig::POWERUP_WEAPON_RED) {
+                } else if (pu.type == ShooterGameConfig::POWERUP_WEAPON_RED) {
                     playSfxPatternCooldown(ShooterGameAudio::SFX_PICKUP_RED, ShooterGameAudio::SFX_PICKUP_RED_N, ShooterGameConfig::SFX_PICKUP_COOLDOWN_MS, now, sfx.lastPickupMs);
-                } else if (powerups[i].type == ShooterGameConfig::POWERUP_LIFE_GREEN) {
+                } else if (pu.type == ShooterGameConfig::POWERUP_LIFE_GREEN) {
                     playSfxPatternCooldown(ShooterGameAudio::SFX_PICKUP_GREEN, ShooterGameAudio::SFX_PICKUP_GREEN_N, ShooterGameConfig::SFX_PICKUP_COOLDOWN_MS, now, sfx.lastPickupMs);
-                } else if (powerups[i].type == ShooterGameConfig::POWERUP_POINTS_YELLOW) {
+                } else if (pu.type == ShooterGameConfig::POWERUP_POINTS_YELLOW) {
                     playSfxPatternCooldown(ShooterGameAudio::SFX_PICKUP_YELLOW, ShooterGameAudio::SFX_PICKUP_YELLOW_N, ShooterGameConfig::SFX_PICKUP_COOLDOWN_MS, now, sfx.lastPickupMs);
-                } else if (powerups[i].type == ShooterGameConfig::POWERUP_FUN_CYAN) {
+                } else if (pu.type == ShooterGameConfig::POWERUP_FUN_CYAN) {
                     playSfxPatternCooldown(ShooterGameAudio::SFX_PICKUP_CYAN, ShooterGameAudio::SFX_PICKUP_CYAN_N, ShooterGameConfig::SFX_PICKUP_COOLDOWN_MS, now, sfx.lastPickupMs);
-                } else if (powerups[i].type == ShooterGameConfig::POWERUP_BUNDLE_WHITE) {
+                } else if (pu.type == ShooterGameConfig::POWERUP_BUNDLE_WHITE) {
                     playSfxPatternCooldown(ShooterGameAudio::SFX_PICKUP_WHITE, ShooterGameAudio::SFX_PICKUP_WHITE_N, ShooterGameConfig::SFX_PICKUP_COOLDOWN_MS, now, sfx.lastPickupMs);
                 } else {
                     playSfxPatternCooldown(ShooterGameAudio::SFX_PICKUP_PURPLE, ShooterGameAudio::SFX_PICKUP_PURPLE_N, ShooterGameConfig::SFX_PICKUP_COOLDOWN_MS, now, sfx.lastPickupMs);
                 }
 
-                applyPowerup(powerups[i].type, now);
-                powerups[i].active = false;
+                applyPowerup(pu.type, now);
+                powerups.release(&pu);
                 continue;
             }
 
-            if (powerups[i].y > PANEL_RES_Y) powerups[i].active = false;
+            if (pu.y > Fixed::fromInt(PANEL_RES_Y)) powerups.release(&pu);
         }
     }
 
     void updateEnemiesAndEnemyFire(uint32_t now) {
         // Allow enemies to enter from above the screen (no snap to HUD line).
         const float minY = -(float)ENEMY_H - 2.0f;
-        for (int i = 0; i < MAX_ENEMIES; i++) {
+        for (uint16_t i = enemies.size(); i-- > 0;) {
             Enemy& e = enemies[i];
-            if (!e.alive) continue;
 
             // Organic drift
             e.x += e.vx;
@@ -1448,7 +1410,7 @@ private:
             if (e.y < minY) e.y = minY;
             // Enemies can fly past the player and exit the screen downward.
             if (e.y > (float)(PANEL_RES_Y + ENEMY_H + 2)) {
-                e.alive = false;
+                enemies.release(&e);
                 continue;
             }
 
@@ -1470,19 +1432,51 @@ private:
         }
     }
 
+    void rebuildEnemyGrid() {
+        enemyGrid.clear();
+        for (uint16_t i = 0; i < enemies.size(); i++) {
+            const Enemy& e = enemies[i];
+            enemyGrid.insert((uint8_t)enemies.slotIndex(&e), (int)e.x, (int)e.y, ENEMY_W, ENEMY_H);
+        }
+    }
+
+    // Live enemy whose box contains (x, y), or nullptr. Among overlapping enemies this
+    // picks the highest dense index, i.e. the one a backwards scan over `enemies` meets
+    // first, so hits are the same as with the plain nested loops.
+    Enemy* enemyAt(int x, int y) {
+        EnemyGrid::Mask m = enemyGrid.query(x, y);
+        Enemy* best = nullptr;
+        uint16_t bestPos = 0;
+        while (m) {
+            const uint8_t slot = (uint8_t)__builtin_ctz(m);
+            m &= m - 1;
+            Enemy* e = enemies.atSlot(slot);
+            if (!e || !rectContains(x, y, (int)e->x, (int)e->y, ENEMY_W, ENEMY_H)) continue;
+            const uint16_t pos = enemies.indexOf(e);
+            if (!best || pos > bestPos) {
+                best = e;
+                bestPos = pos;
+            }
+        }
+        return best;
+    }
+
     void handleCollisions(uint32_t now) {
+        // Enemies do not move in here, so one grid build covers every projectile test below;
+        // enemies killed along the way drop out through atSlot().
+        rebuildEnemyGrid();
+
         // ---------------------------------------------------------
         // Player guided rockets vs enemies/boss
         // ---------------------------------------------------------
-        for (int ri = 0; ri < MAX_PLAYER_ROCKETS; ri++) {
-            if (!playerRockets[ri].active) continue;
-
-            const int rx = (int)playerRockets[ri].x;
-            const int ry = (int)playerRockets[ri].y;
+        for (uint16_t ri = playerRockets.size(); ri-- > 0;) {
+            Rocket& r = playerRockets[ri];
+            const int rx = (int)r.x;
+            const int ry = (int)r.y;
 
             // Boss hit
             if (boss.active && rectContains(rx, ry, (int)boss.x, (int)boss.y, BOSS_W, BOSS_H)) {
-                playerRockets[ri].active = false;
+                playerRockets.release(&r);
                 spawnExplosion(rx, ry, COLOR_WHITE, now);
                 spawnParticles((float)rx, (float)ry, COLOR_PURPLE, 18, now);
 
@@ -1506,20 +1500,17 @@ private:
                     boss.active = false;
                     bossPending = false;
                     startBossDeath(now);
+                    break; // startBossDeath() cleared the remaining player rockets
                 }
                 continue;
             }
 
             // Enemy hit
-            for (int ei = 0; ei < MAX_ENEMIES; ei++) {
-                Enemy& e = enemies[ei];
-                if (!e.alive) continue;
-                if (!rectContains(rx, ry, (int)e.x, (int)e.y, ENEMY_W, ENEMY_H)) continue;
-
-                playerRockets[ri].active = false;
+            if (Enemy* hit = enemyAt(rx, ry)) {
+                Enemy& e = *hit;
+                playerRockets.release(&r);
                 // Count full HP as "hits" (damage units) for hits_until_boss.
                 const uint8_t hpBefore = e.hp;
-                e.alive = false;
                 hitsThisLevel = (uint16_t)min<uint32_t>(65535u, (uint32_t)hitsThisLevel + (uint32_t)hpBefore);
                 kills++;
                 const int mult = (ShooterGameConfig::CYAN_POWERUP_KIND == 4 && (int32_t)(cyanUntilMs - now) > 0) ? (int)ShooterGameConfig::CYAN_SCORE_MULT : 1;
@@ -1530,10 +1521,10 @@ private:
                 spawnExplosion(ex, ey, COLOR_WHITE, now);
                 spawnParticles((float)ex, (float)ey, COLOR_PURPLE, 16, now);
                 // Keep existing drop behavior.
-                const float kickVx = ((float)random(-100, 101) / 100.0f) * 0.70f;
-                const float kickVy = -(((float)random(20, 80) / 100.0f) * 0.10f);
-                maybeDropPowerup(e.x + 1.0f, e.y + 2.0f, kickVx, kickVy);
-                break;
+                const Fixed::q16 kickVx = Fixed::mul(Fixed::ratio(random(-100, 101), 100), Fixed::fromFloat(0.70f));
+                const Fixed::q16 kickVy = -Fixed::mul(Fixed::ratio(random(20, 80), 100), Fixed::fromFloat(0.10f));
+                maybeDropPowerup(Fixed::fromFloat(e.x + 1.0f), Fixed::fromFloat(e.y + 2.0f), kickVx, kickVy);
+                enemies.release(&e);
             }
         }
 
@@ -1543,13 +1534,12 @@ private:
         if (boss.active) {
             const int bx0 = (int)boss.x;
             const int by0 = (int)boss.y;
-            for (int bi = 0; bi < MAX_PLAYER_BULLETS; bi++) {
+            for (uint16_t bi = playerBullets.size(); bi-- > 0;) {
                 Bullet& b = playerBullets[bi];
-                if (!b.active) continue;
                 const int bix = (int)b.x;
                 const int biy = (int)b.y;
                 if (rectContains(bix, biy, bx0, by0, BOSS_W, BOSS_H)) {
-                    b.active = false;
+                    playerBullets.release(&b);
                     // Shield absorbs first.
                     if (boss.shieldTier > 0) {
                         boss.shieldTier--;
@@ -1588,57 +1578,52 @@ private:
         }
 
         // Player bullets vs enemies
-        for (int bi = 0; bi < MAX_PLAYER_BULLETS; bi++) {
+        for (uint16_t bi = playerBullets.size(); bi-- > 0;) {
             Bullet& b = playerBullets[bi];
-            if (!b.active) continue;
             const int bx = (int)b.x;
             const int by = (int)b.y;
 
-            for (int ei = 0; ei < MAX_ENEMIES; ei++) {
-                Enemy& e = enemies[ei];
-                if (!e.alive) continue;
-                if (rectContains(bx, by, (int)e.x, (int)e.y, ENEMY_W, ENEMY_H)) {
-                    // Apply damage
-                    const uint8_t dmg = max<uint8_t>(1, b.dmg);
-                    const uint8_t hpBefore = e.hp;
-                    if (e.hp > dmg) e.hp = (uint8_t)(e.hp - dmg);
-                    else e.hp = 0;
-                    const uint8_t applied = (hpBefore > e.hp) ? (uint8_t)(hpBefore - e.hp) : 0;
-                    hitsThisLevel = (uint16_t)min<uint32_t>(65535u, (uint32_t)hitsThisLevel + (uint32_t)applied);
-
-                    if (e.hp == 0) {
-                        e.alive = false;
-                        kills++;
-                        {
-                            const int mult = (ShooterGameConfig::CYAN_POWERUP_KIND == 4 && (int32_t)(cyanUntilMs - now) > 0) ? (int)ShooterGameConfig::CYAN_SCORE_MULT : 1;
-                            score += mult * (10 + (e.type * 5));
-                        }
-                        // Explosion + powerup kick
-                        const int ex = (int)e.x + (int)(ENEMY_W / 2);
-                        const int ey = (int)e.y + (int)(ENEMY_H / 2);
-                        spawnExplosion(ex, ey, ShooterGameConfig::ENEMY_COLORS[e.type & 3], now);
-                        // Extra sparkle burst (Breakout-style debris).
-                        spawnParticles((float)ex, (float)ey, ShooterGameConfig::ENEMY_COLORS[e.type & 3], 12, now);
+            Enemy* hit = enemyAt(bx, by);
+            if (!hit) continue;
+            Enemy& e = *hit;
+            // Apply damage
+            const uint8_t dmg = max<uint8_t>(1, b.dmg);
+            const uint8_t hpBefore = e.hp;
+            if (e.hp > dmg) e.hp = (uint8_t)(e.hp - dmg);
+            else e.hp = 0;
+            const uint8_t applied = (hpBefore > e.hp) ? (uint8_t)(hpBefore - e.hp) : 0;
+            hitsThisLevel = (uint16_t)min<uint32_t>(65535u, (uint32_t)hitsThisLevel + (uint32_t)applied);
+
+            if (e.hp == 0) {
+                kills++;
+                {
+                    const int mult = (ShooterGameConfig::CYAN_POWERUP_KIND == 4 && (int32_t)(cyanUntilMs - now) > 0) ? (int)ShooterGameConfig::CYAN_SCORE_MULT : 1;
+                    score += mult * (10 + (e.type * 5));
+                }
+                // Explosion + powerup kick
+                const int ex = (int)e.x + (int)(ENEMY_W / 2);
+                const int ey = (int)e.y + (int)(ENEMY_H / 2);
+                spawnExplosion(ex, ey, ShooterGameConfig::ENEMY_COLORS[e.type & 3], now);
+                // Extra sparkle burst (Breakout-style debris).
+                spawnParticles((float)ex, (float)ey, ShooterGameConfig::ENEMY_COLORS[e.type & 3], 12, now);
 
-                        playSfxPatternCooldown(
-                            ShooterGameAudio::SFX_ENEMY_KILL,
-                            ShooterGameAudio::SFX_ENEMY_KILL_N,
-                            ShooterGameConfig::SFX_ENEMY_KILL_COOLDOWN_MS,
-                            now,
-                            sfx.lastEnemyKillMs
-                        );
+                playSfxPatternCooldown(
+                    ShooterGameAudio::SFX_ENEMY_KILL,
+                    ShooterGameAudio::SFX_ENEMY_KILL_N,
+                    ShooterGameConfig::SFX_ENEMY_KILL_COOLDOWN_MS,
+                    now,
+                    sfx.lastEnemyKillMs
+                );
 
-                        // Powerup kick: stronger sideways randomness, slight upward.
-                        const float kickVx = ((float)random(-100, 101) / 100.0f) * 0.70f; // ~-0.70..0.70
-                        const float kickVy = -(((float)random(20, 80) / 100.0f) * 0.10f);  // ~-0.02..-0.08
-                        maybeDropPowerup(e.x + 1.0f, e.y + 2.0f, kickVx, kickVy);
-                    }
-                    // Cyan PIERCING: bullet stays alive after hitting an enemy (but still only hits 1 enemy per tick).
-                    if (!(ShooterGameConfig::CYAN_POWERUP_KIND == 1 && (int32_t)(cyanUntilMs - now) > 0)) {
-                        b.active = false;
-                    }
-                    break;
-                }
+                // Powerup kick: stronger sideways randomness, slight upward.
+                const Fixed::q16 kickVx = Fixed::mul(Fixed::ratio(random(-100, 101), 100), Fixed::fromFloat(0.70f)); // ~-0.70..0.70
+                const Fixed::q16 kickVy = -Fixed::mul(Fixed::ratio(random(20, 80), 100), Fixed::fromFloat(0.10f));   // ~-0.02..-0.08
+                maybeDropPowerup(Fixed::fromFloat(e.x + 1.0f), Fixed::fromFloat(e.y + 2.0f), kickVx, kickVy);
+                enemies.release(&e);
+            }
+            // Cyan PIERCING: bullet stays alive after hitting an enemy (but still only hits 1 enemy per tick).
+            if (!(ShooterGameConfig::CYAN_POWERUP_KIND == 1 && (int32_t)(cyanUntilMs - now) > 0)) {
+                playerBullets.release(&b);
             }
         }
 
@@ -1651,9 +1636,9 @@ private:
         const bool invuln = ((int32_t)(invulnUntilMs - now) > 0);
         const int px = (int)player.x;
         const int py = (int)player.y;
-        for (int ei = 0; ei < MAX_ENEMIES; ei++) {
+        for (uint16_t ei = enemies.size(); ei-- > 0;) {
+            if (ei >= enemies.size()) continue; // the final-death AoE (loseLife) released enemies
             Enemy& e = enemies[ei];
-            if (!e.alive) continue;
             // Enemy body overlap with player ship rect
             const int ex = (int)e.x;
             const int ey = (int)e.y;
@@ -1661,7 +1646,7 @@ private:
             if (ex + ENEMY_W <= px || ex >= px + SHIP_W || ey + ENEMY_H <= py || ey >= py + SHIP_H) continue;
 
             // Collision: destroy enemy and apply damage unless invulnerable.
-            e.alive = false;
+            enemies.release(&e);
             spawnExplosion(ex + (int)(ENEMY_W / 2), ey + (int)(ENEMY_H / 2), ShooterGameConfig::ENEMY_COLORS[e.type & 3], now);
 
             if (!invuln) {
@@ -1683,9 +1668,9 @@ private:
 
         // Invulnerability window after taking damage.
         // (invuln / px / py already declared above and reused below)
-        for (int bi = 0; bi < MAX_ENEMY_BULLETS; bi++) {
+        for (uint16_t bi = enemyBullets.size(); bi-- > 0;) {
+            if (bi >= enemyBullets.size()) continue; // emptied by loseLife() on the final death
             Bullet& b = enemyBullets[bi];
-            if (!b.active) continue;
 
             // Shield neutralization (circle)
             const int bix = (int)b.x;
@@ -1695,7 +1680,7 @@ private:
                 const int dx = bix - cx;
                 const int dy = biy - cy;
                 if ((dx * dx + dy * dy) <= (int)shieldR * (int)shieldR) {
-                    b.active = false;
+                    enemyBullets.release(&b);
                     shieldHitFlashUntilMs = now + 120;
                     // Shield loses one tier per neutralized bullet.
                     if (shieldTier > 0) {
@@ -1707,7 +1692,7 @@ private:
             }
 
             if (rectContains(bix, biy, px, py, SHIP_W, SHIP_H)) {
-                b.active = false;
+                enemyBullets.release(&b);
                 if (!invuln) {
                     // Hit feedback: flash shield red briefly and rumble.
                     shieldHitFlashUntilMs = now + 180;
@@ -1727,7 +1712,8 @@ private:
         // ---------------------------------------------------------
         // Boss projectiles vs player (stars + rockets)
         // ---------------------------------------------------------
-        auto tryHitPlayerShielded = [&](float fx, float fy, bool& activeFlag) {
+        // Both return true when the projectile is used up (the caller releases it).
+        auto tryHitPlayerShielded = [&](float fx, float fy) -> bool {
             const int ix = (int)fx;
             const int iy = (int)fy;
 
@@ -1736,49 +1722,48 @@ private:
                 const int dx = ix - cx;
                 const int dy = iy - cy;
                 if ((dx * dx + dy * dy) <= (int)shieldR * (int)shieldR) {
-                    activeFlag = false;
                     shieldHitFlashUntilMs = now + 120;
                     if (shieldTier > 0) {
                         shieldTier--;
                         if (shieldTier == 0) shieldUntilMs = 0;
                     }
                     spawnParticles(fx, fy, COLOR_CYAN, 8, now);
-                    return;
+                    return true;
                 }
             }
 
-            if (rectContains(ix, iy, px, py, SHIP_W, SHIP_H)) {
-                activeFlag = false;
-                if (!invuln) {
-                    spawnExplosion(cx, cy, COLOR_ORANGE, now);
-                    loseLife(now);
-                }
+            if (!rectContains(ix, iy, px, py, SHIP_W, SHIP_H)) return false;
+            if (!invuln) {
+                spawnExplosion(cx, cy, COLOR_ORANGE, now);
+                loseLife(now);
             }
+            return true;
         };
 
         // Red stars (boss star ammo) should NOT collide with the shield (requested).
         // They only damage on direct ship collision, and always take lives (shield ignored).
-        auto tryHitPlayerNoShield = [&](float fx, float fy, bool& activeFlag) {
+        auto tryHitPlayerNoShield = [&](float fx, float fy) -> bool {
             const int ix = (int)fx;
             const int iy = (int)fy;
-            if (!rectContains(ix, iy, px, py, SHIP_W, SHIP_H)) return;
-            activeFlag = false;
+            if (!rectContains(ix, iy, px, py, SHIP_W, SHIP_H)) return false;
             if (!invuln) {
                 spawnExplosion(cx, cy, COLOR_ORANGE, now);
                 // Direct life hit: ignore shield tiers completely.
                 loseLife(now);
             }
+            return true;
         };
 
-        for (int i = 0; i < MAX_STAR_SHOTS; i++) {
-            if (!starShots[i].active) continue;
-            bool& a = starShots[i].active;
-            tryHitPlayerNoShield(starShots[i].x, starShots[i].y, a);
+        // loseLife() on the final death clears both pools mid-loop (hence the size checks).
+        for (uint16_t i = starShots.size(); i-- > 0;) {
+            if (i >= starShots.size()) continue;
+            StarShot& st = starShots[i];
+            if (tryHitPlayerNoShield(st.x, st.y)) starShots.release(&st);
         }
-        for (int i = 0; i < MAX_ROCKETS; i++) {
-            if (!rockets[i].active) continue;
-            bool& a = rockets[i].active;
-            tryHitPlayerShielded(rockets[i].x, rockets[i].y, a);
+        for (uint16_t i = rockets.size(); i-- > 0;) {
+            if (i >= rockets.size()) continue;
+            Rocket& r = rockets[i];
+            if (tryHitPlayerShielded(r.x, r.y)) rockets.release(&r);
         }
     }
 
@@ -1896,27 +1881,15 @@ private:
     }
 
     void drawCloudLayer(MatrixPanel_I2S_DMA* display, const Cloud* arr, int count, uint8_t mul) {
+        // Layer mul is the brightness for "3". Scale 1..3 accordingly.
+        uint16_t pal[SpriteBlit::PALETTE_SIZE] = { 0 };
+        for (uint8_t v = 1; v < SpriteBlit::PALETTE_SIZE; v++) {
+            pal[v] = dimColor(display, COLOR_WHITE, (uint8_t)((uint16_t)mul * (uint16_t)v / 3u));
+        }
         for (int i = 0; i < count; i++) {
             const Cloud& c = arr[i];
             if (!c.active) continue;
-            const int sx = (int)c.sprite;
-            const int w = (int)ShooterGameConfig::CLOUD_W[sx];
-            const int h = (int)ShooterGameConfig::CLOUD_H[sx];
-            const int x0 = (int)c.x;
-            const int y0 = (int)c.y;
-            for (int y = 0; y < h; y++) {
-                const int py = y0 + y;
-                if (py < 0 || py >= PANEL_RES_Y) continue;
-                for (int x = 0; x < w; x++) {
-                    const uint8_t v = ShooterGameConfig::CLOUD_SPRITES[sx][y][x] & 3;
-                    if (v == 0) continue;
-                    const int px = x0 + x;
-                    if (px < 0 || px >= PANEL_RES_X) continue;
-                    // Layer mul is the brightness for "3". Scale 1..3 accordingly.
-                    const uint8_t pmul = (uint8_t)((uint16_t)mul * (uint16_t)v / 3u);
-                    display->drawPixel(px, py, dimColor(display, COLOR_WHITE, pmul));
-                }
-            }
+            SpriteBlit::blit(display, ShooterGameConfig::CLOUD_SHEET, c.sprite, (int)c.x, (int)c.y, pal);
         }
     }
 
@@ -1927,15 +1900,10 @@ private:
     }
 
     void drawShip(MatrixPanel_I2S_DMA* display, int x, int y, uint16_t color, bool shield) {
-        static constexpr uint8_t MUL_LUT[4] = { 0, 80, 160, 255 };
-        for (int yy = 0; yy < SHIP_H; yy++) {
-            for (int xx = 0; xx < SHIP_W; xx++) {
-                const uint8_t v = ShooterGameConfig::SHIP_SPRITE[yy][xx] & 3;
-                if (v == 0) continue;
-                const uint16_t c = (v == 3) ? color : dimColor(display, color, MUL_LUT[v]);
-                display->drawPixel(x + xx, y + yy, c);
-            }
-        }
+        const uint16_t pal[SpriteBlit::PALETTE_SIZE] = {
+            0, dimColor(display, color, 80), dimColor(display, color, 160), color
+        };
+        SpriteBlit::blit(display, ShooterGameConfig::SHIP_SHEET, 0, x, y, pal);
 
         // Center pixel "magnetism" indicator (requested):
         // User removed the ship center pixel from the sprite; we use it as a white
@@ -2007,16 +1975,11 @@ private:
     }
 
     void drawEnemy(MatrixPanel_I2S_DMA* display, int x, int y, int type) {
-        static constexpr uint8_t MUL_LUT[4] = { 0, 80, 160, 255 };
         const uint16_t c = ShooterGameConfig::ENEMY_COLORS[type & 3];
-        for (int yy = 0; yy < ENEMY_H; yy++) {
-            for (int xx = 0; xx < ENEMY_W; xx++) {
-                const uint8_t v = ShooterGameConfig::ENEMY_SPRITES[type & 3][yy][xx] & 3;
-                if (v == 0) continue;
-                const uint16_t col = (v == 3) ? c : dimColor(display, c, MUL_LUT[v]);
-                display->drawPixel(x + xx, y + yy, col);
-            }
-        }
+        const uint16_t pal[SpriteBlit::PALETTE_SIZE] = {
+            0, dimColor(display, c, 80), dimColor(display, c, 160), c
+        };
+        SpriteBlit::blit(display, ShooterGameConfig::ENEMY_SHEET, (size_t)(type & 3), x, y, pal);
 
         // Enemy HP pips: 4 pixels at the top of the enemy (above sprite if possible).
         // Stronger enemies (2..4 hp) show more pips.
@@ -2051,7 +2014,6 @@ private:
 
     void drawBoss(MatrixPanel_I2S_DMA* display, uint32_t now) {
         if (!boss.active) return;
-        static constexpr uint8_t MUL_LUT[4] = { 0, 80, 160, 255 };
         const int x0 = (int)boss.x;
         const int y0 = (int)boss.y;
         // Boss faces DOWN, so exhaust goes UP. Always on while boss is active.
@@ -2062,14 +2024,10 @@ private:
         const bool flash = ((int32_t)(boss.shieldFlashUntilMs - now) > 0);
         const uint16_t col = flash ? COLOR_WHITE : baseCol;
 
-        for (int y = 0; y < BOSS_H; y++) {
-            for (int x = 0; x < BOSS_W; x++) {
-                const uint8_t v = ShooterGameConfig::BOSS_SPRITES[boss.type % 5][y][x] & 3;
-                if (v == 0) continue;
-                const uint16_t col2 = (v == 3) ? col : dimColor(display, col, MUL_LUT[v]);
-                display->drawPixel(x0 + x, y0 + y, col2);
-            }
-        }
+        const uint16_t pal[SpriteBlit::PALETTE_SIZE] = {
+            0, dimColor(display, col, 80), dimColor(display, col, 160), col
+        };
+        SpriteBlit::blit(display, ShooterGameConfig::BOSS_SHEET, (size_t)(boss.type % 5), x0, y0, pal);
 
         // Boss shield ring (10 tiers max).
         if (boss.shieldTier > 0) {
@@ -2099,8 +2057,7 @@ private:
 
     void drawBossProjectiles(MatrixPanel_I2S_DMA* display, uint32_t now) {
         // Spinning stars (red)
-        for (int i = 0; i < MAX_STAR_SHOTS; i++) {
-            if (!starShots[i].active) continue;
+        for (uint16_t i = 0; i < starShots.size(); i++) {
             const int x = (int)starShots[i].x;
             const int y = (int)starShots[i].y;
             if (x < 1 || x >= PANEL_RES_X - 1 || y < 1 || y >= PANEL_RES_Y - 1) continue;
@@ -2123,8 +2080,7 @@ private:
         }
 
         // Guided rockets: 2px tall WHITE body (high visibility) + flickering flame.
-        for (int i = 0; i < MAX_ROCKETS; i++) {
-            if (!rockets[i].active) continue;
+        for (uint16_t i = 0; i < rockets.size(); i++) {
             const int x = (int)rockets[i].x;
             const int y = (int)rockets[i].y;
             if (x < 0 || x >= PANEL_RES_X || y < 0 || y >= PANEL_RES_Y) continue;
@@ -2143,8 +2099,7 @@ private:
         }
 
         // Player guided rockets (also 2px tall white body, with purple flame).
-        for (int i = 0; i < MAX_PLAYER_ROCKETS; i++) {
-            if (!playerRockets[i].active) continue;
+        for (uint16_t i = 0; i < playerRockets.size(); i++) {
             const int x = (int)playerRockets[i].x;
             const int y = (int)playerRockets[i].y;
             if (x < 0 || x >= PANEL_RES_X || y < 0 || y >= PANEL_RES_Y) continue;
@@ -2206,18 +2161,10 @@ private:
             COLOR_WHITE;
         // Render from sprite table so visuals are tweakable in `ShooterGameSprites.h`.
         const uint8_t t = (uint8_t)min<int>((int)ShooterGameConfig::POWERUP_TYPE_COUNT - 1, (int)type);
-        static constexpr uint8_t MUL_LUT[4] = { 0, 90, 170, 255 };
-        for (int yy = 0; yy < POWERUP_SIZE_PX; yy++) {
-            const int py = y + yy;
-            if (py < 0 || py >= PANEL_RES_Y) continue;
-            for (int xx = 0; xx < POWERUP_SIZE_PX; xx++) {
-                const int px = x + xx;
-                if (px < 0 || px >= PANEL_RES_X) continue;
-                const uint8_t v = ShooterGameConfig::POWERUP_SPRITES[t][yy][xx] & 3u;
-                if (v == 0) continue;
-                display->drawPixel(px, py, dimColor(display, c, MUL_LUT[v]));
-            }
-        }
+        const uint16_t pal[SpriteBlit::PALETTE_SIZE] = {
+            0, dimColor(display, c, 90), dimColor(display, c, 170), c
+        };
+        SpriteBlit::blit(display, ShooterGameConfig::POWERUP_SHEET, t, x, y, pal);
     }
 
     void drawHudStatus(MatrixPanel_I2S_DMA* display) {
@@ -2271,7 +2218,8 @@ public:
         bossDeathDamagedPlayer = false;
         playerDeathActive = false;
         spawnPauseUntilMs = 0;
-        for (int i = 0; i < MAX_ENEMIES; i++) enemies[i].alive = false;
+        enemies.clear();
+        resetPoolStats();
         
         // Apply current global player color (chosen in the main menu).
         player.color = globalSettings.getPlayerColor();
@@ -2309,13 +2257,11 @@ public:
         start();
     }
 
-    void update(ControllerManager* input) override {
+    uint16_t fixedStepMs() const override { return (uint16_t)UPDATE_INTERVAL_MS; }
+
+    void step(ControllerManager* input, uint32_t now, uint16_t dtMs) override {
+        (void)dtMs;
         if (gameOver) return;
-        
-        // Throttle updates
-        unsigned long now = millis();
-        if (now - lastUpdate < UPDATE_INTERVAL_MS) return;
-        lastUpdate = now;
 
         // Background always moves (nice parallax even during countdown/freeze).
         updateClouds((uint32_t)now);
@@ -2330,6 +2276,7 @@ public:
             if ((uint32_t)(now - phaseStartMs) >= GAME_OVER_FREEZE_MS) {
                 gameOver = true;
                 phase = PHASE_GAME_OVER;
+                logPoolStats();
             }
             return;
         }
@@ -2552,16 +2499,16 @@ public:
         // Final freeze: keep the last frame visible for a few seconds.
         if (phase == PHASE_GAME_OVER_DELAY) {
             // HUD stays visible while frozen.
-            SmallFont::drawStringF(display, 2, 6, COLOR_YELLOW, "S:%d", score);
-            SmallFont::drawStringF(display, 38, 6, COLOR_WHITE, "W:%d", level);
+            SmallFont::drawValue(display, 2, 6, COLOR_YELLOW, "S:", score);
+            SmallFont::drawValue(display, 38, 6, COLOR_WHITE, "W:", level);
             drawHudStatus(display);
             for (int x = 0; x < PANEL_RES_X; x += 2) display->drawPixel(x, HUD_H - 1, COLOR_BLUE);
 
             // Render frozen entities
-            for (int i = 0; i < MAX_ENEMIES; i++) if (enemies[i].alive) drawEnemy(display, enemies[i]);
-            for (int i = 0; i < MAX_POWERUPS; i++) if (powerups[i].active) drawPowerup(display, (int)powerups[i].x, (int)powerups[i].y, powerups[i].type);
-            for (int i = 0; i < MAX_PLAYER_BULLETS; i++) if (playerBullets[i].active) drawBullet(display, playerBullets[i], true);
-            for (int i = 0; i < MAX_ENEMY_BULLETS; i++) if (enemyBullets[i].active) drawBullet(display, enemyBullets[i], false);
+            for (uint16_t i = 0; i < enemies.size(); i++) drawEnemy(display, enemies[i]);
+            for (uint16_t i = 0; i < powerups.size(); i++) drawPowerup(display, Fixed::toInt(powerups[i].x), Fixed::toInt(powerups[i].y), powerups[i].type);
+            for (uint16_t i = 0; i < playerBullets.size(); i++) drawBullet(display, playerBullets[i], true);
+            for (uint16_t i = 0; i < enemyBullets.size(); i++) drawBullet(display, enemyBullets[i], false);
             // Player faces UP, so exhaust goes DOWN. Only on while "thrusters" are engaged.
             const bool thrOn = (fabsf(player.vx) > ShooterGameConfig::PLAYER_DRIFT_STOP_EPS) || (fabsf(player.vy) > ShooterGameConfig::PLAYER_DRIFT_STOP_EPS);
             drawThrusterBack(display, (int)player.x, (int)player.y, SHIP_W, SHIP_H, true, thrOn, now);
@@ -2584,8 +2531,8 @@ public:
         }
 
         // HUD (only for non-game-over screens)
-        SmallFont::drawStringF(display, 2, 6, COLOR_YELLOW, "S:%d", score);
-        SmallFont::drawStringF(display, 38, 6, COLOR_WHITE, "W:%d", level);
+        SmallFont::drawValue(display, 2, 6, COLOR_YELLOW, "S:", score);
+        SmallFont::drawValue(display, 38, 6, COLOR_WHITE, "W:", level);
         drawHudStatus(display);
         for (int x = 0; x < PANEL_RES_X; x += 2) display->drawPixel(x, HUD_H - 1, COLOR_BLUE);
 
@@ -2605,8 +2552,7 @@ public:
         }
 
         // Enemies
-        for (int i = 0; i < MAX_ENEMIES; i++) {
-            if (!enemies[i].alive) continue;
+        for (uint16_t i = 0; i < enemies.size(); i++) {
             drawEnemy(display, enemies[i]);
         }
 
@@ -2617,14 +2563,13 @@ public:
         drawPlayerDeathExplosion(display, now);
 
         // Powerups
-        for (int i = 0; i < MAX_POWERUPS; i++) {
-            if (!powerups[i].active) continue;
-            drawPowerup(display, (int)powerups[i].x, (int)powerups[i].y, powerups[i].type);
+        for (uint16_t i = 0; i < powerups.size(); i++) {
+            drawPowerup(display, Fixed::toInt(powerups[i].x), Fixed::toInt(powerups[i].y), powerups[i].type);
         }
 
         // Bullets
-        for (int i = 0; i < MAX_PLAYER_BULLETS; i++) if (playerBullets[i].active) drawBullet(display, playerBullets[i], true);
-        for (int i = 0; i < MAX_ENEMY_BULLETS; i++) if (enemyBullets[i].active) drawBullet(display, enemyBullets[i], false);
+        for (uint16_t i = 0; i < playerBullets.size(); i++) drawBullet(display, playerBullets[i], true);
+        for (uint16_t i = 0; i < enemyBullets.size(); i++) drawBullet(display, enemyBullets[i], false);
 
         // Player ship (shield shows blue outline)
         // Player faces UP, so exhaust goes DOWN. Only on while "thrusters" are engaged.
@@ -17,6 +17,8 @@
 
 #include <Arduino.h>
 #include "../../engine/config.h"
+#include "../../engine/SpriteBlit.h"
+#include "../../engine/FixedPoint.h"
 
 namespace ShooterGameConfig {
 
@@ -61,7 +63,7 @@ static constexpr uint8_t MAX_STAR_SHOTS     = 48;
 static constexpr uint8_t MAX_ROCKETS        = 8;
 static constexpr uint8_t MAX_PLAYER_ROCKETS = 2;
 static constexpr uint8_t MAX_EXPLOSIONS     = 10;
-static constexpr uint16_t MAX_PARTICLES     = 80;
+static constexpr uint16_t MAX_PARTICLES     = 80; // particle budget (engine/ParticleSystem.h)
 
 // -----------------------------------------------------------------------------
 // Player tuning
@@ -162,10 +164,11 @@ static constexpr float ENEMY_FIRE_P_MAX = 0.45f;
 // (The current implementation uses an integer roll against this.)
 static constexpr uint8_t POWERUP_DROP_CHANCE_PERCENT = 60;
 
-// Powerup physics (floaty / bouncy packs)
-static constexpr float POWERUP_GRAVITY = 0.012f;
-static constexpr float POWERUP_DRAG = 0.984f;
-static constexpr float POWERUP_BOUNCE = 0.78f;
+// Powerup physics (floaty / bouncy packs), Q16.16 fixed point (px per tick)
+static constexpr Fixed::q16 POWERUP_GRAVITY = Fixed::fromFloat(0.012f);
+static constexpr Fixed::q16 POWERUP_DRAG = Fixed::fromFloat(0.984f);
+static constexpr Fixed::q16 POWERUP_BOUNCE = Fixed::fromFloat(0.78f);
+static constexpr Fixed::q16 POWERUP_MAX_V = Fixed::fromFloat(0.85f); // per-axis safety clamp
 static constexpr uint8_t POWERUP_SIZE_PX = 2; // drawn as 2x2 box
 
 // Powerup types (ShooterGame.h uses these numeric IDs).
@@ -204,8 +207,8 @@ static constexpr uint8_t CYAN_SCORE_MULT = 2;
 // - Tier 0 = no attraction, tier 5 = strong attraction (slightly stronger than gravity).
 static constexpr uint8_t CYAN_TIER_MAX = 5;
 // Tier 5 strength (requested): 4x stronger vs previous tuning.
-static constexpr float CYAN_MAGNET_ACCEL_MAX_AT_TIER5 = POWERUP_GRAVITY * 4.80f; // ~= 4x (was 1.20x)
-static constexpr float CYAN_MAGNET_K_AT_TIER5 = 0.00280f; // ~= 4x (was 0.00070)
+static constexpr Fixed::q16 CYAN_MAGNET_ACCEL_MAX_AT_TIER5 = Fixed::mul(POWERUP_GRAVITY, Fixed::fromFloat(4.80f)); // ~= 4x (was 1.20x)
+static constexpr Fixed::q16 CYAN_MAGNET_K_AT_TIER5 = Fixed::fromFloat(0.00280f); // ~= 4x (was 0.00070)
 
 // Normal enemy drop weights (sum doesn't need to be 100, it's normalized by cumulative checks).
 // White is handled as a weight here but still only appears via normal drops (not boss loot).
@@ -241,12 +244,12 @@ static constexpr uint16_t BOSS_LOOT_GRACE_MS = 1000;      // pause after loot to
 // Notes:
 // - VY is typically slightly negative at spawn (kicks upward a bit), then gravity takes over.
 // - VX is kept within the same safety clamps used for normal powerups.
-static constexpr float BOSS_LOOT_VX_SPREAD = 0.75f;      // overall left/right fan-out (base)
-static constexpr float BOSS_LOOT_VX_JITTER = 0.22f;      // per-item randomness added to VX
-static constexpr float BOSS_LOOT_VY_BASE_MIN = -0.16f;   // base upward kick range (more negative = more upward)
-static constexpr float BOSS_LOOT_VY_BASE_MAX = -0.06f;
-static constexpr float BOSS_LOOT_VY_JITTER = 0.04f;      // per-item randomness added to VY
-static constexpr float BOSS_LOOT_POS_JITTER_PX = 2.0f;   // small spawn position jitter around the boss center (pixels)
+static constexpr Fixed::q16 BOSS_LOOT_VX_SPREAD = Fixed::fromFloat(0.75f);      // overall left/right fan-out (base)
+static constexpr Fixed::q16 BOSS_LOOT_VX_JITTER = Fixed::fromFloat(0.22f);      // per-item randomness added to VX
+static constexpr Fixed::q16 BOSS_LOOT_VY_BASE_MIN = Fixed::fromFloat(-0.16f);   // base upward kick range (more negative = more upward)
+static constexpr Fixed::q16 BOSS_LOOT_VY_BASE_MAX = Fixed::fromFloat(-0.06f);
+static constexpr Fixed::q16 BOSS_LOOT_VY_JITTER = Fixed::fromFloat(0.04f);      // per-item randomness added to VY
+static constexpr Fixed::q16 BOSS_LOOT_POS_JITTER_PX = Fixed::fromFloat(2.0f);   // small spawn position jitter around the boss center (pixels)
 
 // Player death explosion (final death): show a big explosion animation, then game over screen.
 static constexpr uint16_t PLAYER_DEATH_EXPLOSION_MS = 3000;
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "../../engine/config.h" // COLOR_* constants
+#include "../../engine/SpriteBlit.h"
 #include <Arduino.h>
 
 // -----------------------------------------------------------------------------
@@ -256,4 +257,12 @@ static inline constexpr uint16_t BOSS_COLORS[5] = {
     COLOR_MAGENTA
 };
 
-
+// -----------------------------------------------------------------------------
+// Compiled span sheets (built from the tables above at compile time; see engine/SpriteBlit.h)
+// -----------------------------------------------------------------------------
+static inline constexpr auto CLOUD_SHEET =
+    SpriteBlit::compile<SpriteBlit::countRuns(CLOUD_SPRITES, CLOUD_W, CLOUD_H)>(CLOUD_SPRITES, CLOUD_W, CLOUD_H);
+static inline constexpr auto POWERUP_SHEET = SpriteBlit::compile<SpriteBlit::countRuns(POWERUP_SPRITES)>(POWERUP_SPRITES);
+static inline constexpr auto SHIP_SHEET = SpriteBlit::compile<SpriteBlit::countRuns(SHIP_SPRITE)>(SHIP_SPRITE);
+static inline constexpr auto ENEMY_SHEET = SpriteBlit::compile<SpriteBlit::countRuns(ENEMY_SPRITES)>(ENEMY_SPRITES);
+static inline constexpr auto BOSS_SHEET = SpriteBlit::compile<SpriteBlit::countRuns(BOSS_SPRITES)>(BOSS_SPRITES);
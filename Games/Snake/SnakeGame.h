@@ -6,7 +6,10 @@
 #include "../../engine/ControllerManager.h"
 #include "../../engine/config.h"
 #include "../../engine/AudioManager.h"
+#include "../../engine/GridBitset.h"
+#include "../../engine/GridSearch.h"
 #include "../../component/SmallFont.h"
+#include "../../component/TileLayer.h"
 #include "../../engine/Settings.h"
 #include "../../engine/UserProfiles.h"
 #include "../../component/GameOverLeaderboardView.h"
@@ -122,6 +125,7 @@ public:
     uint32_t deathStartMs;
     int score;
     int playerIndex;
+    bool isAi;     // CPU opponent (no controller; see SnakeGame::planAiMove)
 
     // Nokia-style "digesting bulge": when the snake eats, a bright segment travels down the body.
     // bulgeIndex is the segment index in `body` (0=head). -1 means no bulge active.
@@ -137,6 +141,7 @@ public:
         deathStartMs(0),
         score(0),
         playerIndex(-1),
+        isAi(false),
         bulgeIndex(-1) {
         body.clear();
     }
@@ -152,6 +157,7 @@ public:
         enabled = false;
         alive = false;
         dying = false;
+        isAi = false;
         deathStartMs = 0;
         score = 0;
         bulgeIndex = -1;
@@ -256,10 +262,44 @@ public:
 
 class SnakeGame : public GameBase {
 private:
+    typedef GridBitset<LOGICAL_WIDTH, LOGICAL_HEIGHT> CellGrid;
+
     Snake snakes[SnakeGameConfig::MAX_SNAKES];
     FoodItem foods[SnakeGameConfig::MAX_FOODS];
     uint8_t foodCount = 0;
+
+    // Cells covered by ALIVE snake bodies (the collision obstacles). Kept in sync with each
+    // move (tail vacate / head advance) and rebuilt when a snake dies or spawns.
+    // Alive bodies never overlap, so one bit per cell is exact.
+    CellGrid occupied;
+
+    // Retained board view: what each cell shows (tile codes below). Ticks only restamp
+    // the cells they change (head, neck, tail, bulge, food) and `boardLayer` repaints just
+    // those; full repaints happen on round start, deaths, phase changes and canvas loss.
+    // Only food and ALIVE snakes are in the view: corpses overlap live snakes (a crashed
+    // head sits on the body it hit, live snakes cross corpses), so draw() blinks them on top.
+    enum : uint8_t {
+        TILE_EMPTY = 0,
+        TILE_BODY = 1,                                        // + snake index: striped segment
+        TILE_SOLID = TILE_BODY + SnakeGameConfig::MAX_SNAKES, // + snake index: neck / bulge
+        TILE_HEAD = TILE_SOLID + SnakeGameConfig::MAX_SNAKES, // + snake index
+        TILE_FOOD = TILE_HEAD + SnakeGameConfig::MAX_SNAKES   // + kind * 4 + quadrant (dy * 2 + dx)
+    };
+    uint8_t view[LOGICAL_HEIGHT][LOGICAL_WIDTH];
+    TileLayer<LOGICAL_WIDTH, LOGICAL_HEIGHT> boardLayer;
     uint8_t playerCountAtStart = 0;
+    bool cpuOpponents = false; // humans played against CPU snakes this round (no leaderboard)
+
+public:
+    /** CPU planning counters (host AI benchmark). */
+    struct AiStats {
+        uint32_t plans = 0;
+        uint32_t cutoffs = 0;   // plans that hit their work budget
+        uint32_t maxPlanWork = 0; // row words (GridSearch::WorkBudget)
+    };
+
+private:
+    AiStats aiCounters;
     unsigned long lastMove;
     bool gameOver;
 
@@ -357,7 +397,7 @@ private:
      * - `globalAudio` internally respects Settings.soundEnabled + volume.
      */
     static inline void playMoveSfxIfAllowed(const Snake& s) {
-        if (s.playerIndex != 0) return;                // minimal: only Player 1
+        if (s.playerIndex != 0 || s.isAi) return;      // minimal: only Player 1
         if (s.dir == UP || s.dir == LEFT) return;      // explicit: no sound for UP/LEFT
         if (s.dir != RIGHT && s.dir != DOWN) return;   // ignore NONE/unknown
 
@@ -365,87 +405,290 @@ private:
         globalAudio.playTone(1320 /*Hz*/, 8 /*ms*/);
     }
 
-    void spawnFood(FoodKind kind = FOOD_APPLE) {
-        bool ok;
-        FoodItem f;
-        do {
-            ok = true;
-            uint8_t w = 2, h = 2;
-            foodDims(kind, w, h);
-            f.wCells = w;
-            f.hCells = h;
-
-            // Keep within bounds for a multi-cell hitbox.
-            f.p.x = (int16_t)random(0, max(1, LOGICAL_WIDTH - (int)w));
-            f.p.y = (int16_t)random(0, max(1, LOGICAL_HEIGHT - (int)h));
-            f.kind = kind;
-            const uint32_t ttl = ttlForFoodMs(kind);
-            f.expireMs = (ttl == 0) ? 0 : (millis() + ttl);
+    // ---------------------------------------------------------
+    // Board view (retained rendering)
+    // ---------------------------------------------------------
+    void setView(int x, int y, uint8_t tile) {
+        if (view[y][x] == tile) return;
+        view[y][x] = tile;
+        boardLayer.markDirty(x, y);
+    }
 
-            for (uint8_t si = 0; si < SnakeGameConfig::MAX_SNAKES; si++) {
-                Snake& s = snakes[si];
-                if (!s.enabled) continue;
-                for (uint16_t bi = 0; bi < s.body.size(); bi++) {
-                    const Point& p = s.body.at(bi);
-                    if (pointInFood(f, p)) { ok = false; break; }
-                }
-                if (!ok) break;
+    static uint8_t segmentTile(const Snake& s, uint8_t si, uint16_t idx) {
+        if (idx == 0) return (uint8_t)(TILE_HEAD + si);
+        if (idx == 1 || (int)idx == s.bulgeIndex) return (uint8_t)(TILE_SOLID + si);
+        return (uint8_t)(TILE_BODY + si);
+    }
+
+    void stampSegment(uint8_t si, uint16_t idx) {
+        const Snake& s = snakes[si];
+        if (idx >= s.body.size()) return;
+        const Point& p = s.body.at(idx);
+        setView(p.x, p.y, segmentTile(s, si, idx));
+    }
+
+    // After a move only the front changes look: new head, old head -> neck, old neck -> body.
+    // (The bulge index advances with the body, so it stays on the same cell.)
+    void stampSnakeFront(uint8_t si) {
+        for (uint16_t idx = 0; idx < 3; idx++) stampSegment(si, idx);
+        if (snakes[si].bulgeIndex >= 0) stampSegment(si, (uint16_t)snakes[si].bulgeIndex);
+    }
+
+    void stampFood(const FoodItem& f) {
+        for (uint8_t dy = 0; dy < f.hCells; dy++) {
+            for (uint8_t dx = 0; dx < f.wCells; dx++) {
+                setView(f.p.x + dx, f.p.y + dy, (uint8_t)(TILE_FOOD + (uint8_t)f.kind * 4 + dy * 2 + dx));
             }
+        }
+    }
 
-            for (uint8_t ei = 0; ei < foodCount; ei++) {
-                const FoodItem& existing = foods[ei];
-                // Overlap test.
-                for (int yy = 0; yy < (int)f.hCells; yy++) {
-                    for (int xx = 0; xx < (int)f.wCells; xx++) {
-                        Point c{f.p.x + xx, f.p.y + yy};
-                        if (pointInFood(existing, c)) { ok = false; break; }
-                    }
-                    if (!ok) break;
-                }
-                if (!ok) break;
+    // Only cells still showing food are cleared (a head may already sit on one of them).
+    void eraseFood(const FoodItem& f) {
+        for (uint8_t dy = 0; dy < f.hCells; dy++) {
+            for (uint8_t dx = 0; dx < f.wCells; dx++) {
+                if (view[f.p.y + dy][f.p.x + dx] >= TILE_FOOD) setView(f.p.x + dx, f.p.y + dy, TILE_EMPTY);
             }
-        } while (!ok);
+        }
+    }
 
-        if (foodCount < SnakeGameConfig::MAX_FOODS) {
-            foods[foodCount++] = f;
+    // Whole view from the game state (food + alive snakes).
+    void rebuildView() {
+        memset(view, TILE_EMPTY, sizeof(view));
+        for (uint8_t fi = 0; fi < foodCount; fi++) stampFood(foods[fi]);
+        for (uint8_t si = 0; si < SnakeGameConfig::MAX_SNAKES; si++) {
+            if (!snakes[si].enabled || !snakes[si].alive) continue;
+            for (uint16_t idx = snakes[si].body.size(); idx-- > 0;) stampSegment(si, idx);
+        }
+        boardLayer.invalidate();
+    }
+
+    // Lighter stripe color (blend towards white, but keep hue).
+    static uint16_t lighten565(uint16_t c, uint8_t alpha /*0..255*/) {
+        uint8_t r = (uint8_t)((c >> 11) & 0x1F);
+        uint8_t g = (uint8_t)((c >> 5) & 0x3F);
+        uint8_t b = (uint8_t)(c & 0x1F);
+        r = (uint8_t)(r + ((31 - r) * alpha) / 255);
+        g = (uint8_t)(g + ((63 - g) * alpha) / 255);
+        b = (uint8_t)(b + ((31 - b) * alpha) / 255);
+        return (uint16_t)((r << 11) | (g << 5) | b);
+    }
+
+    // True when, in snake index order (later snakes on top, tail over head), a live snake
+    // drawn after snake `si` covers cell (x, y) -- i.e. the view shows snake >= si there.
+    bool coveredByLaterSnake(uint8_t si, int x, int y) const {
+        if (x < 0 || y < 0 || x >= LOGICAL_WIDTH || y >= LOGICAL_HEIGHT) return false;
+        const uint8_t tile = view[y][x];
+        if (tile < TILE_BODY || tile >= TILE_FOOD) return false;
+        return (uint8_t)((tile - TILE_BODY) % SnakeGameConfig::MAX_SNAKES) >= si;
+    }
+
+    static void drawBoardCell(void* ctx, MatrixPanel_I2S_DMA* display, int cx, int cy, int px, int py, int size, uint8_t tile) {
+        static_cast<const SnakeGame*>(ctx)->drawCell(display, cx, cy, px, py, size, tile);
+    }
+
+    // One 2x2 cell of the board (Nokia style: striped body, solid neck / bulge, head with eyes).
+    void drawCell(MatrixPanel_I2S_DMA* display, int cx, int cy, int px, int py, int size, uint8_t tile) const {
+        if (tile == TILE_EMPTY) {
+            display->fillRect(px, py, size, size, COLOR_BLACK);
+            return;
+        }
+
+        if (tile >= TILE_FOOD) {
+            const uint8_t code = (uint8_t)(tile - TILE_FOOD);
+            const FoodKind kind = (FoodKind)(code >> 2);
+            display->fillRect(px, py, size, size, COLOR_BLACK);
+            if (kind == FOOD_APPLE) {
+                // Smaller apple: 2x2 pixels (1x1 logical cell) for tighter hitbox.
+                display->fillRect(px, py, size, size, COLOR_RED);
+                return;
+            }
+            // Creatures: 4x4 sprite over 2x2 cells; this cell shows its quadrant.
+            const int ox = px - (code & 1) * PIXEL_SIZE;
+            const int oy = py - ((code >> 1) & 1) * PIXEL_SIZE;
+            const SpriteBlit::ClipRect clip = { (int16_t)px, (int16_t)py, (int16_t)(px + size), (int16_t)(py + size) };
+            const uint16_t col = foodColor(kind);
+            const uint16_t pal[SpriteBlit::PALETTE_SIZE] = { 0, col, col, col };
+            SpriteBlit::blit(display, SnakeGameConfig::FOOD_SHEET_4X4, (size_t)kind, ox, oy, pal, 0, 255, clip);
+            return;
+        }
+
+        const uint8_t si = (uint8_t)((tile - TILE_BODY) % SnakeGameConfig::MAX_SNAKES);
+        const Snake& s = snakes[si];
+        const uint16_t baseCol = s.color;
+        display->fillRect(px, py, size, size, baseCol);
+
+        if (tile >= TILE_HEAD) {
+            // Eyes (2 pixels) based on direction
+            const uint16_t eye = COLOR_WHITE;
+            if (s.dir == UP) {
+                display->drawPixel(px, py, eye);
+                display->drawPixel(px + 1, py, eye);
+            } else if (s.dir == DOWN) {
+                display->drawPixel(px, py + 1, eye);
+                display->drawPixel(px + 1, py + 1, eye);
+            } else if (s.dir == LEFT) {
+                display->drawPixel(px, py, eye);
+                display->drawPixel(px, py + 1, eye);
+            } else if (s.dir == RIGHT) {
+                display->drawPixel(px + 1, py, eye);
+                display->drawPixel(px + 1, py + 1, eye);
+            }
+            return;
+        }
+        // Neck (solid, makes the head feel larger) and bulge: no stripes.
+        if (tile >= TILE_SOLID) return;
+
+        // Striped body (Nokia Snake 2 style):
+        // Stationary diagonal stripes anchored to the grid position so they do NOT
+        // "crawl" or flicker as the snake moves. Alternate \ and / by (cellX + cellY).
+        const uint16_t stripeCol = lighten565(baseCol, 110); // ~43% towards white
+        if (((cx + cy) & 1) == 0) {
+            display->drawPixel(px, py, stripeCol);
+            display->drawPixel(px + 1, py + 1, stripeCol);
         } else {
-            // Shouldn't happen because we keep foodCount capped, but guard anyway.
-            foods[random(0, (int)SnakeGameConfig::MAX_FOODS)] = f;
+            display->drawPixel(px + 1, py, stripeCol);
+            display->drawPixel(px, py + 1, stripeCol);
         }
     }
 
-public:
-    SnakeGame() {
-        lastMove = 0;
-        gameOver = false;
-        phase = PHASE_COUNTDOWN;
-        phaseStartMs = 0;
-        foodCount = 0;
-        playerCountAtStart = 0;
-        for (uint8_t i = 0; i < SnakeGameConfig::MAX_SNAKES; i++) snakes[i].disable();
+    // ---------------------------------------------------------
+    // CPU snakes
+    // ---------------------------------------------------------
+    static Point stepCell(Point p, Direction d) {
+        if (d == UP) p.y--;
+        else if (d == DOWN) p.y++;
+        else if (d == LEFT) p.x--;
+        else if (d == RIGHT) p.x++;
+        if (p.x < 0) p.x = (int16_t)(LOGICAL_WIDTH - 1);
+        else if (p.x >= LOGICAL_WIDTH) p.x = 0;
+        if (p.y < 0) p.y = (int16_t)(LOGICAL_HEIGHT - 1);
+        else if (p.y >= LOGICAL_HEIGHT) p.y = 0;
+        return p;
     }
 
     /**
-     * Snake updates at a fixed tick rate (`SnakeGameConfig::MOVE_TICK_MS`).
-     * Rendering faster than that doesn't improve gameplay, but it *does*
-     * increase display bandwidth and can surface HUB75 ghosting artifacts on
-     * some panels (especially with lots of black background).
+     * CPU snake: choose `nextDir` for this tick.
+     * 1. Options: the three non-reversing moves onto free cells (the own tail counts as
+     *    free: it moves away this tick). Cells another head can enter are "risky".
+     * 2. Survival: flood fill from each option; it is safe when it still reaches as many
+     *    cells as the snake is long (no pocket it cannot leave again).
+     * 3. Food: one BFS wave from all food cells; the option it reaches first lies on a
+     *    shortest path to the nearest food.
+     * Pick: safe > not risky > closer to food > straight on > more room. Every search
+     * stops when `budget` runs out; options it did not finish keep what was found so far.
      */
-    uint16_t preferredRenderFps() const override {
-        if (SnakeGameConfig::MOVE_TICK_MS == 0) return GAME_RENDER_FPS;
-        uint16_t fps = (uint16_t)(1000UL / (uint32_t)SnakeGameConfig::MOVE_TICK_MS);
-        if (fps < 10) fps = 10; // keep UI responsive / flashing visible
-        if (fps > GAME_RENDER_FPS) fps = GAME_RENDER_FPS;
-        return fps;
+    void planAiMove(Snake& s, GridSearch::WorkBudget& budget) {
+        typedef GridSearch::Wavefront<LOGICAL_WIDTH, LOGICAL_HEIGHT> Wave;
+        static constexpr uint16_t NO_PATH = 0xFFFF;
+        const uint32_t startWork = budget.remaining();
+
+        CellGrid passable;
+        for (uint8_t y = 0; y < LOGICAL_HEIGHT; y++) passable.setRow(y, (CellGrid::Row)~occupied.row(y));
+        const Point tail = s.body.tail();
+        passable.set(tail.x, tail.y);
+
+        CellGrid risky;
+        for (uint8_t si = 0; si < SnakeGameConfig::MAX_SNAKES; si++) {
+            const Snake& o = snakes[si];
+            if (&o == &s || !o.enabled || !o.alive) continue;
+            for (uint8_t d = UP; d <= RIGHT; d++) {
+                const Point c = stepCell(o.body.head(), (Direction)d);
+                risky.set(c.x, c.y);
+            }
+        }
+
+        struct Option {
+            Direction dir;
+            Point cell;
+            bool risky;
+            uint16_t space;
+            uint16_t foodDist;
+        };
+        Option opts[3];
+        uint8_t n = 0;
+        for (uint8_t d = UP; d <= RIGHT; d++) {
+            if (Snake::isOpposite(s.dir, (Direction)d)) continue;
+            const Point c = stepCell(s.body.head(), (Direction)d);
+            if (!passable.test(c.x, c.y)) continue;
+            opts[n++] = { (Direction)d, c, risky.test(c.x, c.y), 0, NO_PATH };
+        }
+        if (n == 0) return; // boxed in: nothing saves this snake
+
+        // 2) Survival (reachable area, capped at what the body needs).
+        const uint16_t need = s.body.size();
+        for (uint8_t i = 0; i < n && !budget.exhausted(); i++) {
+            opts[i].space = GridSearch::floodCount(passable, opts[i].cell.x, opts[i].cell.y, true, need, budget);
+        }
+
+        // 3) Distance to the nearest food for every option, from one wave.
+        if (foodCount > 0 && !budget.exhausted()) {
+            CellGrid seeds;
+            for (uint8_t fi = 0; fi < foodCount; fi++) seeds.setBox(foods[fi].p.x, foods[fi].p.y, foods[fi].wCells, foods[fi].hCells);
+            Wave wave;
+            wave.start(seeds);
+            uint8_t pending = n;
+            while (true) {
+                for (uint8_t i = 0; i < n; i++) {
+                    if (opts[i].foodDist == NO_PATH && wave.reached.test(opts[i].cell.x, opts[i].cell.y)) {
+                        opts[i].foodDist = wave.steps;
+                        pending--;
+                    }
+                }
+                if (pending == 0 || wave.steps >= SnakeGameConfig::AI_MAX_FOOD_STEPS) break;
+                if (!budget.spend(LOGICAL_HEIGHT) || !wave.grow(passable, true)) break;
+            }
+        }
+
+        uint8_t best = 0;
+        for (uint8_t i = 1; i < n; i++) {
+            const Option& a = opts[i];
+            const Option& b = opts[best];
+            const bool aSafe = a.space >= need;
+            const bool bSafe = b.space >= need;
+            bool better;
+            if (aSafe != bSafe) better = aSafe;
+            else if (a.risky != b.risky) better = !a.risky;
+            else if (!aSafe) better = a.space > b.space; // doomed either way: most room
+            else if (a.foodDist != b.foodDist) better = a.foodDist < b.foodDist;
+            else if ((a.dir == s.dir) != (b.dir == s.dir)) better = (a.dir == s.dir);
+            else better = a.space > b.space;
+            if (better) best = i;
+        }
+        s.nextDir = opts[best].dir;
+
+        const uint32_t work = startWork - budget.remaining();
+        aiCounters.plans++;
+        if (budget.exhausted()) aiCounters.cutoffs++;
+        if (work > aiCounters.maxPlanWork) aiCounters.maxPlanWork = work;
     }
 
-    void start() override {
+    // The round ends once every human snake is done (dead and finished blinking);
+    // CPU-only rounds (host AI benchmark) once every snake is.
+    bool roundFinished() const {
+        bool anyHuman = false;
+        bool humanLeft = false;
+        bool anyLeft = false;
+        for (uint8_t si = 0; si < SnakeGameConfig::MAX_SNAKES; si++) {
+            const Snake& s = snakes[si];
+            if (!s.enabled) continue;
+            const bool left = s.alive || s.dying;
+            anyLeft = anyLeft || left;
+            if (!s.isAi) {
+                anyHuman = true;
+                humanLeft = humanLeft || left;
+            }
+        }
+        return anyHuman ? !humanLeft : !anyLeft;
+    }
+
+    void startRound(bool aiOnly) {
         gameOver = false;
         phase = PHASE_COUNTDOWN;
         phaseStartMs = millis();
         lastMove = phaseStartMs;
         foodCount = 0;
         playerCountAtStart = 0;
+        cpuOpponents = false;
 
         for (uint8_t i = 0; i < SnakeGameConfig::MAX_SNAKES; i++) snakes[i].disable();
 
@@ -454,22 +697,144 @@ public:
         playerColors[0] = globalSettings.getPlayerColor();
 
         // Create snakes first so food never spawns on top of a snake on round start.
+        uint8_t humans = 0;
         for (int i = 0; i < MAX_GAMEPADS; i++) {
-            if (globalControllerManager->getController(i)) {
+            if (aiOnly || globalControllerManager->getController(i)) {
                 snakes[i].init(
                     i,
                     (int)(LOGICAL_WIDTH / 2 + i * 2),
                     (int)(LOGICAL_HEIGHT / 2),
                     playerColors[i]
                 );
+                snakes[i].isAi = aiOnly;
+                if (!aiOnly) humans++;
+                playerCountAtStart++;
+            }
+        }
+
+        // Single-player: CPU opponents in the first free slots.
+        if (humans == 1) {
+            uint8_t added = 0;
+            for (int i = 0; i < MAX_GAMEPADS && added < SnakeGameConfig::SINGLE_PLAYER_AI_SNAKES; i++) {
+                if (snakes[i].enabled) continue;
+                snakes[i].init(i, (int)(LOGICAL_WIDTH / 2 + i * 2), (int)(LOGICAL_HEIGHT / 2), playerColors[i]);
+                snakes[i].isAi = true;
                 playerCountAtStart++;
+                added++;
+                cpuOpponents = true;
             }
         }
+        rebuildOccupancy();
+        rebuildView();
 
         // Spawn multiple foods after snakes exist (so spawnFood() can avoid them).
         for (uint8_t i = 0; i < SnakeGameConfig::MAX_FOODS; i++) spawnFood(chooseNextFoodKind());
     }
 
+    void rebuildOccupancy() {
+        occupied.clear();
+        for (uint8_t si = 0; si < SnakeGameConfig::MAX_SNAKES; si++) {
+            const Snake& s = snakes[si];
+            if (!s.enabled || !s.alive) continue;
+            for (uint16_t bi = 0; bi < s.body.size(); bi++) occupied.set(s.body.at(bi).x, s.body.at(bi).y);
+        }
+    }
+
+    /**
+     * Place a food uniformly over every position where its hitbox is clear of snakes
+     * (corpses included) and other foods: build the blocked mask, mark the fitting
+     * top-left cells, pick one by rank. No retries, so a crowded board costs the same.
+     * Returns false when nothing fits (the food is skipped).
+     */
+    bool spawnFood(FoodKind kind = FOOD_APPLE) {
+        FoodItem f;
+        uint8_t w = 2, h = 2;
+        foodDims(kind, w, h);
+        f.wCells = w;
+        f.hCells = h;
+        f.kind = kind;
+        const uint32_t ttl = ttlForFoodMs(kind);
+        f.expireMs = (ttl == 0) ? 0 : (millis() + ttl);
+
+        CellGrid blocked = occupied;
+        for (uint8_t si = 0; si < SnakeGameConfig::MAX_SNAKES; si++) {
+            const Snake& s = snakes[si];
+            if (!s.enabled || s.alive) continue; // alive bodies are already in `occupied`
+            for (uint16_t bi = 0; bi < s.body.size(); bi++) blocked.set(s.body.at(bi).x, s.body.at(bi).y);
+        }
+        for (uint8_t ei = 0; ei < foodCount; ei++) {
+            const FoodItem& existing = foods[ei];
+            blocked.setBox(existing.p.x, existing.p.y, existing.wCells, existing.hCells);
+        }
+
+        // Same top-left range as before: x < LOGICAL_WIDTH - w, y < LOGICAL_HEIGHT - h.
+        CellGrid fits;
+        CellGrid::freeBoxes(blocked, w, h,
+                            (uint8_t)max(1, LOGICAL_WIDTH - (int)w), (uint8_t)max(1, LOGICAL_HEIGHT - (int)h), fits);
+        const uint16_t choices = fits.count();
+        if (choices == 0) return false;
+        if (!fits.pickSet((uint16_t)random(0, (long)choices), f.p.x, f.p.y)) return false;
+
+        if (foodCount < SnakeGameConfig::MAX_FOODS) {
+            foods[foodCount++] = f;
+        } else {
+            // Shouldn't happen because we keep foodCount capped, but guard anyway.
+            FoodItem& replaced = foods[random(0, (int)SnakeGameConfig::MAX_FOODS)];
+            eraseFood(replaced);
+            replaced = f;
+        }
+        stampFood(f);
+        return true;
+    }
+
+public:
+    SnakeGame() {
+        lastMove = 0;
+        gameOver = false;
+        phase = PHASE_COUNTDOWN;
+        phaseStartMs = 0;
+        foodCount = 0;
+        playerCountAtStart = 0;
+        for (uint8_t i = 0; i < SnakeGameConfig::MAX_SNAKES; i++) snakes[i].disable();
+        memset(view, TILE_EMPTY, sizeof(view));
+        boardLayer.attach(&view[0][0], LOGICAL_WIDTH, LOGICAL_HEIGHT, LOGICAL_WIDTH, PIXEL_SIZE,
+                          PLAYFIELD_CONTENT_X, PLAYFIELD_CONTENT_Y);
+        boardLayer.setTileDrawer(&drawBoardCell, this);
+    }
+
+    /**
+     * Snake updates at a fixed tick rate (`SnakeGameConfig::MOVE_TICK_MS`).
+     * Rendering faster than that doesn't improve gameplay, but it *does*
+     * increase display bandwidth and can surface HUB75 ghosting artifacts on
+     * some panels (especially with lots of black background).
+     */
+    // One frame per move tick (min 10 FPS keeps UI responsive / flashing visible).
+    static constexpr uint16_t RENDER_FPS = renderFpsForTickMs(SnakeGameConfig::MOVE_TICK_MS);
+    uint16_t preferredRenderFps() const override { return RENDER_FPS; }
+
+    void start() override {
+        startRound(false);
+    }
+
+    /** Round with a CPU snake in every slot and no humans (host AI benchmark). */
+    void startAiMatch() {
+        startRound(true);
+    }
+
+    const AiStats& aiStats() const { return aiCounters; }
+
+    /** Best individual score of the round; `includeAi` counts CPU snakes too. */
+    int bestScore(bool includeAi) const {
+        int best = 0;
+        for (const auto& s : snakes) {
+            if (!s.enabled || (s.isAi && !includeAi)) continue;
+            if (s.score > best) best = s.score;
+        }
+        return best;
+    }
+
+    void onCanvasLost() override { boardLayer.invalidate(); }
+
     void reset() override {
         start();
     }
@@ -482,6 +847,7 @@ public:
         for (uint8_t i = 0; i < foodCount;) {
             if (foods[i].kind != FOOD_APPLE && foods[i].expireMs != 0 && (int32_t)(foods[i].expireMs - now) <= 0) {
                 // Remove by shifting down.
+                eraseFood(foods[i]);
                 for (uint8_t j = i + 1; j < foodCount; j++) foods[j - 1] = foods[j];
                 if (foodCount > 0) foodCount--;
                 spawnFood(chooseNextFoodKind());
@@ -496,6 +862,8 @@ public:
             if (!s.enabled) continue;
             if (s.dying && (uint32_t)(now - s.deathStartMs) >= DEATH_BLINK_TOTAL_MS) {
                 s.dying = false;
+                // The view never held the corpse; just repaint what it was blinking over.
+                for (uint16_t idx = 0; idx < s.body.size(); idx++) boardLayer.markDirty(s.body.at(idx).x, s.body.at(idx).y);
                 s.body.clear();
             }
         }
@@ -505,33 +873,24 @@ public:
         // Otherwise, when the last snake finishes its death blink, it becomes
         // (!alive && !dying) and is excluded from the active list, causing an
         // early return that would prevent GAME OVER from ever being set.
-        if (phase != PHASE_GAME_OVER && playerCountAtStart > 0) {
-            bool anyAlive = false;
-            bool anyDying = false;
-            for (uint8_t si = 0; si < SnakeGameConfig::MAX_SNAKES; si++) {
-                Snake& s = snakes[si];
-                if (!s.enabled) continue;
-                if (s.alive) anyAlive = true;
-                if (s.dying) anyDying = true;
-            }
-            if (!anyAlive && !anyDying) {
-                phase = PHASE_GAME_OVER;
-                gameOver = true;
-                return;
-            }
+        if (phase != PHASE_GAME_OVER && playerCountAtStart > 0 && roundFinished()) {
+            phase = PHASE_GAME_OVER;
+            gameOver = true;
+            return;
         }
 
         // Countdown before starting movement (still accept input so players can buffer a direction)
         if (phase == PHASE_COUNTDOWN) {
             for (uint8_t si = 0; si < SnakeGameConfig::MAX_SNAKES; si++) {
                 Snake& s = snakes[si];
-                if (!s.enabled || !s.alive) continue;
+                if (!s.enabled || !s.alive || s.isAi) continue;
                 ControllerPtr ctl = input->getController(s.playerIndex);
                 if (ctl) s.handleInput(ctl);
             }
             if ((uint32_t)(now - phaseStartMs) >= COUNTDOWN_MS) {
                 phase = PHASE_PLAYING;
                 lastMove = now;
+                boardLayer.invalidate();
             }
             return;
         }
@@ -564,19 +923,37 @@ public:
         for (uint8_t i = 0; i < n; i++) foodHitIndex[i] = -1;
 
         // 1) Inputs + next heads
+        // CPU snakes share AI_TICK_BUDGET_US (as work, see GridSearch::WorkBudget); each
+        // gets a slice (plus what earlier ones left).
+        uint8_t aiLeft = 0;
+        for (uint8_t i = 0; i < n; i++) {
+            if (snakes[activeIdx[i]].alive && snakes[activeIdx[i]].isAi) aiLeft++;
+        }
+        GridSearch::WorkBudget aiBudget(GridSearch::WorkBudget::fromUs(SnakeGameConfig::AI_TICK_BUDGET_US));
+        bool occupancyStale = false;
+        bool viewStale = false;
         for (uint8_t i = 0; i < n; i++) {
             Snake& s = snakes[activeIdx[i]];
             if (!s.alive) continue;
 
-            ControllerPtr ctl = input->getController(s.playerIndex);
-            if (!ctl) {
-                s.alive = false;
-                s.dying = true;
-                s.deathStartMs = now;
-                continue;
+            if (s.isAi) {
+                const uint32_t share = aiBudget.remaining() / aiLeft;
+                GridSearch::WorkBudget slice(share);
+                planAiMove(s, slice);
+                aiBudget.spend(share - slice.remaining());
+                aiLeft--;
+            } else {
+                ControllerPtr ctl = input->getController(s.playerIndex);
+                if (!ctl) {
+                    s.alive = false;
+                    s.dying = true;
+                    s.deathStartMs = now;
+                    occupancyStale = true;
+                    viewStale = true;
+                    continue;
+                }
+                s.handleInput(ctl);
             }
-
-            s.handleInput(ctl);
             s.dir = s.nextDir;
 
             // Minimal movement SFX (RIGHT/DOWN only; no UP/LEFT).
@@ -635,38 +1012,33 @@ public:
             }
         }
 
-        // 4) Body collisions (including self)
+        // 4) Body collisions (including self), one bit test per snake.
         // Allow moving into a tail cell IF that tail is moving away this tick (i.e., !willGrow for that snake).
+        if (occupancyStale) rebuildOccupancy();
         for (uint8_t i = 0; i < n; i++) {
             if (!willMove[i]) continue;
             const Point nh = nextHead[i];
+            if (!occupied.test(nh.x, nh.y)) continue;
 
+            bool vacatingTail = false;
             for (uint8_t j = 0; j < n; j++) {
-                Snake& other = snakes[activeIdx[j]];
-                if (!other.alive) continue;
-
-                const bool otherTailVacates = willMove[j] && !willGrow[j];
-                const uint16_t otherLen = other.body.size();
-
-                for (uint16_t k = 0; k < otherLen; k++) {
-                    // If other tail vacates, skip its last segment for collision checks.
-                    if (otherTailVacates && k == (uint16_t)(otherLen - 1)) continue;
-
-                    // For self, ignore index 0 (current head); we only care about hitting the body.
-                    if (i == j && k == 0) continue;
-
-                    const Point& seg = other.body.at(k);
-                    if (seg.x == nh.x && seg.y == nh.y) {
-                        collision[i] = true;
-                        break;
-                    }
-                }
-                if (collision[i]) break;
+                const Snake& other = snakes[activeIdx[j]];
+                if (!other.alive || !willMove[j] || willGrow[j]) continue;
+                const Point& tail = other.body.tail();
+                if (tail.x == nh.x && tail.y == nh.y) { vacatingTail = true; break; }
             }
+            if (!vacatingTail) collision[i] = true;
         }
 
         // 5) Apply moves + resolve food (single food can only be eaten once per tick)
         // If multiple snakes target the same food cell, head-on collision above will kill them; still, avoid double erase.
+        // Occupancy: vacate every moving tail first, so a head entering a tail cell keeps its bit.
+        for (uint8_t i = 0; i < n; i++) {
+            if (!willMove[i] || willGrow[i] || !snakes[activeIdx[i]].alive) continue;
+            const Point& tail = snakes[activeIdx[i]].body.tail();
+            occupied.reset(tail.x, tail.y);
+            setView(tail.x, tail.y, TILE_EMPTY);
+        }
         for (uint8_t i = 0; i < n; i++) {
             if (!willMove[i]) continue;
 
@@ -689,8 +1061,11 @@ public:
                 s.alive = false;
                 s.dying = true;
                 s.deathStartMs = now;
+                occupancyStale = true;
+                viewStale = true;
                 continue;
             }
+            occupied.set(nh.x, nh.y);
 
             // Food + scoring for survivors
             if (willGrow[i] && foodHitIndex[i] >= 0) {
@@ -699,24 +1074,25 @@ public:
                 if (fi >= 0 && fi < (int)foodCount && pointInFood(foods[fi], nh)) {
                     const FoodKind kind = foods[fi].kind;
                     s.score += pointsForFood(kind);
+                    eraseFood(foods[fi]);
                     for (int j = fi + 1; j < (int)foodCount; j++) foods[j - 1] = foods[j];
                     if (foodCount > 0) foodCount--;
-                    // Start a new bulge right behind the head.
+                    // Start a new bulge right behind the head (the old one turns back into body).
+                    const int oldBulge = s.bulgeIndex;
                     s.bulgeIndex = 1;
+                    if (oldBulge >= 0) stampSegment(activeIdx[i], (uint16_t)oldBulge);
                     spawnFood(chooseNextFoodKind());
                 }
             }
+            stampSnakeFront(activeIdx[i]);
         }
 
-        bool anyAlive = false;
-        bool anyDying = false;
-        for (uint8_t si = 0; si < SnakeGameConfig::MAX_SNAKES; si++) {
-            Snake& s = snakes[si];
-            if (!s.enabled) continue;
-            if (s.alive) anyAlive = true;
-            if (s.dying) anyDying = true;
-        }
-        if (!anyAlive && !anyDying && playerCountAtStart > 0) {
+        // A dead snake's body stops being an obstacle (and its head may sit on another body).
+        if (occupancyStale) rebuildOccupancy();
+        // Dead snakes leave the view (draw() blinks them as an overlay).
+        if (viewStale) rebuildView();
+
+        if (playerCountAtStart > 0 && roundFinished()) {
             phase = PHASE_GAME_OVER;
             gameOver = true;
         }
@@ -729,12 +1105,12 @@ public:
         // - apples red
         // - white boundary
         // - standard HUD
-        display->fillScreen(COLOR_BLACK);
-
         if (gameOver) {
             // -----------------------------------------------------
             // GAME OVER + per-game leaderboard view
             // -----------------------------------------------------
+            display->fillScreen(COLOR_BLACK);
+            boardLayer.invalidate();
             const uint32_t score = leaderboardScore();
             char tag[4];
             UserProfiles::getPadTag(0, tag);
@@ -742,6 +1118,14 @@ public:
             return;
         }
 
+        // The board persists between frames; only HUD / border area is cleared.
+        if (boardLayer.needsFullRepaint()) display->fillScreen(COLOR_BLACK);
+        else boardLayer.clearOutside(display, COLOR_BLACK);
+
+        // Board cells changed since the last frame (foods, heads, necks, vacated tails, ...).
+        // Drawn first so HUD / overlays stay on top.
+        boardLayer.draw(display);
+
         // HUD: scores and players (at the top, fully visible)
         // Position text with 1px margin to prevent overflow at top edge
         int hudY = 6;  // Moved down by 2px (1px overflow fix + 1px margin)
@@ -754,14 +1138,29 @@ public:
         }
 
         for (uint8_t i = 0; i < n; i++) {
-            char buf[10];
             Snake& s = snakes[activeIdx[i]];
-            snprintf(buf, sizeof(buf), "P%u:%d", (unsigned)i + 1u, s.score);
-            SmallFont::drawString(display, hudX, hudY, buf, s.color);
+            SmallFont::drawValue(display, hudX, hudY, s.color, SmallFont::playerPrefix(i), s.score);
             hudX += 16;
         }
+        // With 4 players the last score can run past the right edge and wrap onto the
+        // playfield. Food / snakes stay on top of it there; restore those cells next frame.
+        if (hudX > PANEL_RES_X) {
+            const int wrapY0 = hudY + 1;
+            const int wrapH = 6;
+            const int cy0 = max(0, (wrapY0 - PLAYFIELD_CONTENT_Y) / PIXEL_SIZE);
+            const int cy1 = min(LOGICAL_HEIGHT - 1, (wrapY0 + wrapH - 1 - PLAYFIELD_CONTENT_Y) / PIXEL_SIZE);
+            for (int cy = cy0; cy <= cy1 && wrapY0 + wrapH > PLAYFIELD_CONTENT_Y; cy++) {
+                for (int cx = 0; cx < LOGICAL_WIDTH; cx++) {
+                    if (view[cy][cx] == TILE_EMPTY) continue;
+                    drawCell(display, cx, cy, PLAYFIELD_CONTENT_X + cx * PIXEL_SIZE, PLAYFIELD_CONTENT_Y + cy * PIXEL_SIZE, PIXEL_SIZE, view[cy][cx]);
+                }
+            }
+            boardLayer.markPixelRectDirty(0, wrapY0, PANEL_RES_X, wrapH);
+        }
         char pbuf[8];
-        snprintf(pbuf, sizeof(pbuf), "%dP", (int)n);
+        const uint8_t plen = SmallFont::formatUInt(pbuf, sizeof(pbuf) - 1, n);
+        pbuf[plen] = 'P';
+        pbuf[plen + 1] = '\0';
         SmallFont::drawString(display, PANEL_RES_X - 14, hudY, pbuf, COLOR_YELLOW);
 
         // HUD divider
@@ -770,193 +1169,95 @@ public:
         // Playfield border (inset to avoid using edge pixels)
         display->drawRect(PLAYFIELD_BORDER_X, PLAYFIELD_BORDER_Y, PLAYFIELD_BORDER_W, PLAYFIELD_BORDER_H, COLOR_WHITE);
 
-        // Helper to draw a small rect but avoid spilling into the last row/col.
-        // This preserves game logic while keeping everything aligned to edges.
-        auto fillRectClipped = [&](int x, int y, int w, int h, uint16_t c) {
-            // Hard clip to the playfield content area only.
-            const int minX = PLAYFIELD_CONTENT_X;
-            const int minY = PLAYFIELD_CONTENT_Y;
-            const int maxX = PLAYFIELD_CONTENT_X + PLAYFIELD_CONTENT_W - 1;
-            const int maxY = PLAYFIELD_CONTENT_Y + PLAYFIELD_CONTENT_H - 1;
-
-            if (x < minX || y < minY) return;
-            if (x > maxX || y > maxY) return;
-            if (x + w - 1 > maxX) w = (maxX - x + 1);
-            if (y + h - 1 > maxY) h = (maxY - y + 1);
-            if (w <= 0 || h <= 0) return;
-            display->fillRect(x, y, w, h, c);
-        };
-
+        // Mouth pixels of snake `mouthOwner`; its own body and later snakes are drawn over them.
+        uint8_t mouthOwner = 0;
         auto drawPixelClipped = [&](int x, int y, uint16_t c) {
             const int minX = PLAYFIELD_CONTENT_X;
             const int minY = PLAYFIELD_CONTENT_Y;
             const int maxX = PLAYFIELD_CONTENT_X + PLAYFIELD_CONTENT_W - 1;
             const int maxY = PLAYFIELD_CONTENT_Y + PLAYFIELD_CONTENT_H - 1;
             if (x < minX || y < minY || x > maxX || y > maxY) return;
+            if (coveredByLaterSnake(mouthOwner, (x - PLAYFIELD_CONTENT_X) / PIXEL_SIZE, (y - PLAYFIELD_CONTENT_Y) / PIXEL_SIZE)) return;
             display->drawPixel(x, y, c);
         };
 
-        // Draw foods/creatures.
-        auto drawFoodSprite4x4 = [&](int px, int py, FoodKind kind, uint16_t col) {
-            const uint8_t k = (uint8_t)kind;
-            for (int yy = 0; yy < 4; yy++) {
-                for (int xx = 0; xx < 4; xx++) {
-                    if (!SnakeGameConfig::FOOD_SPRITE_4X4[k][yy][xx]) continue;
-                    drawPixelClipped(px + xx, py + yy, col);
-                }
-            }
-        };
-
-        for (uint8_t fi = 0; fi < foodCount; fi++) {
-            const FoodItem& f = foods[fi];
-            const int px = PLAYFIELD_CONTENT_X + f.p.x * PIXEL_SIZE;
-            const int py = PLAYFIELD_CONTENT_Y + f.p.y * PIXEL_SIZE;
-
-            if (f.kind == FOOD_APPLE) {
-                // Smaller apple: 2x2 pixels (1x1 logical cell) for tighter hitbox.
-                fillRectClipped(px, py, 2, 2, COLOR_RED);
-            } else {
-                // Creatures: 4x4 pixels (2x2 logical cells)
-                drawFoodSprite4x4(px, py, f.kind, foodColor(f.kind));
-            }
-        }
-
-        // Draw snakes (Nokia style: striped body, head/eyes, mouth animation, bulge)
+        // Overlays on top of the board, in snake index order so later snakes stay on top
+        // (each marks its cells dirty so the next frame restores them).
+        const uint32_t nowMs = millis();
         for (uint8_t ii = 0; ii < n; ii++) {
-            Snake& s = snakes[activeIdx[ii]];
-            // Alive snakes draw always. Dead snakes blink for a short time, then disappear.
-            bool drawSnake = s.alive;
-            if (!drawSnake && s.dying) {
-                const uint32_t now = millis();
-                if ((uint32_t)(now - s.deathStartMs) < DEATH_BLINK_TOTAL_MS) {
-                    drawSnake = (((now / DEATH_BLINK_PERIOD_MS) % 2) == 0);
+            const uint8_t si = activeIdx[ii];
+            Snake& s = snakes[si];
+
+            // Dead snakes blink for a short time, then disappear. Blink-off frames draw
+            // nothing: the cells were marked dirty, so the board shows what lies beneath.
+            if (!s.alive && s.dying) {
+                const bool visible = (uint32_t)(nowMs - s.deathStartMs) < DEATH_BLINK_TOTAL_MS &&
+                                     (((nowMs / DEATH_BLINK_PERIOD_MS) % 2) == 0);
+                if (!visible) continue;
+                for (uint16_t idx = 0; idx < s.body.size(); idx++) {
+                    const Point& p = s.body.at(idx);
+                    if (!coveredByLaterSnake((uint8_t)(si + 1), p.x, p.y)) {
+                        drawCell(display, p.x, p.y, PLAYFIELD_CONTENT_X + p.x * PIXEL_SIZE, PLAYFIELD_CONTENT_Y + p.y * PIXEL_SIZE,
+                                 PIXEL_SIZE, segmentTile(s, si, idx));
+                    }
+                    boardLayer.markDirty(p.x, p.y);
                 }
+                continue;
             }
-            if (!drawSnake) continue;
+            if (!s.alive) continue;
 
-            // Determine if mouth should be open: if the next move will eat a food hitbox and it's "soon".
-            const uint32_t nowMs = millis();
+            // Mouth animation: if the next move will eat a food hitbox and it's "soon",
+            // draw a small "open jaw" just ahead of the head.
             const uint32_t dt = (uint32_t)(nowMs - lastMove);
             const uint32_t tickMs = (uint32_t)SnakeGameConfig::MOVE_TICK_MS;
             const uint32_t msToMove = (dt >= tickMs) ? 0u : (tickMs - dt);
+            if (phase != PHASE_PLAYING || msToMove > 220u) continue;
+
+            Point nh = s.body.head();
+            Direction d = s.nextDir;
+            if (d == UP) nh.y--;
+            else if (d == DOWN) nh.y++;
+            else if (d == LEFT) nh.x--;
+            else if (d == RIGHT) nh.x++;
+            if (nh.x < 0) nh.x = LOGICAL_WIDTH - 1;
+            else if (nh.x >= LOGICAL_WIDTH) nh.x = 0;
+            if (nh.y < 0) nh.y = LOGICAL_HEIGHT - 1;
+            else if (nh.y >= LOGICAL_HEIGHT) nh.y = 0;
             bool mouthOpen = false;
-            if (phase == PHASE_PLAYING && msToMove <= 220u && s.alive) {
-                Point nh = s.body.head();
-                Direction d = s.nextDir;
-                if (d == UP) nh.y--;
-                else if (d == DOWN) nh.y++;
-                else if (d == LEFT) nh.x--;
-                else if (d == RIGHT) nh.x++;
-                if (nh.x < 0) nh.x = LOGICAL_WIDTH - 1;
-                else if (nh.x >= LOGICAL_WIDTH) nh.x = 0;
-                if (nh.y < 0) nh.y = LOGICAL_HEIGHT - 1;
-                else if (nh.y >= LOGICAL_HEIGHT) nh.y = 0;
-                for (uint8_t fi2 = 0; fi2 < foodCount; fi2++) {
-                    if (pointInFood(foods[fi2], nh)) { mouthOpen = true; break; }
-                }
+            for (uint8_t fi = 0; fi < foodCount; fi++) {
+                if (pointInFood(foods[fi], nh)) { mouthOpen = true; break; }
             }
-
-            const uint16_t baseCol = s.color;
-
-            // Lighter stripe color (blend towards white, but keep hue).
-            auto lighten565 = [&](uint16_t c, uint8_t alpha /*0..255*/) -> uint16_t {
-                uint8_t r = (uint8_t)((c >> 11) & 0x1F);
-                uint8_t g = (uint8_t)((c >> 5) & 0x3F);
-                uint8_t b = (uint8_t)(c & 0x1F);
-                r = (uint8_t)(r + ((31 - r) * alpha) / 255);
-                g = (uint8_t)(g + ((63 - g) * alpha) / 255);
-                b = (uint8_t)(b + ((31 - b) * alpha) / 255);
-                return (uint16_t)((r << 11) | (g << 5) | b);
-            };
-            const uint16_t stripeCol = lighten565(baseCol, 110); // ~43% towards white
-
-            for (uint16_t idx = 0; idx < s.body.size(); idx++) {
-                const Point& p = s.body.at(idx);
-                const int px = PLAYFIELD_CONTENT_X + p.x * PIXEL_SIZE;
-                const int py = PLAYFIELD_CONTENT_Y + p.y * PIXEL_SIZE;
-
-                // Head
-                if (idx == 0) {
-                    // Base head block
-                    fillRectClipped(px, py, PIXEL_SIZE, PIXEL_SIZE, baseCol);
-
-                    // Eyes (2 pixels) based on direction
-                    const uint16_t eye = COLOR_WHITE;
-                    if (s.dir == UP) {
-                        drawPixelClipped(px, py, eye);
-                        drawPixelClipped(px + 1, py, eye);
-                    } else if (s.dir == DOWN) {
-                        drawPixelClipped(px, py + 1, eye);
-                        drawPixelClipped(px + 1, py + 1, eye);
-                    } else if (s.dir == LEFT) {
-                        drawPixelClipped(px, py, eye);
-                        drawPixelClipped(px, py + 1, eye);
-                    } else if (s.dir == RIGHT) {
-                        drawPixelClipped(px + 1, py, eye);
-                        drawPixelClipped(px + 1, py + 1, eye);
-                    }
-
-                    // Mouth animation: draw a small "open jaw" just ahead of the head when about to eat.
-                    if (mouthOpen) {
-                        const int hx = px + 1;
-                        const int hy = py + 1;
-                        if (s.dir == UP) {
-                            drawPixelClipped(hx, hy - 2, COLOR_WHITE);
-                            drawPixelClipped(hx - 1, hy - 2, COLOR_WHITE);
-                        } else if (s.dir == DOWN) {
-                            drawPixelClipped(hx, hy + 2, COLOR_WHITE);
-                            drawPixelClipped(hx - 1, hy + 2, COLOR_WHITE);
-                        } else if (s.dir == LEFT) {
-                            drawPixelClipped(hx - 2, hy, COLOR_WHITE);
-                            drawPixelClipped(hx - 2, hy - 1, COLOR_WHITE);
-                        } else if (s.dir == RIGHT) {
-                            drawPixelClipped(hx + 2, hy, COLOR_WHITE);
-                            drawPixelClipped(hx + 2, hy - 1, COLOR_WHITE);
-                        }
-                    }
-                    continue;
-                }
-
-                // Make the head feel larger by giving it a solid "neck" segment (no stripes).
-                // This extends the head visually by 2px into the body without changing gameplay.
-                if (idx == 1) {
-                    fillRectClipped(px, py, PIXEL_SIZE, PIXEL_SIZE, baseCol);
-                    continue;
-                }
-
-                // Bulge segment
-                if (s.bulgeIndex >= 0 && (int)idx == s.bulgeIndex) {
-                    // Bulge is visible by being a SOLID colored segment (no stripes).
-                    fillRectClipped(px, py, PIXEL_SIZE, PIXEL_SIZE, baseCol);
-                    continue;
-                }
-
-                // Striped body (Nokia Snake 2 style):
-                // Use stationary diagonal black stripes anchored to the grid position
-                // so they do NOT "crawl" or flicker as the snake moves.
-                fillRectClipped(px, py, PIXEL_SIZE, PIXEL_SIZE, baseCol);
-
-                // Diagonal stripe pattern in the 2x2 tile:
-                // Alternate \ and / based on (cellX + cellY) to create a stable diagonal texture.
-                const bool diagBackslash = (((p.x + p.y) & 1) == 0);
-                if (diagBackslash) {
-                    drawPixelClipped(px, py, stripeCol);
-                    drawPixelClipped(px + 1, py + 1, stripeCol);
-                } else {
-                    drawPixelClipped(px + 1, py, stripeCol);
-                    drawPixelClipped(px, py + 1, stripeCol);
-                }
+            if (!mouthOpen) continue;
+
+            const Point& head = s.body.head();
+            mouthOwner = si;
+            const int hx = PLAYFIELD_CONTENT_X + head.x * PIXEL_SIZE + 1;
+            const int hy = PLAYFIELD_CONTENT_Y + head.y * PIXEL_SIZE + 1;
+            if (s.dir == UP) {
+                drawPixelClipped(hx, hy - 2, COLOR_WHITE);
+                drawPixelClipped(hx - 1, hy - 2, COLOR_WHITE);
+            } else if (s.dir == DOWN) {
+                drawPixelClipped(hx, hy + 2, COLOR_WHITE);
+                drawPixelClipped(hx - 1, hy + 2, COLOR_WHITE);
+            } else if (s.dir == LEFT) {
+                drawPixelClipped(hx - 2, hy, COLOR_WHITE);
+                drawPixelClipped(hx - 2, hy - 1, COLOR_WHITE);
+            } else if (s.dir == RIGHT) {
+                drawPixelClipped(hx + 2, hy, COLOR_WHITE);
+                drawPixelClipped(hx + 2, hy - 1, COLOR_WHITE);
             }
+            boardLayer.markPixelRectDirty(hx - 2, hy - 2, 5, 5);
         }
 
         // Countdown overlay (during round start)
         if (phase == PHASE_COUNTDOWN) {
-            const uint32_t now = millis();
-            const uint32_t elapsed = (uint32_t)(now - phaseStartMs);
+            const uint32_t elapsed = (uint32_t)(nowMs - phaseStartMs);
             int secsLeft = 3 - (int)(elapsed / 1000UL);
             if (secsLeft < 1) secsLeft = 1;
             char c[2] = { (char)('0' + secsLeft), '\0' };
             SmallFont::drawString(display, 30, 30, c, COLOR_YELLOW);
+            // Text sits on the board: restore those cells next frame.
+            boardLayer.markPixelRectDirty(30, 30 - 6, 6, 8);
         }
     }
 
@@ -967,15 +1268,11 @@ public:
     // ------------------------------
     // Leaderboard integration
     // ------------------------------
-    bool leaderboardEnabled() const override { return true; }
+    bool leaderboardEnabled() const override { return !cpuOpponents; }
     const char* leaderboardId() const override { return "snake"; }
     const char* leaderboardName() const override { return "Snake"; }
     uint32_t leaderboardScore() const override {
-        // Multiplayer: submit the best individual score of the round.
-        uint32_t best = 0;
-        for (const auto& s : snakes) {
-            if ((uint32_t)s.score > best) best = (uint32_t)s.score;
-        }
-        return best;
+        // Multiplayer: submit the best individual score of the round (CPU snakes don't count).
+        return (uint32_t)bestScore(false);
     }
 };
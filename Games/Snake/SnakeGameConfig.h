@@ -13,6 +13,7 @@
 
 #include <Arduino.h>
 #include "../../engine/config.h"
+#include "../../engine/SpriteBlit.h"
 
 namespace SnakeGameConfig {
 
@@ -88,6 +89,21 @@ static constexpr uint8_t FOOD_WEIGHT_BUG   = 3;
 
 static constexpr uint32_t CREATURE_TTL_MS = 9000UL;
 
+// -----------------------------------------------------------------------------
+// CPU opponents
+// -----------------------------------------------------------------------------
+// Single-player rounds add this many CPU snakes in free slots (0 = play alone, default).
+// Rounds against CPU snakes are not submitted to the leaderboard.
+static constexpr uint8_t SINGLE_PLAYER_AI_SNAKES = 0;
+
+// Time all CPU snakes together may spend planning in one move tick (us), a small slice
+// of MOVE_TICK_MS. Enforced as a work budget (GridSearch::WorkBudget), so planning is
+// deterministic. Searches that run out fall back to what they found so far.
+static constexpr uint32_t AI_TICK_BUDGET_US = 3000UL;
+
+// Food search gives up beyond this many steps (then the CPU just keeps safe).
+static constexpr uint16_t AI_MAX_FOOD_STEPS = 64;
+
 // -----------------------------------------------------------------------------
 // Sprites / tables
 // -----------------------------------------------------------------------------
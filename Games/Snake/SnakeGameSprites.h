@@ -10,6 +10,7 @@
 
 // Keep this header self-contained for IDE parsing/linting.
 #include <Arduino.h>
+#include "../../engine/SpriteBlit.h"
 
 // 4x4 pixel-art sprites for foods/creatures, indexed by FoodKind (0..5).
 // 1 = draw pixel, 0 = transparent.
@@ -46,4 +47,5 @@ static inline constexpr uint8_t FOOD_SPRITE_4X4[6][4][4] = {
      {0,1,1,0}},
 };
 
-
+// Span-compiled FOOD_SPRITE_4X4 (one frame per FoodKind; slot 1 = food color).
+static inline constexpr auto FOOD_SHEET_4X4 = SpriteBlit::compile<SpriteBlit::countRuns(FOOD_SPRITE_4X4)>(FOOD_SPRITE_4X4);
@@ -5,6 +5,7 @@
 #include "../../engine/ControllerManager.h"
 #include "../../engine/config.h"
 #include "../../engine/AudioManager.h"
+#include "../../engine/ParticleSystem.h"
 #include "../../component/SmallFont.h"
 #include "../../engine/UserProfiles.h"
 #include "../../component/GameOverLeaderboardView.h"
@@ -83,17 +84,16 @@ private:
     // ---------------------------------------------------------
     // Tetris-only "Tetris!" explosion particles (spawned ONLY when clearing 4 lines)
     // ---------------------------------------------------------
-    struct Particle {
-        bool active;
-        float x;
-        float y;
-        float vx;
-        float vy;
-        uint16_t color;
-        uint32_t endMs;
-    };
-    static constexpr int MAX_PARTICLES = 70;
-    Particle particles[MAX_PARTICLES] = {};
+    static constexpr uint16_t MAX_PARTICLES = TetrisGameConfig::MAX_PARTICLES;
+    typedef ParticleSystem<MAX_PARTICLES> Particles;
+
+    static Particles::Params particleParams() {
+        Particles::Params p;
+        p.drag = Fixed::fromFloat(0.98f);
+        p.gravity = Fixed::fromFloat(0.028f);
+        return p;
+    }
+    Particles particles{ particleParams() };
 
     void spawnTetrisParticles(const uint8_t rows[4], uint8_t count, uint32_t now) {
         // Only for a true "tetris" (4 lines at once).
@@ -107,54 +107,22 @@ private:
 
         // Emit a modest amount; visually punchy but cheap.
         const int bursts = 34;
-        for (int n = 0; n < bursts; n++) {
-            int slot = -1;
-            for (int i = 0; i < MAX_PARTICLES; i++) {
-                if (!particles[i].active) { slot = i; break; }
-            }
-            if (slot < 0) return;
-
+        for (int n = 0; n < bursts && !particles.full(); n++) {
             const uint8_t ry = rows[random(0, 4)];
             const int px = boardStartX + random(0, innerW);
             const int py = boardStartY + (int)ry * CELL_SIZE + (CELL_SIZE / 2);
 
-            Particle& p = particles[slot];
-            p.active = true;
-            p.x = (float)px;
-            p.y = (float)py;
-            p.vx = ((float)random(-80, 81) / 100.0f) * 0.9f;
-            p.vy = -(((float)random(20, 110) / 100.0f) * 0.9f);
+            const Fixed::q16 vx = Fixed::mul(Fixed::ratio(random(-80, 81), 100), Fixed::fromFloat(0.9f));
+            const Fixed::q16 vy = -Fixed::mul(Fixed::ratio(random(20, 110), 100), Fixed::fromFloat(0.9f));
             // Mix bright white with the current piece color so it feels themed.
-            p.color = (random(0, 100) < 45) ? COLOR_WHITE : currentPiece.color;
-            p.endMs = now + (uint32_t)random(260, 620);
+            const uint16_t color = (random(0, 100) < 45) ? COLOR_WHITE : currentPiece.color;
+            particles.spawn(Fixed::fromInt(px), Fixed::fromInt(py), vx, vy, color, now + (uint32_t)random(260, 620));
         }
     }
 
-    void updateParticles(uint32_t now) {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) continue;
-            if ((int32_t)(particles[i].endMs - now) <= 0) {
-                particles[i].active = false;
-                continue;
-            }
-            particles[i].x += particles[i].vx;
-            particles[i].y += particles[i].vy;
-            particles[i].vx *= 0.98f;
-            particles[i].vy *= 0.98f;
-            particles[i].vy += 0.028f; // gravity
-        }
-    }
+    void updateParticles(uint32_t now) { particles.update(now); }
 
-    void drawParticles(MatrixPanel_I2S_DMA* display, uint32_t now) const {
-        for (int i = 0; i < MAX_PARTICLES; i++) {
-            if (!particles[i].active) continue;
-            if ((int32_t)(particles[i].endMs - now) <= 0) continue;
-            const int x = (int)particles[i].x;
-            const int y = (int)particles[i].y;
-            if (x < 0 || x >= PANEL_RES_X || y < 0 || y >= PANEL_RES_Y) continue;
-            display->drawPixel(x, y, particles[i].color);
-        }
-    }
+    void drawParticles(MatrixPanel_I2S_DMA* display, uint32_t now) const { particles.draw(display, now); }
 
     /**
      * Initialize a piece
@@ -366,7 +334,7 @@ public:
         initPiece(nextPieces[2], random(0, 7));
 
         // Clear particles
-        for (int i = 0; i < MAX_PARTICLES; i++) particles[i].active = false;
+        particles.clear();
 
         // -----------------------------------------------------
         // Audio: play the "starting song" once (RTTTL, non-blocking)
@@ -562,7 +530,7 @@ public:
         // - Level: 3 chars, e.g. 007
         {
             char sbuf[10];
-            snprintf(sbuf, sizeof(sbuf), "%06d", max(0, score));
+            SmallFont::formatInt(sbuf, sizeof(sbuf), max(0, score), 6);
             // TomThumb is tiny; approximate centering with a 4px advance per char.
             const int textW = 6 * 4;
             const int sx = hudBlockX + max(0, (boxesW - textW) / 2);
@@ -582,7 +550,7 @@ public:
         }
         {
             char lbuf[8];
-            snprintf(lbuf, sizeof(lbuf), "%03d", max(0, level));
+            SmallFont::formatInt(lbuf, sizeof(lbuf), max(0, level), 3);
             const int textW = 3 * 4;
             const int lx = hudBlockX + max(0, (boxesW - textW) / 2);
             const uint16_t dim = dimColor(COLOR_GREEN, 120);
@@ -27,6 +27,12 @@ static constexpr int CELL_SIZE = 3;
 static constexpr unsigned long INITIAL_FALL_DELAY_MS = 500;
 static constexpr unsigned long FLASH_TOGGLE_MS = 90; // 6 toggles => 3 visible flashes
 
+// -----------------------------------------------------------------------------
+// Pools
+// -----------------------------------------------------------------------------
+// Particle budget for the "Tetris!" burst (engine/ParticleSystem.h).
+static constexpr uint16_t MAX_PARTICLES = 70;
+
 // -----------------------------------------------------------------------------
 // Sprites / palettes
 // -----------------------------------------------------------------------------
@@ -8,7 +8,10 @@
 #include "../../component/SmallFont.h"
 #include "../../engine/Settings.h"
 #include "../../engine/UserProfiles.h"
+#include "../../engine/GridBitset.h"
+#include "../../engine/GridSearch.h"
 #include "../../component/GameOverLeaderboardView.h"
+#include "../../component/TileLayer.h"
 #include "TronGameConfig.h"
 #include "TronGameAudio.h"
 
@@ -79,6 +82,12 @@ private:
 
     // 0 = empty, else (padIndex+1) owner
     uint8_t trail[GRID_W * GRID_H];
+    // Same cells as one bit each (one word per row): collisions and AI searches use this,
+    // `trail` only keeps the owner for drawing.
+    typedef GridBitset<GRID_W, GRID_H> WallGrid;
+    WallGrid walls;
+    // Incremental trail renderer over `trail` (only new cells are painted each frame).
+    TileLayer<GRID_W, GRID_H> trailLayer;
     Player players[MAX_GAMEPADS];
     bool gameOver = false;
     int winnerPad = -1; // 0..3
@@ -131,16 +140,20 @@ private:
 
     void clearTrail() {
         memset(trail, 0, sizeof(trail));
+        walls.clear();
+        trailLayer.invalidate();
     }
 
     void markCell(int x, int y, uint8_t ownerPadIndex) {
         if (x < 0 || x >= GRID_W || y < 0 || y >= GRID_H) return;
         trail[idx(x, y)] = (uint8_t)(ownerPadIndex + 1);
+        walls.set(x, y);
+        trailLayer.markDirty(x, y);
     }
 
-    uint8_t getCell(int x, int y) const {
-        if (x < 0 || x >= GRID_W || y < 0 || y >= GRID_H) return 0xFF; // treat OOB as wall
-        return trail[idx(x, y)];
+    bool isBlocked(int x, int y) const {
+        if (x < 0 || x >= GRID_W || y < 0 || y >= GRID_H) return true; // treat OOB as wall
+        return walls.test(x, y);
     }
 
     void setupPlayersFromConnectedControllers() {
@@ -276,73 +289,121 @@ private:
         }
     }
 
+    static inline void stepDir(Dir d, int& x, int& y) {
+        if (d == Dir::Up) y--;
+        else if (d == Dir::Down) y++;
+        else if (d == Dir::Left) x--;
+        else if (d == Dir::Right) x++;
+    }
+
     /**
-     * Basic AI:
-     * - Prefer going straight if safe.
-     * - Otherwise pick left/right with the most open space (short lookahead).
-     * - This is intentionally "simple" (not perfect) but avoids obvious crashes.
+     * Territory after moving to (x, y): a Voronoi race on the wall bitboard. One BFS wave
+     * starts at (x, y), another at all opponent heads. Each layer, both take the free cells
+     * next to what they hold that nobody has claimed yet; cells reached by both in the same
+     * layer belong to neither. Score = our cells - their cells (walled off from everyone:
+     * simply our reachable area). Stops early once `budget` runs out (partial race; 0 when
+     * not even setup and tally fit).
      */
-    int lookaheadFreeCells(int x, int y, Dir d, int maxSteps) const {
-        int nx = x;
-        int ny = y;
-        int freeSteps = 0;
-        for (int i = 0; i < maxSteps; i++) {
-            if (d == Dir::Up) ny--;
-            else if (d == Dir::Down) ny++;
-            else if (d == Dir::Left) nx--;
-            else if (d == Dir::Right) nx++;
-
-            if (getCell(nx, ny) != 0) break;
-            freeSteps++;
+    int16_t voronoiScore(int x, int y, const WallGrid& opponentHeads, GridSearch::WorkBudget& budget) const {
+        typedef GridSearch::Wavefront<GRID_W, GRID_H> Wave;
+        // Row passes: setup 3 (open, ours, theirs) + tally 6 (2 copies, 2 andNot, 2 count);
+        // each layer 4 (2 grow, 2 andNot).
+        static constexpr uint32_t FIXED_WORK = 9 * GRID_H;
+        static constexpr uint32_t LAYER_WORK = 4 * GRID_H;
+        if (!budget.spend(FIXED_WORK)) return 0;
+
+        WallGrid open;
+        for (uint8_t row = 0; row < GRID_H; row++) open.setRow(row, (WallGrid::Row)~walls.row(row));
+        open.reset(x, y);
+
+        Wave ours;
+        Wave theirs;
+        ours.start(x, y);
+        theirs.start(opponentHeads);
+        while (budget.spend(LAYER_WORK)) {
+            const bool grewOurs = ours.grow(open, false);
+            const bool grewTheirs = theirs.grow(open, false);
+            if (!grewOurs && !grewTheirs) break;
+            open.andNot(ours.reached);
+            open.andNot(theirs.reached);
         }
-        return freeSteps;
+
+        WallGrid mine = ours.reached;
+        mine.andNot(theirs.reached);
+        WallGrid other = theirs.reached;
+        other.andNot(ours.reached);
+        return (int16_t)((int)mine.count() - (int)other.count());
     }
 
+    /**
+     * AI: Voronoi / reachable-area evaluation of straight, left and right.
+     * - Moves into a wall or trail are out (unless nothing else is left).
+     * - Each remaining move is scored by `voronoiScore()`; cells another head can enter
+     *   next tick cost AI_HEAD_ON_PENALTY (head-on crashes kill both).
+     * - Best score wins; ties keep going straight.
+     * AI_BUDGET_US (as work, see GridSearch::WorkBudget) is split evenly over the moves
+     * being scored; what one move leaves goes to the next.
+     */
     void handleAiInput(Player& p) {
-        // Candidate directions: straight, left, right (never reverse)
-        const Dir straight = p.dir;
-        const Dir left = turnLeft(p.dir);
-        const Dir right = turnRight(p.dir);
-
-        // Small lookahead is enough for a "basic" AI and keeps CPU low.
-        const int MAX_LOOK = 10;
-        const int sStraight = lookaheadFreeCells(p.x, p.y, straight, MAX_LOOK);
-        const int sLeft = lookaheadFreeCells(p.x, p.y, left, MAX_LOOK);
-        const int sRight = lookaheadFreeCells(p.x, p.y, right, MAX_LOOK);
-
-        // Prefer straight if it isn't immediately fatal and is competitive.
-        int best = sStraight;
-        Dir bestDir = straight;
+        GridSearch::WorkBudget budget(GridSearch::WorkBudget::fromUs(TronGameConfig::AI_BUDGET_US));
 
-        if (sLeft > best) { best = sLeft; bestDir = left; }
-        else if (sLeft == best && random(0, 2) == 0) { bestDir = left; }
-
-        if (sRight > best) { best = sRight; bestDir = right; }
-        else if (sRight == best && random(0, 2) == 0) { bestDir = right; }
+        WallGrid opponentHeads;
+        WallGrid headReach;
+        for (int i = 0; i < MAX_GAMEPADS; i++) {
+            const Player& o = players[i];
+            if (&o == &p || !o.active || !o.alive) continue;
+            opponentHeads.set(o.x, o.y);
+            static constexpr Dir DIRS[] = { Dir::Up, Dir::Down, Dir::Left, Dir::Right };
+            for (Dir d : DIRS) {
+                int hx = o.x;
+                int hy = o.y;
+                stepDir(d, hx, hy);
+                if (hx >= 0 && hx < GRID_W && hy >= 0 && hy < GRID_H) headReach.set(hx, hy);
+            }
+        }
 
-        // If all are zero, we still must choose something; pick a turn randomly.
-        if (best == 0) {
-            bestDir = (random(0, 2) == 0) ? left : right;
+        // Candidate directions: straight, left, right (never reverse)
+        const Dir candidates[3] = { p.dir, turnLeft(p.dir), turnRight(p.dir) };
+        Dir open[3];
+        uint8_t n = 0;
+        for (Dir d : candidates) {
+            int nx = p.x;
+            int ny = p.y;
+            stepDir(d, nx, ny);
+            if (!isBlocked(nx, ny)) open[n++] = d;
         }
+        if (n == 0) return; // boxed in: any move crashes
 
+        Dir bestDir = open[0];
+        int16_t best = INT16_MIN;
+        for (uint8_t i = 0; i < n; i++) {
+            int nx = p.x;
+            int ny = p.y;
+            stepDir(open[i], nx, ny);
+            const uint32_t share = budget.remaining() / (uint32_t)(n - i);
+            GridSearch::WorkBudget slice(share);
+            int16_t score = voronoiScore(nx, ny, opponentHeads, slice);
+            budget.spend(share - slice.remaining());
+            if (headReach.test(nx, ny)) score = (int16_t)(score - TronGameConfig::AI_HEAD_ON_PENALTY);
+            if (score > best) {
+                best = score;
+                bestDir = open[i];
+            }
+        }
         p.nextDir = bestDir;
     }
 
 public:
     TronGame() {
         memset(trail, 0, sizeof(trail));
+        trailLayer.attach(trail, GRID_W, GRID_H, GRID_W, CELL_PX, CONTENT_X, CONTENT_Y);
     }
 
     /**
      * Tron is a fixed-tick game; rendering much faster than the tick doesn't help.
      */
-    uint16_t preferredRenderFps() const override {
-        if (TRON_SPEED_MS == 0) return GAME_RENDER_FPS;
-        uint16_t fps = (uint16_t)(1000UL / (uint32_t)TRON_SPEED_MS);
-        if (fps < 10) fps = 10;
-        if (fps > GAME_RENDER_FPS) fps = GAME_RENDER_FPS;
-        return fps;
-    }
+    static constexpr uint16_t RENDER_FPS = renderFpsForTickMs(TRON_SPEED_MS);
+    uint16_t preferredRenderFps() const override { return RENDER_FPS; }
 
     void start() override {
         gameOver = false;
@@ -421,8 +482,7 @@ public:
         // Wall/trail collision
         for (int i = 0; i < MAX_GAMEPADS; i++) {
             if (!next[i].willMove) continue;
-            const uint8_t cell = getCell(next[i].x, next[i].y);
-            if (cell != 0) {
+            if (isBlocked(next[i].x, next[i].y)) {
                 next[i].crash = true;
             }
         }
@@ -502,11 +562,15 @@ public:
         }
     }
 
-    void draw(MatrixPanel_I2S_DMA* display) override {
-        display->fillScreen(COLOR_BLACK);
+    void onCanvasLost() override {
+        trailLayer.invalidate();
+    }
 
+    void draw(MatrixPanel_I2S_DMA* display) override {
         // GAME OVER screen
         if (gameOver) {
+            display->fillScreen(COLOR_BLACK);
+            trailLayer.invalidate();
             char title[12];
             if (winnerPad >= 0) snprintf(title, sizeof(title), "P%d WINS", winnerPad + 1);
             else snprintf(title, sizeof(title), "GAME OVER");
@@ -517,42 +581,46 @@ public:
             return;
         }
 
+        // Trail colors (0 = empty, owner+1, anything else white).
+        const uint16_t palette[6] = {
+            COLOR_BLACK, playerColors[0], playerColors[1], playerColors[2], playerColors[3], COLOR_WHITE
+        };
+        trailLayer.setPalette(palette, 6);
+
+        // The playfield persists between frames; only HUD / border area is cleared.
+        if (trailLayer.needsFullRepaint()) display->fillScreen(COLOR_BLACK);
+        else trailLayer.clearOutside(display, COLOR_BLACK);
+
+        // Trails (grid): cells changed since the last frame (everything after invalidate()).
+        // Drawn first so HUD / heads / text stay on top.
+        trailLayer.draw(display);
+
         // HUD (same spirit as Snake)
         const int hudY = 6; // 1px margin + avoid top overflow
         int hudX = 2;
         for (int i = 0; i < MAX_GAMEPADS; i++) {
             if (!players[i].active) continue;
-            SmallFont::drawStringF(display, hudX, hudY, players[i].color, "P%d:%d", i + 1, players[i].score);
+            SmallFont::drawValue(display, hudX, hudY, players[i].color, SmallFont::playerPrefix((uint8_t)i), players[i].score);
             hudX += 16;
         }
+        // With 4 players the last score runs past the right edge and wraps onto the line
+        // below (over the playfield): restore those cells next frame.
+        if (hudX > PANEL_RES_X) trailLayer.markPixelRectDirty(0, hudY + 1, PANEL_RES_X, 6);
 
         // Alive count indicator on the right
-        SmallFont::drawStringF(display, PANEL_RES_X - 12, hudY, COLOR_YELLOW, "A%d", aliveCount());
+        SmallFont::drawValue(display, PANEL_RES_X - 12, hudY, COLOR_YELLOW, "A", aliveCount());
 
         // Border
         display->drawRect(BORDER_X, BORDER_Y, BORDER_W, BORDER_H, COLOR_WHITE);
 
-        // Trails (grid)
-        for (int y = 0; y < GRID_H; y++) {
-            for (int x = 0; x < GRID_W; x++) {
-                const uint8_t v = trail[idx(x, y)];
-                if (v == 0) continue;
-                const uint8_t owner = (uint8_t)(v - 1);
-                const uint16_t c = (owner < 4) ? playerColors[owner] : COLOR_WHITE;
-                const int px = CONTENT_X + x * CELL_PX;
-                const int py = CONTENT_Y + y * CELL_PX;
-                // 1px-wide trails (CELL_PX == 1), but keep math generic.
-                display->drawPixel(px, py, c);
-            }
-        }
-
         // Heads: small highlight so you can see direction more easily
         for (int i = 0; i < MAX_GAMEPADS; i++) {
             if (!players[i].active || !players[i].alive) continue;
             const int px = CONTENT_X + players[i].x * CELL_PX;
             const int py = CONTENT_Y + players[i].y * CELL_PX;
-            // White highlight on the head (still 1px)
+            // White highlight on the head (still 1px); repainted as trail next frame.
             display->drawPixel(px, py, COLOR_WHITE);
+            trailLayer.markDirty(players[i].x, players[i].y);
         }
 
         // Round transition hint
@@ -563,6 +631,8 @@ public:
             } else {
                 SmallFont::drawString(display, 10, BORDER_Y + 10, "DRAW", COLOR_WHITE);
             }
+            // Text sits on the playfield: restore those cells next frame.
+            trailLayer.markPixelRectDirty(10, BORDER_Y + 10 - 6, 6 * 4, 8);
         }
     }
 
@@ -44,6 +44,16 @@ static constexpr int GRID_H = (CONTENT_H / CELL_PX);
 static constexpr uint8_t WIN_SCORE = 5;
 static constexpr uint32_t ROUND_RESET_DELAY_MS = 1200;
 
+// -----------------------------------------------------------------------------
+// AI
+// -----------------------------------------------------------------------------
+// Planning time per AI player and tick (us), a small slice of TRON_SPEED_MS. Enforced as a
+// work budget (GridSearch::WorkBudget), so AI moves are deterministic. Moves whose
+// evaluation runs out are scored on the territory found so far.
+static constexpr uint32_t AI_BUDGET_US = 2000UL;
+// Territory (cells) given up to avoid a cell an opponent's head can also enter.
+static constexpr int16_t AI_HEAD_ON_PENALTY = 24;
+
 // -----------------------------------------------------------------------------
 // Visual tables / sprites
 // -----------------------------------------------------------------------------
@@ -0,0 +1,2 @@
+#include "engine/InputTracker.cpp"
+
@@ -11,18 +11,16 @@
 
 #include "engine/config.h"
 #include "engine/DisplayPresent.h"
+#include "engine/FrameCanvas.h"
+#include "engine/FixedStepScheduler.h"
+#include "engine/FrameProfiler.h"
+#include "engine/InputLog.h"
+#include "engine/InputTracker.h"
 #include "engine/ControllerManager.h"
 #include "engine/AudioManager.h"
-#include "Games/Snake/SnakeGame.h"
-#include "Games/Tron/TronGame.h"
-#include "Games/Pong/PongGame.h"
-#include "Games/Breakout/BreakoutGame.h"
-#include "Games/Shooter/ShooterGame.h"
-#include "Games/Labyrinth/LabyrinthGame.h"
-#include "Games/Tetris/TetrisGame.h"
-#include "Games/Asteroids/AsteroidsGame.h"
-#include "Games/Music/MusicApp.h"
-#include "Games/MVisual/MVisualApp.h"
+#include "engine/EngineTasks.h"
+#include "Games/GameRegistry.h"
+#include "engine/GameArena.h"
 #include "applet/Menu.h"
 #include "engine/EepromManager.h"
 #include "engine/Settings.h"
@@ -38,6 +36,9 @@
 // Globals
 // ---------------------------------------------------------
 MatrixPanel_I2S_DMA* dma_display = nullptr;
+// Everything is drawn into this RAM canvas; present pushes only changed spans
+// to dma_display (see engine/FrameCanvas.h).
+FrameCanvas* frameCanvas = nullptr;
 
 Menu menu;
 SettingsMenu settingsMenu;
@@ -45,9 +46,25 @@ LeaderboardMenu leaderboardMenu;
 UserSelectMenu userSelectMenu;
 PauseMenu pauseMenu;
 GameBase* currentGame = nullptr;
+// Static storage for the running game (sized to the largest registered game):
+// launching never touches the heap, so it cannot fail from fragmentation.
+GameArena<GameRegistry::MAX_GAME_BYTES, GameRegistry::MAX_GAME_ALIGN> gameArena;
 // Monotonic game-run token to avoid relying on pointer addresses (which can be reused).
 // Incremented each time we start a NEW game instance from the menu.
 uint32_t currentGameRunId = 0;
+// Accumulator for fixed-timestep games (GameBase::fixedStepMs() != 0).
+FixedStepScheduler gameClock;
+// GameRegistry slot of the running game (profiler context, leaderboard id), -1 if none.
+int8_t currentGameSlot = -1;
+
+// Frame-time profiler. Contexts: one per AppState, then one per game slot.
+FrameProfiler frameProfiler;
+static constexpr uint8_t PROFILE_CTX_GAMES = 7;
+static_assert(PROFILE_CTX_GAMES + GameRegistry::COUNT <= FrameProfiler::MAX_CONTEXTS,
+              "FrameProfiler::MAX_CONTEXTS too small for the game registry");
+
+// Deterministic input recording / replay of game runs (engine/InputLog.h).
+InputLog inputLog;
 
 // ---------------------------------------------------------
 // Frame pacing / presentation helpers
@@ -61,6 +78,33 @@ static inline uint32_t fpsToIntervalMs(uint32_t fps) {
   return (uint32_t)(1000UL / fps);
 }
 
+// Blank the panel right away (state transitions). The panel changed behind the
+// canvas' back, so the next present must repaint every pixel.
+static inline void clearPanel() {
+  dma_display->clearScreen();
+  frameCanvas->invalidate();
+}
+
+// True while the last present drew the profiler overlay into the canvas (incremental
+// game renderers then have to repaint, see GameBase::onCanvasLost()).
+static bool overlayOnCanvas = false;
+
+// Present the canvas (plus the optional profiler overlay); timed as PHASE_PRESENT.
+static inline void presentCanvas() {
+  overlayOnCanvas = frameProfiler.overlayVisible();
+  frameProfiler.drawOverlay(frameCanvas);
+  const uint32_t t0 = frameProfiler.begin();
+  presentFrame(frameCanvas, dma_display);
+  frameProfiler.end(FrameProfiler::PHASE_PRESENT, t0);
+}
+
+// Hand the running game's present-time fade (GameBase::presentFade()) to the canvas.
+static inline void applyGameFade() {
+  const GameBase::PresentFade fade = currentGame->presentFade();
+  if (fade.w > 0 && fade.h > 0) frameCanvas->setFade(fade.level, fade.x, fade.y, fade.w, fade.h);
+  else frameCanvas->setFade(fade.level);
+}
+
 static inline bool shouldRenderNow(uint32_t nowMs, uint32_t& lastRenderMs, uint32_t intervalMs, bool& force) {
   if (force) {
     force = false;
@@ -76,30 +120,32 @@ static inline bool shouldRenderNow(uint32_t nowMs, uint32_t& lastRenderMs, uint3
 }
 
 // ---------------------------------------------------------
-// Controller helpers (Bluepad32 API surface varies by version/controller)
+// Serial debug commands (profiler + input log + game registry)
 // ---------------------------------------------------------
-// We intentionally use SFINAE to check for different APIs without hard-binding.
-struct ExitButton {
-  template <typename T>
-  static auto miscButtons(T* c, int) -> decltype(c->miscButtons(), uint16_t()) { return (uint16_t)c->miscButtons(); }
-  template <typename T>
-  static uint16_t miscButtons(T*, ...) { return 0; }
-
-  template <typename T>
-  static auto start(T* c, int) -> decltype(c->start(), bool()) { return (bool)c->start(); }
-  template <typename T>
-  static bool start(T*, ...) { return false; }
-};
-
-static inline bool isStartPressed(ControllerPtr ctl) {
-  if (!ctl) return false;
-  // Prefer a dedicated start() accessor if present.
-  if (ExitButton::start(ctl, 0)) return true;
-
-  // Otherwise fall back to miscButtons() bitmask (common in Bluepad32).
-  // Convention in Bluepad32: START is typically bit 0x04 in miscButtons().
-  const uint16_t misc = ExitButton::miscButtons(ctl, 0);
-  return (misc & 0x04) != 0;
+static void pollSerialCommands() {
+  while (Serial.available() > 0) {
+    const char c = (char)Serial.read();
+    if (frameProfiler.handleCommand(c)) continue;
+    switch (c) {
+      case 'g':
+        GameRegistry::dump(Serial);
+        break;
+      case 'R':
+        inputLog.armRecording();
+        Serial.println(F("[InputLog] recording armed (starts with the next game)"));
+        break;
+      case 'X':
+        inputLog.stop();
+        Serial.print(F("[InputLog] stopped, bytes="));
+        Serial.println(inputLog.size());
+        break;
+      case 'D':
+        inputLog.dumpHex(Serial);
+        break;
+      default:
+        break;
+    }
+  }
 }
 
 // ---------------------------------------------------------
@@ -123,65 +169,11 @@ AppState resumeStateAfterController = STATE_MENU;
 // STATE_USER_SELECT first, then continue here.
 AppState nextStateAfterUserSelect = STATE_MENU;
 
-// ---------------------------------------------------------
-// Input edge helpers (START)
-// ---------------------------------------------------------
-static inline bool startPressedEdge(uint8_t padIndex, ControllerManager* input) {
-  static bool lastPressed[MAX_GAMEPADS] = { false, false, false, false };
-  if (!input || padIndex >= MAX_GAMEPADS) return false;
-
-  ControllerPtr ctl = input->getController((int)padIndex);
-  const bool pressed = (ctl != nullptr) && isStartPressed(ctl);
-  const bool edge = pressed && !lastPressed[padIndex];
-  lastPressed[padIndex] = pressed;
-  return edge;
-}
-
-static inline bool aPressedEdge(uint8_t padIndex, ControllerManager* input) {
-  static bool lastPressed[MAX_GAMEPADS] = { false, false, false, false };
-  if (!input || padIndex >= MAX_GAMEPADS) return false;
-
-  ControllerPtr ctl = input->getController((int)padIndex);
-  const bool pressed = (ctl != nullptr) && (bool)ctl->a();
-  const bool edge = pressed && !lastPressed[padIndex];
-  lastPressed[padIndex] = pressed;
-  return edge;
-}
-
-static inline bool bPressedEdge(uint8_t padIndex, ControllerManager* input) {
-  static bool lastPressed[MAX_GAMEPADS] = { false, false, false, false };
-  if (!input || padIndex >= MAX_GAMEPADS) return false;
-
-  ControllerPtr ctl = input->getController((int)padIndex);
-  const bool pressed = (ctl != nullptr) && (bool)ctl->b();
-  const bool edge = pressed && !lastPressed[padIndex];
-  lastPressed[padIndex] = pressed;
-  return edge;
-}
-
-static inline int8_t firstPadWithStartEdge(ControllerManager* input) {
-  if (!input) return -1;
-  for (int i = 0; i < MAX_GAMEPADS; i++) {
-    if (startPressedEdge((uint8_t)i, input)) return (int8_t)i;
-  }
-  return -1;
-}
-
-static inline int8_t firstPadWithAEdge(ControllerManager* input) {
-  if (!input) return -1;
-  for (int i = 0; i < MAX_GAMEPADS; i++) {
-    if (aPressedEdge((uint8_t)i, input)) return (int8_t)i;
-  }
-  return -1;
-}
-
-static inline int8_t firstPadWithBEdge(ControllerManager* input) {
-  if (!input) return -1;
-  for (int i = 0; i < MAX_GAMEPADS; i++) {
-    if (bPressedEdge((uint8_t)i, input)) return (int8_t)i;
-  }
-  return -1;
-}
+#if ENABLE_DUAL_CORE
+// Task entry points (defined after loop-side helpers below).
+static void inputTaskMain(void*);
+static void engineTaskMain(void*);
+#endif
 
 // ---------------------------------------------------------
 // Setup
@@ -270,6 +262,9 @@ void setup() {
     Serial.println("ERROR: Display begin() failed");
     while (true) {}
   }
+
+  // RAM canvas with the same geometry (never begin()-ed; it owns no DMA memory).
+  frameCanvas = new FrameCanvas(mxconfig);
   
   // Load settings and apply brightness
   Serial.println(F("[Init] Loading settings..."));
@@ -317,12 +312,46 @@ void setup() {
   presentFrame(dma_display);
 
   Serial.println("[Init] Display Service Started");
+
+  // Profiler context names (AppState order, then menu game slots).
+  static const char* const STATE_NAMES[PROFILE_CTX_GAMES] = {
+    "NO_CONTROLLER", "MENU", "SETTINGS", "USER_SELECT", "LEADERBOARD", "PAUSE", "GAME_RUNNING"
+  };
+  for (uint8_t i = 0; i < PROFILE_CTX_GAMES; i++) frameProfiler.setContextName(i, STATE_NAMES[i]);
+  for (uint8_t i = 0; i < GameRegistry::COUNT; i++) {
+    frameProfiler.setContextName((uint8_t)(PROFILE_CTX_GAMES + i), GameRegistry::ENTRIES[i].name);
+  }
+
+#if ENABLE_DUAL_CORE
+  // Bluetooth/audio on core 0, game simulation + rendering on core 1.
+  // The engine task is the only one touching the display and game state.
+  if (!EngineTasks::spawnPinned("input", inputTaskMain, nullptr,
+                                INPUT_TASK_STACK, INPUT_TASK_PRIORITY, INPUT_TASK_CORE) ||
+      !EngineTasks::spawnPinned("engine", engineTaskMain, nullptr,
+                                ENGINE_TASK_STACK, ENGINE_TASK_PRIORITY, ENGINE_TASK_CORE)) {
+    Serial.println(F("[Init] FATAL: could not start input/engine tasks"));
+    while (true) { delay(1000); }
+  }
+  Serial.println(F("[Init] Input task (core 0) + engine task (core 1) started"));
+#endif
 }
 
 // ---------------------------------------------------------
-// Main Loop
+// Input pump (core 0 with ENABLE_DUAL_CORE)
 // ---------------------------------------------------------
-void loop() {
+static void inputPump() {
+  // Allow Bluepad32 to process incoming packets (Required) and publish the
+  // input snapshot the engine reads.
+  globalControllerManager->update();
+
+  // Audio service tick (non-blocking)
+  globalAudio.update();
+}
+
+// ---------------------------------------------------------
+// Engine tick: state machine, game update, render (core 1 with ENABLE_DUAL_CORE)
+// ---------------------------------------------------------
+static void engineTick() {
   // Frame pacing
   static uint32_t lastMenuRenderMs = 0;
   static uint32_t lastGameRenderMs = 0;
@@ -336,12 +365,20 @@ void loop() {
     gameIntervalMs = fpsToIntervalMs(currentGame->preferredRenderFps());
   }
 
-  // 1. Hardware/Protocol Updates
-  // Allow Bluepad32 to process incoming packets (Required)
-  globalControllerManager->update();
-
-  // Audio service tick (non-blocking)
-  globalAudio.update();
+  // 1. Latest input snapshot (published by inputPump()); stable for this whole tick.
+  globalControllerManager->acquireSnapshot();
+  // Record the snapshot, or replace it with logged input during a replay.
+  inputLog.tick(globalControllerManager, nowMs);
+  // Button edges / holds for menus and state transitions (see engine/InputTracker.h).
+  globalInput.update(globalControllerManager, nowMs);
+
+  // Profiler: serial commands + attribute this tick to the state (and running game).
+  pollSerialCommands();
+  const bool profileGame = (currentGame != nullptr) && currentGameSlot >= 0 &&
+                           (currentState == STATE_GAME_RUNNING || currentState == STATE_PAUSE);
+  frameProfiler.beginTick((uint8_t)currentState,
+                          profileGame ? (uint8_t)(PROFILE_CTX_GAMES + currentGameSlot) : FrameProfiler::NO_CONTEXT,
+                          (profileGame ? gameIntervalMs : menuIntervalMs) * 1000UL);
 
   // 2. State Machine Logic
   switch (currentState) {
@@ -357,17 +394,17 @@ void loop() {
         nextStateAfterUserSelect = resumeStateAfterController;
         userSelectMenu.beginForPad(0);
         currentState = STATE_USER_SELECT;
-        dma_display->clearScreen();
+        clearPanel();
         forceMenuRender = true;
       } else {
         // Render waiting screen with small font
         static unsigned long lastFrame = 0;
         if (millis() - lastFrame > 500) {  // Blink effect
-          dma_display->fillScreen(0);
-          SmallFont::drawString(dma_display, 10, 18, "NO GAMEPAD", COLOR_RED);
-          SmallFont::drawString(dma_display, 10, 28, "Connect BT", COLOR_WHITE);
-          SmallFont::drawString(dma_display, 11, 38, "Scanning...", COLOR_BLUE);
-          presentFrame(dma_display);
+          frameCanvas->fillScreen(0);
+          SmallFont::drawString(frameCanvas, 10, 18, "NO GAMEPAD", COLOR_RED);
+          SmallFont::drawString(frameCanvas, 10, 28, "Connect BT", COLOR_WHITE);
+          SmallFont::drawString(frameCanvas, 11, 38, "Scanning...", COLOR_BLUE);
+          presentCanvas();
           lastFrame = millis();
         }
       }
@@ -383,70 +420,56 @@ void loop() {
       } else {
         // Draw Menu (capped FPS to reduce scanline/tearing artifacts)
         if (shouldRenderNow(nowMs, lastMenuRenderMs, menuIntervalMs, forceMenuRender)) {
-          menu.draw(dma_display, globalControllerManager);
-          presentFrame(dma_display);
+          const uint32_t t0 = frameProfiler.begin();
+          menu.draw(frameCanvas, globalControllerManager);
+          frameProfiler.end(FrameProfiler::PHASE_DRAW, t0);
+          presentCanvas();
         }
 
         // Handle Input
+        const uint32_t tUpdate = frameProfiler.begin();
         int gameSelection = menu.update(globalControllerManager);
+        frameProfiler.end(FrameProfiler::PHASE_UPDATE, tUpdate);
         if (gameSelection != -1) {
           // Valid selection made
           int players = globalControllerManager->getConnectedCount();
           
-          if (gameSelection == (Menu::NUM_OPTIONS - 1)) {  // Settings (last option)
+          if (gameSelection == Menu::SETTINGS_OPTION) {
             currentState = STATE_SETTINGS;
             settingsMenu.selected = 0;
-            dma_display->clearScreen();
+            clearPanel();
             forceMenuRender = true;
-          } else if (gameSelection == (Menu::NUM_OPTIONS - 2)) { // Leaderboard (just before Settings)
+          } else if (gameSelection == Menu::LEADERBOARD_OPTION) {
             currentState = STATE_LEADERBOARD;
-            dma_display->clearScreen();
+            clearPanel();
             forceMenuRender = true;
           } else {
-            if (currentGame != nullptr) delete currentGame;
-            
-            switch (gameSelection) {
-              case 0:  // Snake
-                currentGame = new SnakeGame();
-                break;
-              case 1:  // Tron
-                currentGame = new TronGame();
-                break;
-              case 2:  // Pong
-                currentGame = new PongGame();
-                break;
-              case 3:  // Breakout
-                currentGame = new BreakoutGame();
-                break;
-              case 4:  // Shooter
-                currentGame = new ShooterGame();
-                break;
-              case 5:  // Labyrinth
-                currentGame = new LabyrinthGame();
-                break;
-              case 6:  // Tetris (only visible with 1 player)
-                if (players == 1) {
-                  currentGame = new TetrisGame();
-                }
-                break;
-              case 7:  // Asteroids (only visible with 1 player)
-                if (players == 1) {
-                  currentGame = new AsteroidsGame();
-                }
-                break;
-              case 8:  // Music
-                currentGame = new MusicApp();
-                break;
-              case 9:  // MVisual
-                currentGame = new MVisualApp();
-                break;
-              default:
-                currentGame = nullptr;
-                break;
+            gameArena.destroy();
+            currentGame = nullptr;
+
+            const GameDescriptor* desc = GameRegistry::at(gameSelection);
+            if (desc != nullptr && desc->acceptsPlayers(players)) {
+              // Seeds random() for recorded/replayed runs, so do this before construction.
+              inputLog.onGameStart((uint8_t)gameSelection, nowMs);
+
+              // Launch latency (construct + start) per registry entry; see serial 'g'.
+              const uint32_t launchT0 = (uint32_t)micros();
+              currentGame = gameArena.create(*desc);
+              if (currentGame != nullptr) {
+                currentGame->start();
+                GameRegistry::launchStats[gameSelection].record((uint32_t)micros() - launchT0);
+              }
+
+              #if DEBUG_LEADERBOARD
+              if (currentGame != nullptr && desc->hasLeaderboard() && strcmp(desc->leaderboardId, currentGame->leaderboardId()) != 0) {
+                Serial.print(F("[Engine] WARNING: registry leaderboard id mismatch for "));
+                Serial.println(desc->name);
+              }
+              #endif
             }
-            
+
             if (currentGame != nullptr) {
-              currentGame->start();
+              currentGameSlot = (int8_t)gameSelection;
               // New game run started. Increment token (never rely on pointer equality).
               currentGameRunId++;
               currentState = STATE_GAME_RUNNING;
@@ -456,15 +479,15 @@ void loop() {
         }
 
         // START in menu: open user select for the controller that pressed START.
-        const int8_t sp = firstPadWithStartEdge(globalControllerManager);
+        const int8_t sp = globalInput.firstPadPressed(InputTracker::BTN_START);
         if (sp >= 0) {
           globalAudio.uiStartStop();
           nextStateAfterUserSelect = STATE_MENU;
           userSelectMenu.beginForPad((uint8_t)sp);
           currentState = STATE_USER_SELECT;
-          dma_display->clearScreen();
+          clearPanel();
           forceMenuRender = true;
-          delay(300); // debounce START
+          globalInput.lockout(300);
         }
       }
       break;
@@ -478,15 +501,17 @@ void loop() {
       } else {
         // Draw Settings Menu (capped FPS)
         if (shouldRenderNow(nowMs, lastMenuRenderMs, menuIntervalMs, forceMenuRender)) {
-          settingsMenu.draw(dma_display, globalControllerManager);
-          presentFrame(dma_display);
+          const uint32_t t0 = frameProfiler.begin();
+          settingsMenu.draw(frameCanvas, globalControllerManager);
+          frameProfiler.end(FrameProfiler::PHASE_DRAW, t0);
+          presentCanvas();
         }
         
         // Handle Input
         if (settingsMenu.update(globalControllerManager)) {
           // User wants to go back
           currentState = STATE_MENU;
-          dma_display->clearScreen();
+          clearPanel();
           forceMenuRender = true;
           // Apply brightness if it was changed
           dma_display->setBrightness8(globalSettings.getBrightness());
@@ -501,16 +526,18 @@ void loop() {
         currentState = STATE_NO_CONTROLLER;
       } else {
         if (shouldRenderNow(nowMs, lastMenuRenderMs, menuIntervalMs, forceMenuRender)) {
-          userSelectMenu.draw(dma_display, globalControllerManager);
-          presentFrame(dma_display);
+          const uint32_t t0 = frameProfiler.begin();
+          userSelectMenu.draw(frameCanvas, globalControllerManager);
+          frameProfiler.end(FrameProfiler::PHASE_DRAW, t0);
+          presentCanvas();
         }
         if (userSelectMenu.update(globalControllerManager)) {
           currentState = nextStateAfterUserSelect;
-          dma_display->clearScreen();
+          clearPanel();
           forceMenuRender = true;
           forceGameRender = true; // if we return into PAUSE/GAME, render immediately
-          // Debounce the confirming 'A' press so it doesn't immediately select "Snake" in the menu.
-          delay(250);
+          // Ignore presses briefly so the confirming 'A' can't select a menu entry on bounce.
+          globalInput.lockout(250);
         }
       }
       break;
@@ -522,38 +549,54 @@ void loop() {
         currentState = STATE_NO_CONTROLLER;
       } else {
         if (shouldRenderNow(nowMs, lastMenuRenderMs, menuIntervalMs, forceMenuRender)) {
-          leaderboardMenu.draw(dma_display, globalControllerManager);
-          presentFrame(dma_display);
+          const uint32_t t0 = frameProfiler.begin();
+          leaderboardMenu.draw(frameCanvas, globalControllerManager);
+          frameProfiler.end(FrameProfiler::PHASE_DRAW, t0);
+          presentCanvas();
         }
         if (leaderboardMenu.update(globalControllerManager)) {
           currentState = STATE_MENU;
-          dma_display->clearScreen();
+          clearPanel();
           forceMenuRender = true;
         }
       }
       break;
 
     // --- STATE: PAUSE ---
-    // Freeze game updates, draw the game as a background, overlay pause UI.
+    // Freeze game updates; the frozen game is rendered once into a dimmed background
+    // snapshot and the overlay is redrawn only when the pause selection changes.
     case STATE_PAUSE:
       if (globalControllerManager->getConnectedCount() == 0) {
         resumeStateAfterController = STATE_PAUSE;
         currentState = STATE_NO_CONTROLLER;
       } else if (currentGame) {
-        // Render underlying game + overlay (capped FPS using game pacing).
-        gameIntervalMs = fpsToIntervalMs(currentGame->preferredRenderFps());
-        if (shouldRenderNow(nowMs, lastGameRenderMs, gameIntervalMs, forceGameRender)) {
-          currentGame->draw(dma_display);
-          pauseMenu.draw(dma_display);
-          presentFrame(dma_display);
+        // forceGameRender marks (re)entry: start, or back from user select / reconnect.
+        static int pauseShownSelection = -1;
+        if (forceGameRender) {
+          forceGameRender = false;
+          const uint32_t t0 = frameProfiler.begin();
+          currentGame->onCanvasLost();
+          currentGame->draw(frameCanvas);
+          applyGameFade(); // paused mid-transition: snapshot the frame as it was shown
+          frameCanvas->captureBackground(PAUSE_BACKGROUND_DIM_SHIFT);
+          frameProfiler.end(FrameProfiler::PHASE_DRAW, t0);
+          pauseShownSelection = -1;
+        }
+        if (pauseMenu.selection() != pauseShownSelection) {
+          pauseShownSelection = pauseMenu.selection();
+          const uint32_t t0 = frameProfiler.begin();
+          frameCanvas->restoreBackground();
+          pauseMenu.draw(frameCanvas);
+          frameProfiler.end(FrameProfiler::PHASE_DRAW, t0);
+          presentCanvas();
         }
 
         // START toggles resume (edge-triggered to avoid instant re-pause)
-        if (startPressedEdge(pauseMenu.pad(), globalControllerManager)) {
+        if (globalInput.pressed(pauseMenu.pad(), InputTracker::BTN_START)) {
           globalAudio.uiStartStop();
           currentState = STATE_GAME_RUNNING;
           forceGameRender = true;
-          delay(250);
+          globalInput.lockout(250);
           break;
         }
 
@@ -561,14 +604,15 @@ void loop() {
         if (a == PauseMenu::ACTION_RESUME) {
           currentState = STATE_GAME_RUNNING;
           forceGameRender = true;
-          delay(250);
+          globalInput.lockout(250);
         } else if (a == PauseMenu::ACTION_QUIT_TO_MENU) {
-          delete currentGame;
+          gameArena.destroy();
           currentGame = nullptr;
+          inputLog.onGameEnd();
           currentState = STATE_MENU;
-          dma_display->clearScreen();
+          clearPanel();
           forceMenuRender = true;
-          delay(300);
+          globalInput.lockout(300);
         }
       } else {
         // No game to pause -> fallback to menu.
@@ -592,7 +636,22 @@ void loop() {
           gameIntervalMs = fpsToIntervalMs(currentGame->preferredRenderFps());
 
           // 1. Update Physics/Logic
-          currentGame->update(globalControllerManager);
+          // Fixed-step games advance by real elapsed time (bounded catch-up); legacy
+          // games keep their self-throttled update().
+          const uint16_t stepMs = currentGame->fixedStepMs();
+          const uint32_t tUpdate = frameProfiler.begin();
+          if (stepMs == 0) {
+            currentGame->update(globalControllerManager);
+          } else {
+            // forceGameRender marks (re)entry into the running game (start, resume,
+            // reconnect, reset): don't catch up on time spent outside of it.
+            if (forceGameRender) gameClock.reset(nowMs);
+            const uint8_t steps = gameClock.advance(nowMs, stepMs);
+            for (uint8_t i = 0; i < steps && !currentGame->isGameOver(); i++) {
+              currentGame->step(globalControllerManager, gameClock.stepTimeMs(i, steps, stepMs), stepMs);
+            }
+          }
+          frameProfiler.end(FrameProfiler::PHASE_UPDATE, tUpdate);
 
           // -----------------------------------------------------
           // Auto-submit score to leaderboard once per game run
@@ -608,7 +667,8 @@ void loop() {
           if (!submitted && currentGame->isGameOver()) {
             // Only submit for games that opt in (see GameBase leaderboard methods).
             // NOTE: leaderboard methods are optional with safe defaults.
-            if (currentGame->leaderboardEnabled()) {
+            const GameDescriptor* desc = GameRegistry::at(currentGameSlot);
+            if (currentGame->leaderboardEnabled() && desc != nullptr && desc->hasLeaderboard()) {
               #if DEBUG_LEADERBOARD
               Serial.print(F("[Engine] Game over detected, submitting score: gameId="));
               Serial.print(currentGame->leaderboardId());
@@ -625,7 +685,7 @@ void loop() {
               Serial.println(tag);
               #endif
               
-              Leaderboard::submitScore(currentGame->leaderboardId(),
+              Leaderboard::submitScore(desc->leaderboardId,
                                        currentGame->leaderboardName(),
                                        currentGame->leaderboardScore(),
                                        tag);
@@ -641,9 +701,15 @@ void loop() {
           }
 
           // 2. Render Frame (capped FPS to reduce tearing/scanline artifacts)
+          // The canvas only still holds the game's last frame if nothing else drew since.
+          const bool canvasLost = forceGameRender || overlayOnCanvas;
           if (shouldRenderNow(nowMs, lastGameRenderMs, gameIntervalMs, forceGameRender)) {
-            currentGame->draw(dma_display);
-            presentFrame(dma_display);
+            const uint32_t t0 = frameProfiler.begin();
+            if (canvasLost) currentGame->onCanvasLost();
+            currentGame->drawInterpolated(frameCanvas, gameClock.alpha(stepMs));
+            frameProfiler.end(FrameProfiler::PHASE_DRAW, t0);
+            applyGameFade();
+            presentCanvas();
           }
 
           // -----------------------------------------------------
@@ -652,27 +718,28 @@ void loop() {
           // - B: back to menu
           // - START: back to menu (nothing to pause)
           // -----------------------------------------------------
-          // IMPORTANT: We still evaluate edges every frame so holding a button
-          // doesn't trigger immediately when the game-over state appears.
+          // Edges only (InputTracker): holding a button doesn't trigger immediately
+          // when the game-over state appears.
           const bool isOver = currentGame->isGameOver();
-          const int8_t aPad = firstPadWithAEdge(globalControllerManager);
-          const int8_t bPad = firstPadWithBEdge(globalControllerManager);
-          const int8_t startPad = firstPadWithStartEdge(globalControllerManager);
+          const int8_t aPad = globalInput.firstPadPressed(InputTracker::BTN_A);
+          const int8_t bPad = globalInput.firstPadPressed(InputTracker::BTN_B);
+          const int8_t startPad = globalInput.firstPadPressed(InputTracker::BTN_START);
 
           if (isOver) {
             if (aPad >= 0) {
               currentGame->reset();
               currentGameRunId++; // treat as a new run for leaderboard submission
               forceGameRender = true;
-              delay(250);
+              globalInput.lockout(250);
             } else if (bPad >= 0 || startPad >= 0) {
               if (startPad >= 0) globalAudio.uiStartStop();
-              delete currentGame;
+              gameArena.destroy();
               currentGame = nullptr;
+              inputLog.onGameEnd();
               currentState = STATE_MENU;
-              dma_display->clearScreen();
+              clearPanel();
               forceMenuRender = true;
-              delay(300);
+              globalInput.lockout(300);
             }
           } else {
             // START in-game: open the pause menu (do NOT exit the game).
@@ -681,7 +748,7 @@ void loop() {
               pauseMenu.beginForPad((uint8_t)startPad);
               currentState = STATE_PAUSE;
               forceGameRender = true;
-              delay(300);  // Debounce START press
+              globalInput.lockout(300);
             }
           }
         }
@@ -689,7 +756,39 @@ void loop() {
       break;
   }
 
+  frameProfiler.endTick();
+}
+
+#if ENABLE_DUAL_CORE
+static void inputTaskMain(void*) {
+  for (;;) {
+    inputPump();
+    EngineTasks::sleepMs(INPUT_TASK_PERIOD_MS);
+  }
+}
+
+static void engineTaskMain(void*) {
+  for (;;) {
+    engineTick();
+    // Small yield to feed Watchdog Timer (WDT)
+    EngineTasks::sleepMs(1);
+  }
+}
+#endif
+
+// ---------------------------------------------------------
+// Main Loop
+// ---------------------------------------------------------
+void loop() {
+#if ENABLE_DUAL_CORE
+  // Input and engine run in their own pinned tasks (started at the end of setup()).
+  delay(1000);
+#else
+  inputPump();
+  engineTick();
+
   // Small yield to feed Watchdog Timer (WDT)
   // Bluepad32 and DMA lib usually play nice, but this is safe practice
   delay(1);
+#endif
 }
\ No newline at end of file
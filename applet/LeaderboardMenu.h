@@ -2,14 +2,17 @@
 #include <Arduino.h>
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include "../engine/ControllerManager.h"
+#include "../engine/InputTracker.h"
 #include "../component/SmallFont.h"
 #include "../component/ScrollableList.h"
 #include "../engine/Leaderboard.h"
+#include "../Games/GameRegistry.h"
 
 /**
  * LeaderboardMenu
  * ---------------
  * Applet-style screen (host-managed state) for browsing per-game high scores.
+ * Lists every GameRegistry entry with a leaderboard id (registry order), scored or not.
  *
  * Controls:
  * - Up/Down: navigate
@@ -45,12 +48,8 @@ public:
         ControllerPtr ctl = input ? input->getController(0) : nullptr;
         if (!ctl) return false;
 
-        const unsigned long now = millis();
-
         // Global back behavior within this applet.
-        static unsigned long lastB = 0;
-        if (ctl->b() && (now - lastB > 200)) {
-            lastB = now;
+        if (globalInput.pressed(0, InputTracker::BTN_B)) {
             if (screen == SCREEN_SCORES) {
                 screen = SCREEN_GAMES;
                 return false;
@@ -62,7 +61,7 @@ public:
             const int selActual = gamesList.update(input, gamesModel);
             selectedGame = gamesList.selectedActual;
             if (selActual != -1) {
-                // Enter score view (selectedGame is an actual index into [0..gameCount-1])
+                // Enter score view (selectedGame indexes GameRegistry::leaderboardAt())
                 screen = SCREEN_SCORES;
                 scoresList.selectedActual = 0;
             }
@@ -86,10 +85,10 @@ private:
 
     class GamesModel : public ListModel {
     public:
-        int itemCount() const override { return (int)Leaderboard::gameCount(); }
+        int itemCount() const override { return (int)GameRegistry::leaderboardCount(); }
         const char* label(int actualIndex) const override {
-            const Leaderboard::Entry* e = Leaderboard::entryAt((uint8_t)actualIndex);
-            return (e && e->name[0]) ? e->name : "UNKNOWN";
+            const GameDescriptor* g = GameRegistry::leaderboardAt(actualIndex);
+            return g ? g->name : "UNKNOWN";
         }
     } gamesModel;
 
@@ -114,7 +113,7 @@ private:
     } scoresModel{this};
 
     void drawGames(MatrixPanel_I2S_DMA* display) {
-        const int count = (int)Leaderboard::gameCount();
+        const int count = (int)GameRegistry::leaderboardCount();
         if (count <= 0) {
             SmallFont::drawString(display, 8, HUD_H + 18, "NO SCORES", COLOR_WHITE);
             SmallFont::drawString(display, 8, HUD_H + 28, "PLAY GAME", COLOR_WHITE);
@@ -132,26 +131,27 @@ private:
     }
 
     void drawScores(MatrixPanel_I2S_DMA* display) {
-        const int count = (int)Leaderboard::gameCount();
+        const int count = (int)GameRegistry::leaderboardCount();
         if (count <= 0) {
             screen = SCREEN_GAMES;
             return;
         }
 
         const int gameIdx = constrain(selectedGame, 0, count - 1);
-        const Leaderboard::Entry* e = Leaderboard::entryAt((uint8_t)gameIdx);
-        if (!e) {
+        const GameDescriptor* g = GameRegistry::leaderboardAt(gameIdx);
+        if (!g) {
             screen = SCREEN_GAMES;
             return;
         }
+        const Leaderboard::Entry* e = Leaderboard::entryForGameId(g->leaderboardId);
 
         // Show selected game name in HUD area as "L: name".
         char hud[24];
-        snprintf(hud, sizeof(hud), "L:%s", e->name);
+        snprintf(hud, sizeof(hud), "L:%s", (e && e->name[0]) ? e->name : g->name);
         SmallFont::drawString(display, 2, 6, hud, COLOR_YELLOW);
 
-        // If all scores are 0, show a hint.
-        if (e->scores[0] == 0) {
+        // Not played yet (no entry) or all scores 0: show a hint.
+        if (!e || e->scores[0] == 0) {
             SmallFont::drawString(display, 8, HUD_H + 18, "NO SCORES", COLOR_WHITE);
             SmallFont::drawString(display, 8, HUD_H + 28, "YET", COLOR_WHITE);
             return;
@@ -3,15 +3,19 @@
 #include <math.h>
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include "../engine/ControllerManager.h"
+#include "../engine/InputTracker.h"
 #include "../component/SmallFont.h"
 #include "../engine/Settings.h"
 #include "../component/ScrollableList.h"
+#include "../Games/GameRegistry.h"
 
 class Menu : public ListModel {
 public:
-    // Main menu options (actual indices). Keep Settings LAST (engine treats it specially).
-    const char* options[12] = { "Snake", "Tron", "Pong", "Breakout", "Shooter", "Labyrinth", "Tetris", "Asteroids", "Music", "MVisual", "Leaderboard", "Settings" };
-    static const int NUM_OPTIONS = 12;
+    // Main menu options (actual indices): every GameRegistry entry (index == game slot),
+    // then Leaderboard and Settings. Keep Settings LAST (engine treats it specially).
+    static const int NUM_OPTIONS = GameRegistry::COUNT + 2;
+    static const int LEADERBOARD_OPTION = NUM_OPTIONS - 2;
+    static const int SETTINGS_OPTION = NUM_OPTIONS - 1;
 
     // Reusable list widget state (selection + scrolling + input).
     ScrollableList list;
@@ -26,19 +30,19 @@ public:
     // ListModel (for ScrollableList)
     // -----------------------------------------------------
     int itemCount() const override { return NUM_OPTIONS; }
-    const char* label(int actualIndex) const override { return options[actualIndex]; }
+    const char* label(int actualIndex) const override {
+        if (actualIndex == LEADERBOARD_OPTION) return "Leaderboard";
+        if (actualIndex == SETTINGS_OPTION) return "Settings";
+        const GameDescriptor* g = GameRegistry::at(actualIndex);
+        return g ? g->name : "";
+    }
     bool isItemVisible(int index) const override { return isOptionVisible(index, playersContext); }
     
     // Check if option should be visible
+    // Games are shown only for a player count they support; Leaderboard/Settings always.
     bool isOptionVisible(int index, int players) const {
-        if (index == 6) {  // Tetris
-            return players == 1;
-        }
-        if (index == 7) {  // Asteroids
-            return players == 1;
-        }
-        // All others always visible
-        return true;  // All other options always visible
+        const GameDescriptor* g = GameRegistry::at(index);
+        return g ? g->acceptsPlayers(players) : true;
     }
 
     void draw(MatrixPanel_I2S_DMA* d, ControllerManager* input) {
@@ -67,7 +71,7 @@ public:
         int px = PANEL_RES_X - (MAX_GAMEPADS * TOKEN_STRIDE);
         for (int i = 0; i < MAX_GAMEPADS; i++) {
             const bool connected = (input && input->getController(i) != nullptr);
-            SmallFont::drawStringF(d, px, 6, connected ? pColors[i] : offC, "P%d", i + 1);
+            SmallFont::drawValue(d, px, 6, connected ? pColors[i] : offC, "P", i + 1);
             px += TOKEN_STRIDE;
         }
 
@@ -84,13 +88,9 @@ public:
         playersContext = input->getConnectedCount();
         const int sel = list.update(input, *this);
 
-        // Cycle player color with Y button (debounced)
-        ControllerPtr ctl = input->getController(0);
-        const unsigned long now = millis();
-        static unsigned long lastColorChange = 0;
+        // Cycle player color with Y button (one step per press).
         // Bluepad32 exposes ABXY on most pads; if a controller doesn't have Y, this stays false.
-        if (ctl && ctl->y() && (now - lastColorChange > 200)) {
-            lastColorChange = now;
+        if (globalInput.pressed(0, InputTracker::BTN_Y)) {
             globalSettings.cyclePlayerColor(1);
             globalSettings.save();
         }
@@ -2,6 +2,7 @@
 #include <Arduino.h>
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include "../engine/ControllerManager.h"
+#include "../engine/InputTracker.h"
 #include "../component/SmallFont.h"
 #include "../component/ScrollableList.h"
 
@@ -35,8 +36,8 @@ public:
     }
 
     void draw(MatrixPanel_I2S_DMA* d) {
-        // NOTE: caller typically draws the underlying game first, then calls this.
-        // We draw a simple overlay on top.
+        // NOTE: caller provides the background first (the engine restores a dimmed
+        // snapshot of the game), then calls this. We draw a simple overlay on top.
         // 1) HUD title (keeps the "paused" state obvious and reuses our UI convention)
         d->fillRect(0, 0, PANEL_RES_X, HUD_H, COLOR_BLACK);
         SmallFont::drawString(d, 2, 6, "PAUSED", COLOR_YELLOW);
@@ -74,8 +75,8 @@ public:
         ControllerPtr ctl = input ? input->getController(targetPad) : nullptr;
         if (!ctl) return ACTION_NONE;
 
-        // Quick resume on B (debounced in ScrollableList already, but we keep it explicit).
-        if (ctl->b()) return ACTION_RESUME;
+        // Quick resume on B (press edge, so a B held from the game doesn't resume at once).
+        if (globalInput.pressed(targetPad, InputTracker::BTN_B)) return ACTION_RESUME;
 
         const int sel = list.updateForPad(input, model, targetPad);
         if (sel == -1) return ACTION_NONE;
@@ -88,6 +89,8 @@ public:
     }
 
     uint8_t pad() const { return targetPad; }
+    /** Highlighted entry (the engine redraws the overlay only when this changes). */
+    int selection() const { return list.selectedActual; }
 
 private:
     uint8_t targetPad = 0;
@@ -3,6 +3,7 @@
 #include <math.h>
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include "../engine/ControllerManager.h"
+#include "../engine/InputTracker.h"
 #include "../component/SmallFont.h"
 #include "../engine/Settings.h"
 #include "../component/ScrollableList.h"
@@ -102,7 +103,6 @@ public:
         ControllerPtr ctl = input->getController(0);
         if (!ctl) return false;
         
-        const uint8_t dpad = ctl->dpad();
         const unsigned long now = millis();
 
         // ----------------------
@@ -115,30 +115,15 @@ public:
         // ----------------------
         // Adjust (analog X + D-pad Left/Right)
         // ----------------------
-        // (Keep the old adjustment logic, but make the "prevDpad" state per-instance.)
-        const bool up = (dpad & 0x01) != 0;
-        const bool down = (dpad & 0x02) != 0;
-        (void)up; (void)down; // kept for readability symmetry with the old code.
-
-        const bool left = (dpad & 0x08) != 0;
-        const bool right = (dpad & 0x04) != 0;
-        const bool prevLeft = (prevDpadAdj & 0x08) != 0;
-        const bool prevRight = (prevDpadAdj & 0x04) != 0;
+        // D-pad: press + hold repeat from the shared tracker.
+        const bool left = globalInput.down(0, InputTracker::BTN_LEFT);
+        const bool right = globalInput.down(0, InputTracker::BTN_RIGHT);
 
         int adjDir = 0;
-        if (left || right) {
-            if ((left && !prevLeft) || (right && !prevRight)) {
-                adjDir = left ? -1 : 1;
-                dpadAdjHoldStartMs = (uint32_t)now;
-                dpadAdjLastRepeatMs = (uint32_t)now;
-            } else if (dpadAdjHoldStartMs != 0 &&
-                       (uint32_t)(now - dpadAdjHoldStartMs) >= DPAD_REPEAT_DELAY_MS &&
-                       (uint32_t)(now - dpadAdjLastRepeatMs) >= DPAD_REPEAT_INTERVAL_MS) {
-                adjDir = left ? -1 : 1;
-                dpadAdjLastRepeatMs = (uint32_t)now;
-            }
-        } else {
-            dpadAdjHoldStartMs = 0;
+        if (globalInput.repeat(0, InputTracker::BTN_LEFT, DPAD_REPEAT_DELAY_MS, DPAD_REPEAT_INTERVAL_MS)) {
+            adjDir = -1;
+        } else if (globalInput.repeat(0, InputTracker::BTN_RIGHT, DPAD_REPEAT_DELAY_MS, DPAD_REPEAT_INTERVAL_MS)) {
+            adjDir = 1;
         }
 
         if (adjDir == 0 && !(left || right)) {
@@ -164,7 +149,6 @@ public:
             if (adjDir < 0) globalAudio.uiLeft();
             else globalAudio.uiRight();
         }
-        prevDpadAdj = dpad;
         
         // Select/Activate with A button (debounced by ScrollableList)
         if (selectIdx != -1) {
@@ -172,7 +156,6 @@ public:
                 // Reset to defaults
                 globalSettings.resetToDefaults();
                 globalSettings.save();
-                delay(300);
                 return false;  // Stay in menu
             } else if (selected == SETTING_REBOOT) {
                 globalSettings.save();
@@ -187,17 +170,14 @@ public:
             } else if (selected == SETTING_BACK) {
                 // Save all settings before going back
                 globalSettings.save();
-                delay(200);
                 return true;
             }
         }
         
         // Also allow B button to go back
-        static unsigned long lastB = 0;
-        if (ctl->b() && (now - lastB > 200)) {
-            lastB = now;
+        if (globalInput.pressed(0, InputTracker::BTN_B)) {
             globalSettings.save();
-            delay(200);
+            globalInput.lockout(200);
             return true;
         }
         
@@ -215,10 +195,7 @@ private:
 
     SettingsListModel model;
 
-    // Per-instance adjustment repeat state (left/right).
-    uint8_t prevDpadAdj = 0;
-    uint32_t dpadAdjHoldStartMs = 0;
-    uint32_t dpadAdjLastRepeatMs = 0;
+    // Per-instance analog adjustment repeat state (D-pad repeat lives in globalInput).
     uint32_t lastAnalogAdjMs = 0;
 
     static void drawRightValueThunk(MatrixPanel_I2S_DMA* d, int actualIndex, int yBaseline, bool /*isSelected*/, void* user) {
@@ -4,6 +4,7 @@
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include "../engine/ControllerManager.h"
 #include "../engine/AudioManager.h"
+#include "../engine/InputTracker.h"
 #include "SmallFont.h"
 
 /**
@@ -18,7 +19,8 @@
  *
  * How to use:
  * - Implement `ListModel` (or create a small adapter class) for your items.
- * - Keep one `ScrollableList` instance per screen so it owns its own input state.
+ * - Keep one `ScrollableList` instance per screen so it owns its own input state
+ *   (D-pad edges / repeat and A come from the shared `globalInput` tracker).
  * - Call `update()` each loop, and `draw()` whenever you render.
  */
 
@@ -96,7 +98,7 @@ public:
         uint16_t dpadRepeatDelayMs;
         uint16_t dpadRepeatIntervalMs;
 
-        // A button debounce
+        // After A selects an item, ignore new presses (all pads) for this long.
         uint16_t selectDebounceMs;
 
         InputConfig()
@@ -233,31 +235,15 @@ public:
         if (!ctl) return -1;
 
         const uint32_t now = (uint32_t)millis();
-        const uint8_t dpad = ctl->dpad();
 
         // --- D-pad Up/Down (edge press + hold repeat) ---
         int navDir = 0;
-        const bool dUp = (dpad & 0x01) != 0;
-        const bool dDown = (dpad & 0x02) != 0;
-        const bool prevUp = (prevDpad & 0x01) != 0;
-        const bool prevDown = (prevDpad & 0x02) != 0;
-        prevDpad = dpad;
-
-        if (dUp || dDown) {
-            if ((dUp && !prevUp) || (dDown && !prevDown)) {
-                navDir = dUp ? -1 : 1;
-                dpadHoldStartMs = now;
-                lastDpadRepeatMs = now;
-            } else {
-                if (dpadHoldStartMs != 0 &&
-                    (uint32_t)(now - dpadHoldStartMs) >= cfg.dpadRepeatDelayMs &&
-                    (uint32_t)(now - lastDpadRepeatMs) >= cfg.dpadRepeatIntervalMs) {
-                    navDir = dUp ? -1 : 1;
-                    lastDpadRepeatMs = now;
-                }
-            }
-        } else {
-            dpadHoldStartMs = 0;
+        const bool dUp = globalInput.down(padIndex, InputTracker::BTN_UP);
+        const bool dDown = globalInput.down(padIndex, InputTracker::BTN_DOWN);
+        if (globalInput.repeat(padIndex, InputTracker::BTN_UP, cfg.dpadRepeatDelayMs, cfg.dpadRepeatIntervalMs)) {
+            navDir = -1;
+        } else if (globalInput.repeat(padIndex, InputTracker::BTN_DOWN, cfg.dpadRepeatDelayMs, cfg.dpadRepeatIntervalMs)) {
+            navDir = 1;
         }
 
         // --- Analog (only when D-pad isn't held) ---
@@ -295,9 +281,9 @@ public:
             }
         }
 
-        // Select with A button (debounced).
-        if (ctl->a() && (uint32_t)(now - lastSelectMs) > cfg.selectDebounceMs) {
-            lastSelectMs = now;
+        // Select with A button (press edge; a held A never re-selects).
+        if (globalInput.pressed(padIndex, InputTracker::BTN_A)) {
+            globalInput.lockout(cfg.selectDebounceMs);
             globalAudio.uiConfirmShoot();
             return selectedActual;
         }
@@ -308,12 +294,8 @@ public:
     InputConfig cfg;
 
 private:
-    // Per-instance input state (do NOT make static; we want multiple independent lists).
-    uint8_t prevDpad = 0;
-    uint32_t dpadHoldStartMs = 0;
-    uint32_t lastDpadRepeatMs = 0;
+    // Per-instance analog repeat state (do NOT make static; we want multiple independent lists).
     uint32_t lastAnalogMoveMs = 0;
-    uint32_t lastSelectMs = 0;
 
     // Bluepad32 analog helper (SFINAE) so we don't hard-depend on a single API surface.
     struct InputDetail {
@@ -9,27 +9,36 @@
 /**
  * SmallFont - Helper functions for rendering smaller text
  * Uses Adafruit GFX TomThumb font (3x5 pixels)
+ *
+ * Text does not go through the GFX print path (setFont / setCursor / print per call):
+ * - Glyphs are pre-rasterized once from TomThumb into row bitmasks and drawn as
+ *   horizontal spans. Layout matches Adafruit GFX (baseline at y, '\n', wrap at the
+ *   display's right edge), so output is pixel-identical.
+ * - `formatInt()` / `formatUInt()` are printf-free integer formatters.
+ * - `drawValue()` is for HUD fields ("S:123"): the field's spans are cached by
+ *   (x, y, prefix) and only re-rasterized when the value changes
+ *   (SMALLFONT_RUN_CACHE_SLOTS fields, see engine/config.h).
  */
 class SmallFont {
 public:
     /**
-     * Set the small font on the display
+     * Set the small font on the display (only needed for raw GFX print calls)
      */
     static void setFont(MatrixPanel_I2S_DMA* display) {
         display->setFont(&TomThumb);
     }
-    
+
     /**
      * Draw a small string at position (x, y)
      * Uses TomThumb font (3x5 pixels per character)
      */
     static void drawString(MatrixPanel_I2S_DMA* display, int x, int y, const char* str, uint16_t color) {
-        display->setFont(&TomThumb);
-        display->setTextColor(color);
-        display->setCursor(x, y);
-        display->print(str);
+        if (!display || !str) return;
+        layout(x, y, display->width(), str, [&](int16_t sx, int16_t sy, uint8_t len) {
+            display->drawFastHLine(sx, sy, len, color);
+        });
     }
-    
+
     /**
      * Draw a small formatted string (like printf)
      */
@@ -41,7 +50,7 @@ public:
         va_end(args);
         drawString(display, x, y, buffer, color);
     }
-    
+
     /**
      * Draw a single character
      */
@@ -49,5 +58,268 @@ public:
         char str[2] = {c, '\0'};
         drawString(display, x, y, str, color);
     }
-};
 
+    /**
+     * Decimal `v` into `out` (NUL-terminated, zero-padded to `minDigits`).
+     * Returns the number of characters written; 0 if `cap` is too small.
+     */
+    static uint8_t formatUInt(char* out, uint8_t cap, uint32_t v, uint8_t minDigits = 1) {
+        char tmp[10];
+        uint8_t n = 0;
+        do {
+            tmp[n++] = (char)('0' + (v % 10u));
+            v /= 10u;
+        } while (v != 0 && n < sizeof(tmp));
+        while (n < minDigits && n < sizeof(tmp)) tmp[n++] = '0';
+        if (!out || cap <= n) {
+            if (out && cap) out[0] = '\0';
+            return 0;
+        }
+        for (uint8_t i = 0; i < n; i++) out[i] = tmp[n - 1 - i];
+        out[n] = '\0';
+        return n;
+    }
+
+    static uint8_t formatInt(char* out, uint8_t cap, int32_t v, uint8_t minDigits = 1) {
+        if (v >= 0) return formatUInt(out, cap, (uint32_t)v, minDigits);
+        if (!out || cap < 2) {
+            if (out && cap) out[0] = '\0';
+            return 0;
+        }
+        out[0] = '-';
+        const uint8_t n = formatUInt(out + 1, (uint8_t)(cap - 1), (uint32_t)0 - (uint32_t)v, minDigits);
+        if (n == 0) {
+            out[0] = '\0';
+            return 0;
+        }
+        return (uint8_t)(n + 1);
+    }
+
+    /**
+     * HUD field: `prefix` followed by `value` (e.g. "S:" + score).
+     * Replays cached spans while the value is unchanged; `prefix` is part of the cache key
+     * by pointer, so pass a string literal (or other storage that outlives the field).
+     */
+    static void drawValue(MatrixPanel_I2S_DMA* display, int x, int y, uint16_t color,
+                          const char* prefix, int32_t value, uint8_t minDigits = 1) {
+        if (!display) return;
+        RunCache& rc = runCache();
+        rc.clock++;
+
+        RunSlot* slot = nullptr;
+        RunSlot* victim = &rc.slots[0];
+        for (uint8_t i = 0; i < SMALLFONT_RUN_CACHE_SLOTS; i++) {
+            RunSlot& s = rc.slots[i];
+            if (s.lastUse != 0 && s.prefix == prefix && s.x == x && s.y == y) {
+                slot = &s;
+                break;
+            }
+            if (s.lastUse < victim->lastUse) victim = &s;
+        }
+
+        if (!slot || slot->value != value || slot->minDigits != minDigits) {
+            if (!slot) slot = victim;
+            char text[24];
+            composeValue(text, sizeof(text), prefix, value, minDigits);
+            if (!rasterize(*slot, x, y, display->width(), text)) {
+                // Too many spans / out of range for the compact form: draw uncached.
+                slot->lastUse = 0;
+                drawString(display, x, y, text, color);
+                return;
+            }
+            slot->prefix = prefix;
+            slot->x = (int16_t)x;
+            slot->y = (int16_t)y;
+            slot->value = value;
+            slot->minDigits = minDigits;
+            rc.misses++;
+        } else {
+            rc.hits++;
+        }
+
+        slot->lastUse = rc.clock;
+        for (uint8_t i = 0; i < slot->count; i++) {
+            const CachedSpan& sp = slot->spans[i];
+            display->drawFastHLine((int16_t)(x + sp.dx), (int16_t)(y + sp.dy), sp.len, color);
+        }
+    }
+
+    /** "P1:".."P4:" (stable pointers, usable as drawValue() prefixes). */
+    static const char* playerPrefix(uint8_t index) {
+        static const char* const PREFIX[] = { "P1:", "P2:", "P3:", "P4:" };
+        return PREFIX[index < 4 ? index : 3];
+    }
+
+    /** Text-run cache counters (drawValue() calls served from cache / re-rasterized). */
+    static uint32_t runCacheHits() { return runCache().hits; }
+    static uint32_t runCacheMisses() { return runCache().misses; }
+
+private:
+    static constexpr uint8_t GLYPH_FIRST = 0x20;
+    static constexpr uint8_t GLYPH_LAST = 0x7E;
+    static constexpr uint8_t GLYPH_COUNT = (uint8_t)(GLYPH_LAST - GLYPH_FIRST + 1);
+    static constexpr uint8_t GLYPH_MAX_ROWS = 8;
+
+    // One pre-rasterized glyph: row bitmasks, MSB = leftmost column.
+    struct Glyph {
+        uint8_t rows[GLYPH_MAX_ROWS];
+        int8_t xOffset;
+        int8_t yOffset;
+        uint8_t width;
+        uint8_t height;
+        uint8_t xAdvance;
+        bool present;   // in the font's [first, last] range
+    };
+
+    struct GlyphTable {
+        Glyph glyph[GLYPH_COUNT];
+        uint8_t yAdvance;
+    };
+
+    struct CachedSpan {
+        int8_t dx;
+        int8_t dy;
+        uint8_t len;
+    };
+
+    struct RunSlot {
+        const char* prefix = nullptr;
+        int16_t x = 0;
+        int16_t y = 0;
+        int32_t value = 0;
+        uint8_t minDigits = 0;
+        uint8_t count = 0;
+        uint32_t lastUse = 0;   // 0 = empty
+        CachedSpan spans[SMALLFONT_RUN_CACHE_SPANS];
+    };
+
+    struct RunCache {
+        RunSlot slots[SMALLFONT_RUN_CACHE_SLOTS];
+        uint32_t clock = 0;
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+    };
+
+    static RunCache& runCache() {
+        static RunCache cache;
+        return cache;
+    }
+
+    static GlyphTable buildGlyphs(const GFXfont* font) {
+        GlyphTable t;
+        memset(&t, 0, sizeof(t));
+        t.yAdvance = (uint8_t)pgm_read_byte(&font->yAdvance);
+        const uint16_t first = (uint16_t)pgm_read_word(&font->first);
+        const uint16_t last = (uint16_t)pgm_read_word(&font->last);
+        const uint8_t* bitmap = font->bitmap;
+        for (uint16_t c = GLYPH_FIRST; c <= GLYPH_LAST; c++) {
+            if (c < first || c > last) continue;
+            const GFXglyph* src = &font->glyph[c - first];
+            Glyph& g = t.glyph[c - GLYPH_FIRST];
+            g.present = true;
+            g.width = (uint8_t)pgm_read_byte(&src->width);
+            g.height = (uint8_t)pgm_read_byte(&src->height);
+            g.xAdvance = (uint8_t)pgm_read_byte(&src->xAdvance);
+            g.xOffset = (int8_t)pgm_read_byte(&src->xOffset);
+            g.yOffset = (int8_t)pgm_read_byte(&src->yOffset);
+            if (g.width > 8) g.width = 8;
+            if (g.height > GLYPH_MAX_ROWS) g.height = GLYPH_MAX_ROWS;
+
+            // Same bit walk as Adafruit_GFX::drawChar (bits are packed across rows).
+            const uint8_t srcW = (uint8_t)pgm_read_byte(&src->width);
+            uint16_t bo = (uint16_t)pgm_read_word(&src->bitmapOffset);
+            uint8_t bits = 0, bit = 0;
+            for (uint8_t yy = 0; yy < g.height; yy++) {
+                for (uint8_t xx = 0; xx < srcW; xx++) {
+                    if (!(bit++ & 7)) bits = (uint8_t)pgm_read_byte(&bitmap[bo++]);
+                    if ((bits & 0x80) && xx < 8) g.rows[yy] |= (uint8_t)(0x80u >> xx);
+                    bits = (uint8_t)(bits << 1);
+                }
+            }
+        }
+        return t;
+    }
+
+    static const GlyphTable& glyphs() {
+        static const GlyphTable table = buildGlyphs(&TomThumb);
+        return table;
+    }
+
+    /**
+     * Walk `str` like Adafruit_GFX::write() with text size 1 and wrap on, calling
+     * `emit(x, y, len)` for every horizontal run of set pixels.
+     */
+    template <typename Emit>
+    static void layout(int x, int y, int16_t wrapWidth, const char* str, Emit&& emit) {
+        const GlyphTable& t = glyphs();
+        int16_t cx = (int16_t)x;
+        int16_t cy = (int16_t)y;
+        for (; *str; str++) {
+            const uint8_t c = (uint8_t)*str;
+            if (c == '\n') {
+                cx = 0;
+                cy = (int16_t)(cy + t.yAdvance);
+                continue;
+            }
+            if (c < GLYPH_FIRST || c > GLYPH_LAST) continue;
+            const Glyph& g = t.glyph[c - GLYPH_FIRST];
+            if (!g.present) continue;
+            if (g.width > 0 && g.height > 0) {
+                if (cx + g.xOffset + g.width > wrapWidth) {
+                    cx = 0;
+                    cy = (int16_t)(cy + t.yAdvance);
+                }
+                const int16_t gx = (int16_t)(cx + g.xOffset);
+                const int16_t gy = (int16_t)(cy + g.yOffset);
+                for (uint8_t r = 0; r < g.height; r++) {
+                    uint8_t bits = g.rows[r];
+                    uint8_t col = 0;
+                    while (bits) {
+                        if (!(bits & 0x80)) {
+                            bits = (uint8_t)(bits << 1);
+                            col++;
+                            continue;
+                        }
+                        uint8_t len = 0;
+                        while (bits & 0x80) {
+                            bits = (uint8_t)(bits << 1);
+                            len++;
+                        }
+                        emit((int16_t)(gx + col), (int16_t)(gy + r), len);
+                        col = (uint8_t)(col + len);
+                    }
+                }
+            }
+            cx = (int16_t)(cx + g.xAdvance);
+        }
+    }
+
+    static void composeValue(char* out, uint8_t cap, const char* prefix, int32_t value, uint8_t minDigits) {
+        uint8_t n = 0;
+        if (prefix) {
+            while (prefix[n] && n + 1 < cap) {
+                out[n] = prefix[n];
+                n++;
+            }
+        }
+        out[n] = '\0';
+        formatInt(out + n, (uint8_t)(cap - n), value, minDigits);
+    }
+
+    /** Spans of `text` relative to (x, y); false if they do not fit the slot. */
+    static bool rasterize(RunSlot& slot, int x, int y, int16_t wrapWidth, const char* text) {
+        bool ok = true;
+        uint8_t n = 0;
+        layout(x, y, wrapWidth, text, [&](int16_t sx, int16_t sy, uint8_t len) {
+            const int dx = sx - x;
+            const int dy = sy - y;
+            if (n >= SMALLFONT_RUN_CACHE_SPANS || dx < -128 || dx > 127 || dy < -128 || dy > 127) {
+                ok = false;
+                return;
+            }
+            slot.spans[n++] = CachedSpan{ (int8_t)dx, (int8_t)dy, len };
+        });
+        slot.count = ok ? n : 0;
+        return ok;
+    }
+};
@@ -0,0 +1,197 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
+
+/**
+ * TileLayer
+ * ---------
+ * Incremental renderer for grid games (maze, trail grid, ...): a view over the game's own
+ * tile array plus a dirty bitset, so `draw()` repaints only the cells that changed since
+ * the previous draw instead of walking the whole grid every frame.
+ *
+ * How to use:
+ * - `attach()` the game's tile storage (row-major, `stride` bytes per row) and screen layout.
+ * - Tile -> look: a color palette (`setPalette`, tile id indexes it) or, for sprite tiles,
+ *   a `TileDrawFn` that paints one cell.
+ * - Every write to the tile array goes with `markDirty(x, y)`; bulk changes (clear, new
+ *   level) with `invalidate()`.
+ * - Anything drawn on top of the layer (player, heads, text) must mark the cells it covers
+ *   (`markPixelRectDirty()`) after drawing, so the next `draw()` restores them.
+ * - The game stops clearing the whole screen: clear it only when `needsFullRepaint()`,
+ *   otherwise only what lies outside the layer (`clearOutside()`). Draw the layer
+ *   before anything that goes on top of it. Call `invalidate()` from
+ *   `GameBase::onCanvasLost()` and whenever the game drew a different screen.
+ *
+ * Full repaints walk each row as runs of equal tiles (one span per run with a palette).
+ */
+template <uint16_t MaxW, uint16_t MaxH>
+class TileLayer {
+public:
+    static constexpr uint16_t MAX_W = MaxW;
+    static constexpr uint16_t MAX_H = MaxH;
+
+    /** Paint tile `tile` of cell (cx, cy) at screen rect (px, py, size, size). */
+    typedef void (*TileDrawFn)(void* ctx, MatrixPanel_I2S_DMA* display, int cx, int cy,
+                               int px, int py, int size, uint8_t tile);
+
+    TileLayer() { clearDirty(); }
+
+    void attach(const uint8_t* cells, uint16_t w, uint16_t h, uint16_t stride,
+                uint8_t cellPx, int16_t originX, int16_t originY) {
+        tiles = cells;
+        width = (w > MaxW) ? MaxW : w;
+        height = (h > MaxH) ? MaxH : h;
+        rowStride = stride;
+        cellSize = cellPx ? cellPx : 1;
+        ox = originX;
+        oy = originY;
+        invalidate();
+    }
+
+    /** Tile id -> color. Ids >= `count` use the last entry. A different palette repaints all. */
+    void setPalette(const uint16_t* colors, uint8_t count) {
+        if (count > MAX_PALETTE) count = MAX_PALETTE;
+        if (count == paletteCount && memcmp(colors, palette, count * sizeof(uint16_t)) == 0) return;
+        memcpy(palette, colors, count * sizeof(uint16_t));
+        paletteCount = count;
+        invalidate();
+    }
+
+    /** Sprite tiles: `fn` paints each cell instead of the palette (nullptr = palette). */
+    void setTileDrawer(TileDrawFn fn, void* ctx) {
+        drawFn = fn;
+        drawCtx = ctx;
+        invalidate();
+    }
+
+    void markDirty(int x, int y) {
+        if (x < 0 || y < 0 || x >= (int)width || y >= (int)height) return;
+        const uint32_t i = (uint32_t)y * MaxW + (uint32_t)x;
+        dirty[i >> 5] |= (1u << (i & 31));
+        anyDirty = true;
+    }
+
+    /** Mark every cell overlapping the screen rect (overlay damage). */
+    void markPixelRectDirty(int px, int py, int w, int h) {
+        if (w <= 0 || h <= 0) return;
+        const int x0 = floorDiv(px - ox, cellSize);
+        const int y0 = floorDiv(py - oy, cellSize);
+        const int x1 = floorDiv(px + w - 1 - ox, cellSize);
+        const int y1 = floorDiv(py + h - 1 - oy, cellSize);
+        for (int y = max(0, y0); y <= min((int)height - 1, y1); y++) {
+            for (int x = max(0, x0); x <= min((int)width - 1, x1); x++) markDirty(x, y);
+        }
+    }
+
+    /** Fill everything on screen that is not covered by the layer's cells (HUD, margins). */
+    void clearOutside(MatrixPanel_I2S_DMA* display, uint16_t color) const {
+        if (!display) return;
+        const int sw = display->width();
+        const int sh = display->height();
+        const int x0 = ox;
+        const int y0 = oy;
+        const int x1 = ox + (int)width * cellSize;
+        const int y1 = oy + (int)height * cellSize;
+        if (y0 > 0) display->fillRect(0, 0, sw, y0, color);
+        if (y1 < sh) display->fillRect(0, y1, sw, sh - y1, color);
+        if (x0 > 0) display->fillRect(0, y0, x0, y1 - y0, color);
+        if (x1 < sw) display->fillRect(x1, y0, sw - x1, y1 - y0, color);
+    }
+
+    /** Repaint every cell on the next draw. */
+    void invalidate() { fullRepaint = true; }
+    bool needsFullRepaint() const { return fullRepaint; }
+
+    /** Repaint dirty cells (or everything after `invalidate()`); returns cells painted. */
+    uint16_t draw(MatrixPanel_I2S_DMA* display) {
+        if (!display || !tiles || (paletteCount == 0 && !drawFn)) return 0;
+        uint16_t painted = 0;
+        if (fullRepaint) {
+            for (uint16_t y = 0; y < height; y++) painted = (uint16_t)(painted + drawRow(display, y));
+        } else if (anyDirty) {
+            for (uint16_t w = 0; w < WORDS; w++) {
+                uint32_t bits = dirty[w];
+                while (bits) {
+                    const uint8_t b = (uint8_t)__builtin_ctz(bits);
+                    bits &= bits - 1;
+                    const uint32_t i = ((uint32_t)w << 5) + b;
+                    const uint16_t y = (uint16_t)(i / MaxW);
+                    const uint16_t x = (uint16_t)(i % MaxW);
+                    drawCell(display, x, y, tileAt(x, y));
+                    painted++;
+                }
+            }
+        }
+        fullRepaint = false;
+        clearDirty();
+        return painted;
+    }
+
+private:
+    static constexpr uint8_t MAX_PALETTE = 8;
+    static constexpr uint16_t WORDS = (uint16_t)(((uint32_t)MaxW * MaxH + 31) / 32);
+
+    const uint8_t* tiles = nullptr;
+    uint16_t width = 0;
+    uint16_t height = 0;
+    uint16_t rowStride = 0;
+    uint8_t cellSize = 1;
+    int16_t ox = 0;
+    int16_t oy = 0;
+
+    uint16_t palette[MAX_PALETTE] = { 0 };
+    uint8_t paletteCount = 0;
+    TileDrawFn drawFn = nullptr;
+    void* drawCtx = nullptr;
+
+    uint32_t dirty[WORDS];
+    bool anyDirty = false;
+    bool fullRepaint = true;
+
+    static int floorDiv(int a, int b) { return (a >= 0) ? (a / b) : -((-a + b - 1) / b); }
+
+    void clearDirty() {
+        memset(dirty, 0, sizeof(dirty));
+        anyDirty = false;
+    }
+
+    uint8_t tileAt(uint16_t x, uint16_t y) const { return tiles[(uint32_t)y * rowStride + x]; }
+
+    uint16_t colorOf(uint8_t tile) const {
+        return palette[(tile < paletteCount) ? tile : (uint8_t)(paletteCount - 1)];
+    }
+
+    void drawCell(MatrixPanel_I2S_DMA* display, uint16_t x, uint16_t y, uint8_t tile) {
+        const int px = ox + (int)x * cellSize;
+        const int py = oy + (int)y * cellSize;
+        if (drawFn) {
+            drawFn(drawCtx, display, x, y, px, py, cellSize, tile);
+        } else if (cellSize == 1) {
+            display->drawPixel(px, py, colorOf(tile));
+        } else {
+            display->fillRect(px, py, cellSize, cellSize, colorOf(tile));
+        }
+    }
+
+    // Full repaint of one row: runs of equal colors as single spans.
+    uint16_t drawRow(MatrixPanel_I2S_DMA* display, uint16_t y) {
+        if (drawFn) {
+            for (uint16_t x = 0; x < width; x++) drawCell(display, x, y, tileAt(x, y));
+            return width;
+        }
+        const int py = oy + (int)y * cellSize;
+        uint16_t x = 0;
+        while (x < width) {
+            const uint16_t c = colorOf(tileAt(x, y));
+            uint16_t end = (uint16_t)(x + 1);
+            while (end < width && colorOf(tileAt(end, y)) == c) end++;
+            const int px = ox + (int)x * cellSize;
+            const int runPx = (int)(end - x) * cellSize;
+            if (cellSize == 1) display->drawFastHLine(px, py, runPx, c);
+            else display->fillRect(px, py, runPx, cellSize, c);
+            x = end;
+        }
+        return width;
+    }
+};
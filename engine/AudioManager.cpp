@@ -267,12 +267,14 @@ void AudioManager::startStep(uint8_t index) {
 // Public API
 // -----------------------------
 void AudioManager::begin() {
+    EngineLock guard(mutex);
 #if ENABLE_AUDIO
     ensureInit();
 #endif
 }
 
 void AudioManager::update() {
+    EngineLock guard(mutex);
 #if ENABLE_AUDIO
     // If sound got disabled, silence immediately.
     if (!soundAllowed()) {
@@ -333,6 +335,7 @@ void AudioManager::update() {
 }
 
 void AudioManager::stopAll() {
+    EngineLock guard(mutex);
 #if ENABLE_AUDIO
     if (!initialized) return;
     setToneHz(0);
@@ -350,6 +353,7 @@ void AudioManager::stopAll() {
 }
 
 void AudioManager::playTone(uint16_t freqHz, uint16_t durationMs) {
+    EngineLock guard(mutex);
 #if ENABLE_AUDIO
     if (!soundAllowed()) {
         #if DEBUG_AUDIO
@@ -393,6 +397,7 @@ void AudioManager::playTone(uint16_t freqHz, uint16_t durationMs) {
 }
 
 void AudioManager::playPattern(const Step* steps, uint8_t stepCount) {
+    EngineLock guard(mutex);
 #if ENABLE_AUDIO
     if (!soundAllowed()) return;
     if (!steps || stepCount == 0) return;
@@ -415,6 +420,7 @@ void AudioManager::playPattern(const Step* steps, uint8_t stepCount) {
 }
 
 void AudioManager::playRtttl(const char* rtttl, bool loop) {
+    EngineLock guard(mutex);
 #if ENABLE_AUDIO
     if (!soundAllowed()) return;
     if (!rtttl) return;
@@ -433,6 +439,7 @@ void AudioManager::playRtttl(const char* rtttl, bool loop) {
 }
 
 void AudioManager::stopRtttl() {
+    EngineLock guard(mutex);
 #if ENABLE_AUDIO
     rtttlActive = false;
     rtttlStr = nullptr;
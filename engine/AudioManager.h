@@ -1,6 +1,7 @@
 #pragma once
 #include <Arduino.h>
 #include "config.h"
+#include "EngineTasks.h"
 
 /**
  * AudioManager
@@ -15,6 +16,8 @@
  * - This class is intentionally tiny for the first integration.
  * - We use ESP32 LEDC (PWM) tone output. The PWM channel/pin are configured in `engine/config.h`.
  * - We keep the pin attached and stop tones by setting frequency to 0.
+ * - Public calls are serialized by a mutex: games trigger sounds from the engine task
+ *   while `update()` runs in the input task (ENABLE_DUAL_CORE).
  */
 class AudioManager {
 public:
@@ -87,6 +90,7 @@ public:
     bool isRtttlActive() const { return rtttlActive; }
 
 private:
+    EngineMutex mutex;
     bool initialized = false;
     bool playing = false;
     uint32_t toneEndMs = 0;
@@ -2,11 +2,15 @@
 
 ControllerManager* globalControllerManager = nullptr;
 
-ControllerManager::ControllerManager() {
+ControllerManager::ControllerManager() : writeSlot(0), readSlot(1), spareSlot(2) {
     connectedCount = 0;
     for (int i = 0; i < MAX_GAMEPADS; i++) {
         controllers[i] = nullptr;
     }
+    for (int s = 0; s < 3; s++) {
+        snapshots[s].connectedCount = 0;
+        for (int i = 0; i < MAX_GAMEPADS; i++) snapshots[s].present[i] = false;
+    }
     globalControllerManager = this;
 }
 
@@ -18,15 +22,60 @@ void ControllerManager::setup() {
 
 void ControllerManager::update() {
     BP32.update();
+    publish();
+}
+
+void ControllerManager::publish() {
+    Snapshot& snap = snapshots[writeSlot];
+    for (int i = 0; i < MAX_GAMEPADS; i++) {
+        snap.present[i] = (controllers[i] != nullptr);
+        if (snap.present[i]) snap.pads[i] = *controllers[i];
+    }
+    snap.connectedCount = connectedCount;
+
+    // Hand the filled slot over and continue writing into the previous spare.
+    const uint8_t prev = spareSlot.exchange((uint8_t)(writeSlot | FRESH_BIT));
+    writeSlot = (uint8_t)(prev & ~FRESH_BIT);
+}
+
+bool ControllerManager::acquireSnapshot() {
+    if ((spareSlot.load() & FRESH_BIT) == 0) return false;
+    const uint8_t prev = spareSlot.exchange(readSlot);
+    readSlot = (uint8_t)(prev & ~FRESH_BIT);
+    return true;
 }
 
 ControllerPtr ControllerManager::getController(int index) {
     if (index < 0 || index >= MAX_GAMEPADS) return nullptr;
-    return controllers[index];
+    Snapshot& snap = snapshots[readSlot];
+    return snap.present[index] ? &snap.pads[index] : nullptr;
 }
 
 int ControllerManager::getConnectedCount() const {
-    return connectedCount;
+    return snapshots[readSlot].connectedCount;
+}
+
+uint8_t ControllerManager::snapshotPresentMask() const {
+    const Snapshot& snap = snapshots[readSlot];
+    uint8_t mask = 0;
+    for (int i = 0; i < MAX_GAMEPADS; i++) {
+        if (snap.present[i]) mask |= (uint8_t)(1u << i);
+    }
+    return mask;
+}
+
+Controller* ControllerManager::snapshotPad(int index) {
+    if (index < 0 || index >= MAX_GAMEPADS) return nullptr;
+    return &snapshots[readSlot].pads[index];
+}
+
+void ControllerManager::setSnapshotPresentMask(uint8_t mask) {
+    Snapshot& snap = snapshots[readSlot];
+    snap.connectedCount = 0;
+    for (int i = 0; i < MAX_GAMEPADS; i++) {
+        snap.present[i] = (mask & (1u << i)) != 0;
+        if (snap.present[i]) snap.connectedCount++;
+    }
 }
 
 void ControllerManager::onConnectedController(ControllerPtr ctl) {
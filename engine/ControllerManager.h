@@ -1,8 +1,23 @@
 #pragma once
 #include <Arduino.h>
 #include <Bluepad32.h>
+#include <atomic>
 #include "config.h"
 
+/**
+ * ControllerManager
+ * -----------------
+ * Owns the Bluepad32 connection slots and hands games a consistent input snapshot.
+ *
+ * Threading (see ENABLE_DUAL_CORE):
+ * - `update()` runs on the input side: polls Bluepad32 and publishes a copy of every
+ *   connected controller into a lock-free triple buffer.
+ * - `acquireSnapshot()` runs once per engine tick; `getController()` /
+ *   `getConnectedCount()` then read that snapshot, so a whole tick sees one
+ *   coherent input state even while Bluetooth keeps updating on the other core.
+ *
+ * Returned ControllerPtr values point into the snapshot: do not keep them across ticks.
+ */
 class ControllerManager {
 public:
     ControllerManager();
@@ -10,15 +25,48 @@ public:
     void setup();
     void update();
 
+    /**
+     * Swap in the newest published snapshot (engine side).
+     * Returns false if nothing new was published since the last call.
+     */
+    bool acquireSnapshot();
+
     ControllerPtr getController(int index);
     int getConnectedCount() const;
 
+    // -----------------------------------------------------
+    // Snapshot override (engine side, e.g. input replay)
+    // -----------------------------------------------------
+    /** Bitmask of pads present in the current snapshot (bit i = pad i). */
+    uint8_t snapshotPresentMask() const;
+    /** Mutable snapshot pad (valid until the next acquireSnapshot()); nullptr if out of range. */
+    Controller* snapshotPad(int index);
+    /** Override which pads the current snapshot reports as connected. */
+    void setSnapshotPresentMask(uint8_t mask);
+
     static void onConnectedController(ControllerPtr ctl);
     static void onDisconnectedController(ControllerPtr ctl);
 
 private:
+    struct Snapshot {
+        Controller pads[MAX_GAMEPADS];
+        bool present[MAX_GAMEPADS];
+        int connectedCount;
+    };
+
+    // Live Bluepad32 slots (input side only).
     ControllerPtr controllers[MAX_GAMEPADS];
     int connectedCount;
+
+    // Triple buffer: the publisher fills `writeSlot`, the reader owns `readSlot`,
+    // `spareSlot` holds the hand-over slot (+ FRESH_BIT when unread).
+    static constexpr uint8_t FRESH_BIT = 0x80;
+    Snapshot snapshots[3];
+    uint8_t writeSlot;
+    uint8_t readSlot;
+    std::atomic<uint8_t> spareSlot;
+
+    void publish();
 };
 
 extern ControllerManager* globalControllerManager;
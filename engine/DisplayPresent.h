@@ -28,6 +28,26 @@ namespace DisplayPresentDetail {
   static auto tryPresent(T* d, unsigned char) -> decltype(d->showDMABuffer(), void()) { d->showDMABuffer(); }
   template <typename T>
   static void tryPresent(T*, ...) {}
+
+  // Compile-time probes: does the linked library expose a "present" API?
+  // Used by FrameCanvas to decide whether the panel really alternates between
+  // two DMA buffers (and therefore needs one shadow copy per buffer).
+  template <typename T>
+  static auto hasFlip(T* d, int) -> decltype(d->flipDMABuffer(), bool()) { return true; }
+  template <typename T>
+  static bool hasFlip(T*, ...) { return false; }
+  template <typename T>
+  static auto hasFlipArg(T* d, int) -> decltype(d->flipDMABuffer(true), bool()) { return true; }
+  template <typename T>
+  static bool hasFlipArg(T*, ...) { return false; }
+  template <typename T>
+  static auto hasShow(T* d, int) -> decltype(d->showDMABuffer(), bool()) { return true; }
+  template <typename T>
+  static bool hasShow(T*, ...) { return false; }
+  template <typename T>
+  static auto hasShowArg(T* d, int) -> decltype(d->showDMABuffer(true), bool()) { return true; }
+  template <typename T>
+  static bool hasShowArg(T*, ...) { return false; }
 }
 
 /**
@@ -42,4 +62,17 @@ static inline void presentFrame(MatrixPanel_I2S_DMA* d) {
 #endif
 }
 
+/**
+ * True when presentFrame() actually swaps between two DMA buffers.
+ */
+static inline bool presentFlipsBuffers(MatrixPanel_I2S_DMA* d) {
+#if ENABLE_DOUBLE_BUFFER
+  return DisplayPresentDetail::hasFlip(d, 0) || DisplayPresentDetail::hasFlipArg(d, 0) ||
+         DisplayPresentDetail::hasShow(d, 0) || DisplayPresentDetail::hasShowArg(d, 0);
+#else
+  (void)d;
+  return false;
+#endif
+}
+
 
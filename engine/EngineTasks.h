@@ -0,0 +1,92 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+#ifdef ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#else
+#include <mutex>
+#include <thread>
+#endif
+
+/**
+ * EngineTasks
+ * -----------
+ * Tiny platform layer for the dual-core split (see ENABLE_DUAL_CORE in config.h).
+ *
+ * - ESP32: FreeRTOS tasks pinned to a core, recursive FreeRTOS mutex.
+ * - Host builds: `std::thread` / `std::recursive_mutex` stand-ins (the core id is ignored),
+ *   so the same input/engine split can be exercised off-device. `sleepMs()` is also where
+ *   the harness parks the tasks (HostTasks::haltAll()) before it reads their state.
+ *
+ * When ENABLE_DUAL_CORE is 0 the mutex compiles to nothing and nothing is spawned.
+ */
+namespace EngineTasks {
+
+typedef void (*TaskFn)(void* arg);
+
+/**
+ * Start `fn(arg)` as a long-running task. Returns false if the task could not be created.
+ * `stackBytes` / `priority` / `core` only apply on ESP32.
+ */
+static inline bool spawnPinned(const char* name, TaskFn fn, void* arg,
+                               uint32_t stackBytes, uint8_t priority, int core) {
+#ifdef ESP32
+    return xTaskCreatePinnedToCore(fn, name, stackBytes, arg, priority, nullptr, core) == pdPASS;
+#else
+    (void)name; (void)stackBytes; (void)priority; (void)core;
+    HostTasks::registerTask();
+    std::thread(fn, arg).detach();
+    return true;
+#endif
+}
+
+/** Block the calling task for `ms` (yields the core to other tasks / feeds the WDT). */
+static inline void sleepMs(uint32_t ms) {
+#ifdef ESP32
+    vTaskDelay(pdMS_TO_TICKS(ms) > 0 ? pdMS_TO_TICKS(ms) : 1);
+#else
+    delay(ms);
+    HostTasks::checkpoint(); // the host harness parks tasks here before reading state
+#endif
+}
+
+} // namespace EngineTasks
+
+/**
+ * Recursive mutex for services shared by the input and engine tasks (e.g. AudioManager).
+ * Recursive because public service calls nest (uiUp() -> playPattern()).
+ */
+class EngineMutex {
+public:
+#if ENABLE_DUAL_CORE
+  #ifdef ESP32
+    EngineMutex() : handle(xSemaphoreCreateRecursiveMutex()) {}
+    void lock() { if (handle) xSemaphoreTakeRecursive(handle, portMAX_DELAY); }
+    void unlock() { if (handle) xSemaphoreGiveRecursive(handle); }
+private:
+    SemaphoreHandle_t handle;
+  #else
+    void lock() { m.lock(); }
+    void unlock() { m.unlock(); }
+private:
+    std::recursive_mutex m;
+  #endif
+#else
+    void lock() {}
+    void unlock() {}
+#endif
+};
+
+/** Scope guard for EngineMutex. */
+class EngineLock {
+public:
+    explicit EngineLock(EngineMutex& m) : mutex(m) { mutex.lock(); }
+    ~EngineLock() { mutex.unlock(); }
+    EngineLock(const EngineLock&) = delete;
+    EngineLock& operator=(const EngineLock&) = delete;
+private:
+    EngineMutex& mutex;
+};
@@ -0,0 +1,164 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+#include "Trig8.h"
+
+/**
+ * FixedPoint
+ * ----------
+ * Integer fixed-point math for game physics: Q16.16 (`q16`, int32) for positions and
+ * velocities, Q8.8 (`q8`, int16) for compact per-entity values.
+ *
+ * Why: float results depend on compiler flags / FPU code paths, so a float simulation is
+ * not bit-reproducible between builds (replays, netplay). Integer math is, and it does
+ * not touch FPU state (cheap in tasks / ISRs).
+ *
+ * Conventions (same as the raw `_fp` ints in Labyrinth, just with 16 fraction bits):
+ * - Plain integers, no wrapper class: `+`, `-`, compares and `* int` work as usual;
+ *   products / quotients of two fixed values go through `mul()` / `div()`.
+ * - `fromFloat()` is for constants (constexpr); simulation code never converts back
+ *   except for drawing (`toInt()` = floor, `roundToInt()`).
+ * - `*Sat` variants clamp to the int32 range instead of wrapping.
+ * - Trig takes 256-step `Trig8::Angle`s.
+ */
+namespace Fixed {
+
+typedef int32_t q16; // Q16.16
+typedef int16_t q8;  // Q8.8
+
+static constexpr uint8_t SHIFT = 16;
+static constexpr q16 ONE = (q16)1 << SHIFT;
+static constexpr q16 HALF = ONE / 2;
+static constexpr q16 MAX_VALUE = INT32_MAX;
+static constexpr q16 MIN_VALUE = INT32_MIN;
+
+static constexpr q16 fromInt(int32_t v) { return v * ONE; }
+static constexpr q16 fromFloat(float v) { return (q16)(v * (float)ONE + ((v >= 0.0f) ? 0.5f : -0.5f)); }
+/** num / den as a fixed value (e.g. random ratios: `ratio(random(-70, 71), 100)`). */
+static constexpr q16 ratio(int32_t num, int32_t den) { return (q16)(((int64_t)num * ONE) / den); }
+
+static constexpr int32_t toInt(q16 v) { return v >> SHIFT; } // floor
+static constexpr int32_t roundToInt(q16 v) { return (v + HALF) >> SHIFT; }
+static inline float toFloat(q16 v) { return (float)v * (1.0f / (float)ONE); }
+
+static constexpr q16 saturate(int64_t v) { return (v > (int64_t)MAX_VALUE) ? MAX_VALUE : (v < (int64_t)MIN_VALUE) ? MIN_VALUE : (q16)v; }
+
+static constexpr q16 mul(q16 a, q16 b) { return (q16)(((int64_t)a * b) >> SHIFT); }
+static constexpr q16 mulSat(q16 a, q16 b) { return saturate(((int64_t)a * b) >> SHIFT); }
+static constexpr q16 addSat(q16 a, q16 b) { return saturate((int64_t)a + b); }
+static constexpr q16 subSat(q16 a, q16 b) { return saturate((int64_t)a - b); }
+
+/** a / b; division by zero saturates toward the sign of `a`. */
+static inline q16 div(q16 a, q16 b) {
+    if (b == 0) return (a >= 0) ? MAX_VALUE : MIN_VALUE;
+    return saturate(((int64_t)a * ONE) / b);
+}
+
+static constexpr q16 absVal(q16 v) { return (v < 0) ? -v : v; }
+static constexpr q16 clamp(q16 v, q16 lo, q16 hi) { return (v < lo) ? lo : (v > hi) ? hi : v; }
+static constexpr q16 lerp(q16 a, q16 b, q16 t) { return a + mul(b - a, t); }
+
+/** sqrt(v) for v >= 0 (negative -> 0); exact floor of the Q16.16 result. */
+static inline q16 sqrt(q16 v) {
+    if (v <= 0) return 0;
+    uint64_t x = (uint64_t)v << SHIFT; // sqrt(v * 2^16) * 2^8 ... = sqrt(v) in Q16.16
+    uint64_t r = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > x) bit >>= 2;
+    while (bit) {
+        if (x >= r + bit) {
+            x -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (q16)r;
+}
+
+/**
+ * 1 / sqrt(v) for v > 0 (v <= 0 -> MAX_VALUE). `v` is scaled by a power of 4 into
+ * [0.5, 2), Newton steps (y = y * (3 - m*y*y) / 2) run in Q2.30 from y = 1, and the
+ * power of 2 is shifted back in. Cheaper than sqrt + div for normalizing.
+ */
+static inline q16 rsqrt(q16 v) {
+    if (v <= 0) return MAX_VALUE;
+    // v = m * 4^k with m in [0.5, 2).
+    const int e = (31 - __builtin_clz((uint32_t)v)) - SHIFT;
+    const int k = (e >= 0) ? ((e + 1) / 2) : -((-e) / 2);
+    const int mShift = 14 - 2 * k; // Q16 -> Q30, divided by 4^k
+    const uint64_t m = (mShift >= 0) ? ((uint64_t)v << mShift) : ((uint64_t)v >> -mShift);
+    uint64_t y = (uint64_t)1 << 30;
+    for (int i = 0; i < 5; i++) {
+        const uint64_t yy = (y * y) >> 30;
+        const uint64_t myy = (m * yy) >> 30;
+        if (myy >= ((uint64_t)3 << 30)) return 0;
+        y = (y * (((uint64_t)3 << 30) - myy)) >> 31;
+    }
+    // rsqrt(v) = rsqrt(m) * 2^-k; Q30 -> Q16.
+    const int outShift = 14 + k;
+    if (outShift >= 0) return saturate((int64_t)(y >> outShift));
+    return saturate((int64_t)(y << -outShift));
+}
+
+// ---------------------------------------------------------
+// Q8.8
+// ---------------------------------------------------------
+static constexpr uint8_t SHIFT8 = 8;
+static constexpr q8 ONE8 = (q8)(1 << SHIFT8);
+
+static constexpr q8 toQ8(q16 v) { return (q8)((v > (q16)INT16_MAX * 256) ? INT16_MAX : (v < (q16)INT16_MIN * 256) ? INT16_MIN : (v >> 8)); }
+static constexpr q16 fromQ8(q8 v) { return (q16)v * 256; }
+static constexpr q8 mul8(q8 a, q8 b) { return (q8)(((int32_t)a * b) >> SHIFT8); }
+
+// ---------------------------------------------------------
+// Trig (Trig8 table, Q14 -> Q16)
+// ---------------------------------------------------------
+static constexpr q16 sin(Trig8::Angle a) { return (q16)Trig8::sinQ14(a) * 4; }
+static constexpr q16 cos(Trig8::Angle a) { return (q16)Trig8::cosQ14(a) * 4; }
+static inline Trig8::Angle atan2(q16 y, q16 x) { return Trig8::atan2(y, x); }
+
+// ---------------------------------------------------------
+// 2D vectors
+// ---------------------------------------------------------
+struct Vec2 {
+    q16 x;
+    q16 y;
+};
+
+static constexpr Vec2 add(Vec2 a, Vec2 b) { return Vec2{ a.x + b.x, a.y + b.y }; }
+static constexpr Vec2 sub(Vec2 a, Vec2 b) { return Vec2{ a.x - b.x, a.y - b.y }; }
+static constexpr Vec2 scale(Vec2 v, q16 k) { return Vec2{ mul(v.x, k), mul(v.y, k) }; }
+static constexpr q16 dot(Vec2 a, Vec2 b) { return saturate((((int64_t)a.x * b.x) + ((int64_t)a.y * b.y)) >> SHIFT); }
+static constexpr q16 lengthSq(Vec2 v) { return dot(v, v); }
+static inline q16 length(Vec2 v) { return sqrt(lengthSq(v)); }
+
+/** Unit vector at `a` times `len`. */
+static constexpr Vec2 fromAngle(Trig8::Angle a, q16 len = ONE) { return Vec2{ mul(cos(a), len), mul(sin(a), len) }; }
+
+/** `v` rescaled to length `len` (zero vector stays zero). */
+static inline Vec2 withLength(Vec2 v, q16 len) {
+    const q16 l2 = lengthSq(v);
+    if (l2 <= 0) return Vec2{ 0, 0 };
+    return scale(v, mul(rsqrt(l2), len));
+}
+
+/** `v` with its length clamped to [minLen, maxLen] (zero vector stays zero). */
+static inline Vec2 clampLength(Vec2 v, q16 minLen, q16 maxLen) {
+    const q16 l = length(v);
+    if (l <= 0) return v;
+    if (l > maxLen) return scale(v, div(maxLen, l));
+    if (l < minLen) return scale(v, div(minLen, l));
+    return v;
+}
+
+// ---------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------
+/** Uniform value in [lo, hi) from Arduino `random()` (deterministic with the seed). */
+static inline q16 randomRange(q16 lo, q16 hi) {
+    return lo + mul(hi - lo, (q16)random(0, ONE));
+}
+
+} // namespace Fixed
@@ -0,0 +1,64 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * FixedStepScheduler
+ * ------------------
+ * Real-time accumulator for fixed-timestep games (see GameBase::fixedStepMs()).
+ *
+ * Usage (engine loop):
+ *   const uint8_t steps = clock.advance(nowMs, stepMs);
+ *   for (uint8_t i = 0; i < steps; i++) game->step(input, clock.stepTimeMs(i, steps, stepMs), stepMs);
+ *   game->drawInterpolated(display, clock.alpha(stepMs));
+ *
+ * Catch-up is bounded (MAX_CATCHUP_STEPS per call). If the loop stalls for longer than
+ * that, the excess time is dropped so a long hitch cannot trigger a "spiral of death".
+ */
+class FixedStepScheduler {
+public:
+    static constexpr uint8_t MAX_CATCHUP_STEPS = 4;
+
+    /** Restart timing at `nowMs` (game start/resume): no catch-up for time spent elsewhere. */
+    void reset(uint32_t nowMs) {
+        lastMs = nowMs;
+        accumulatorMs = 0;
+    }
+
+    /** Add elapsed real time and return how many fixed steps to run now. */
+    uint8_t advance(uint32_t nowMs, uint16_t stepMs) {
+        if (stepMs == 0) return 0;
+        accumulatorMs += (uint32_t)(nowMs - lastMs);
+        lastMs = nowMs;
+
+        uint32_t steps = accumulatorMs / stepMs;
+        if (steps > MAX_CATCHUP_STEPS) {
+            droppedMs += (steps - MAX_CATCHUP_STEPS) * (uint32_t)stepMs;
+            steps = MAX_CATCHUP_STEPS;
+        }
+        accumulatorMs -= steps * (uint32_t)stepMs;
+        if (accumulatorMs >= stepMs) accumulatorMs %= stepMs;
+        return (uint8_t)steps;
+    }
+
+    /**
+     * Simulated time of step `i` of the `steps` returned by the last `advance()`: steps are
+     * `stepMs` apart and the last one runs at the `advance()` time.
+     */
+    uint32_t stepTimeMs(uint8_t i, uint8_t steps, uint16_t stepMs) const {
+        return lastMs - (uint32_t)(steps - 1 - i) * stepMs;
+    }
+
+    /** Interpolation factor [0..1) between the last completed step and the next. */
+    float alpha(uint16_t stepMs) const {
+        if (stepMs == 0) return 0.0f;
+        return (float)accumulatorMs / (float)stepMs;
+    }
+
+    /** Simulation time dropped because catch-up hit MAX_CATCHUP_STEPS (debug/profiling). */
+    uint32_t droppedTimeMs() const { return droppedMs; }
+
+private:
+    uint32_t lastMs = 0;
+    uint32_t accumulatorMs = 0;
+    uint32_t droppedMs = 0;
+};
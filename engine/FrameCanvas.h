@@ -0,0 +1,272 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
+#include "config.h"
+#include "DisplayPresent.h"
+
+/**
+ * FrameCanvas
+ * -----------
+ * Engine-owned RGB565 framebuffer that games, applets and menus draw into
+ * instead of the HUB75 DMA panel.
+ *
+ * Why:
+ * - Every `draw()` starts with `fillScreen()` and repaints all 4096 pixels.
+ *   Writing those straight into the DMA buffer is expensive (each pixel is
+ *   spread over several bit planes) and races the scan-out (tearing).
+ * - Most frames only change a few hundred pixels. The canvas keeps a shadow
+ *   copy of what each DMA buffer currently holds and `present()` pushes only
+ *   the spans that differ.
+ *
+ * How it plugs in:
+ * - FrameCanvas *is a* `MatrixPanel_I2S_DMA` (never `begin()`-ed), so every
+ *   existing `draw(MatrixPanel_I2S_DMA*)` works unchanged. Adafruit_GFX routes
+ *   text, lines, circles etc. through the overridden primitives below.
+ * - The host calls `presentFrame(canvas, panel)` instead of `presentFrame(panel)`.
+ * - Anything that writes to the real panel directly (e.g. `clearScreen()`)
+ *   must be followed by `invalidate()` so the next present repaints fully.
+ *
+ * Background snapshot: `captureBackground()` keeps a (dimmed) copy of the
+ * current frame that `restoreBackground()` copies back, so static screens
+ * (e.g. the frozen game under the pause menu) are not re-rendered every frame.
+ *
+ * Present-time fade: `setFade(level[, rect])` dims the next present() (whole frame
+ * or one region) through a per-channel RGB565 LUT while pushing, so transitions need no
+ * recoloring in `draw()` and cost no draw time. The frame itself is never modified.
+ *
+ * Memory: one frame, one shadow per DMA buffer and the background snapshot
+ * (4 x 8 KB at 64x64 with double buffering). Keep the instance global/heap,
+ * never on the stack.
+ */
+class FrameCanvas : public MatrixPanel_I2S_DMA {
+public:
+    static constexpr int WIDTH_PX = PANEL_RES_X * PANEL_CHAIN;
+    static constexpr int HEIGHT_PX = PANEL_RES_Y;
+    static constexpr int PIXEL_COUNT = WIDTH_PX * HEIGHT_PX;
+    static constexpr uint8_t MAX_SHADOWS = ENABLE_DOUBLE_BUFFER ? 2 : 1;
+
+    explicit FrameCanvas(const HUB75_I2S_CFG& cfg) : MatrixPanel_I2S_DMA(cfg) {
+        memset(frame, 0, sizeof(frame));
+        invalidate();
+    }
+
+    // -----------------------------------------------------
+    // Drawing primitives (RAM only)
+    // -----------------------------------------------------
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if ((uint16_t)x >= (uint16_t)WIDTH_PX || (uint16_t)y >= (uint16_t)HEIGHT_PX) return;
+        frame[y * WIDTH_PX + x] = color;
+    }
+
+    void fillScreen(uint16_t color) override {
+        fillSpan(frame, PIXEL_COUNT, color);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        if ((uint16_t)y >= (uint16_t)HEIGHT_PX || w <= 0) return;
+        int x0 = x;
+        int x1 = (int)x + (int)w;
+        if (x0 < 0) x0 = 0;
+        if (x1 > WIDTH_PX) x1 = WIDTH_PX;
+        if (x0 >= x1) return;
+        fillSpan(&frame[y * WIDTH_PX + x0], x1 - x0, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+        if ((uint16_t)x >= (uint16_t)WIDTH_PX || h <= 0) return;
+        int y0 = y;
+        int y1 = (int)y + (int)h;
+        if (y0 < 0) y0 = 0;
+        if (y1 > HEIGHT_PX) y1 = HEIGHT_PX;
+        if (y0 >= y1) return;
+        uint16_t* p = &frame[y0 * WIDTH_PX + x];
+        for (int yy = y0; yy < y1; yy++, p += WIDTH_PX) *p = color;
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        if (w <= 0 || h <= 0) return;
+        int x0 = x, x1 = (int)x + (int)w;
+        int y0 = y, y1 = (int)y + (int)h;
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+        if (x1 > WIDTH_PX) x1 = WIDTH_PX;
+        if (y1 > HEIGHT_PX) y1 = HEIGHT_PX;
+        if (x0 >= x1 || y0 >= y1) return;
+        for (int yy = y0; yy < y1; yy++) fillSpan(&frame[yy * WIDTH_PX + x0], x1 - x0, color);
+    }
+
+    /**
+     * Snapshot the current frame as a background, each RGB565 channel shifted
+     * right by `dimShift` (0 = exact copy, 1 = half brightness, ...).
+     * A pending `setFade()` is folded into the snapshot (as present() would show
+     * the frame) and consumed.
+     */
+    void captureBackground(uint8_t dimShift = 0) {
+        // Per-channel shift without cross-channel bleed: mask off the bits that
+        // would shift into the neighbouring channel.
+        const uint16_t keep = (uint16_t)(((0x1F >> dimShift) << 11) | ((0x3F >> dimShift) << 5) | (0x1F >> dimShift));
+        for (int y = 0; y < HEIGHT_PX; y++) {
+            const uint16_t* src = composeRow(y);
+            uint16_t* dst = &background[y * WIDTH_PX];
+            if (dimShift == 0) {
+                memcpy(dst, src, WIDTH_PX * sizeof(uint16_t));
+                continue;
+            }
+            for (int x = 0; x < WIDTH_PX; x++) dst[x] = (uint16_t)((src[x] >> dimShift) & keep);
+        }
+        fadeLevel = 255;
+    }
+
+    /** Replace the frame with the last captured background. */
+    void restoreBackground() {
+        memcpy(frame, background, sizeof(frame));
+    }
+
+    /**
+     * Dim the next present() to `level` (255 = off, 0 = black) inside the rect
+     * (default: whole frame). One-shot: present() resets it, so menus and other
+     * screens never inherit a game's fade.
+     */
+    void setFade(uint8_t level, int x = 0, int y = 0, int w = WIDTH_PX, int h = HEIGHT_PX) {
+        fadeX0 = (int16_t)constrain(x, 0, WIDTH_PX);
+        fadeY0 = (int16_t)constrain(y, 0, HEIGHT_PX);
+        fadeX1 = (int16_t)constrain(x + w, 0, WIDTH_PX);
+        fadeY1 = (int16_t)constrain(y + h, 0, HEIGHT_PX);
+        fadeLevel = (fadeX0 < fadeX1 && fadeY0 < fadeY1) ? level : 255;
+        if (fadeLevel != 255 && fadeLevel != lutLevel) buildFadeLut(fadeLevel);
+    }
+
+    /** Direct access to the RGB565 frame (row-major, WIDTH_PX stride). */
+    uint16_t* pixels() { return frame; }
+    const uint16_t* pixels() const { return frame; }
+
+    /**
+     * Forget what the panel holds; the next present() repaints every pixel.
+     * Call after anything drew to the panel behind the canvas' back.
+     */
+    void invalidate() {
+        for (uint8_t i = 0; i < MAX_SHADOWS; i++) shadowValid[i] = false;
+    }
+
+    /**
+     * Push the pixels that differ from what the panel's back buffer holds,
+     * then flip (if double buffered).
+     */
+    void present(MatrixPanel_I2S_DMA* panel) {
+        if (!panel) return;
+        const uint8_t shadowCount = presentFlipsBuffers(panel) ? MAX_SHADOWS : 1;
+        if (backShadow >= shadowCount) backShadow = 0;
+
+        uint16_t* shadow = shadows[backShadow];
+        changedPixels = 0;
+        pushedSpans = 0;
+
+        if (!shadowValid[backShadow]) {
+            // Unknown panel contents: push everything (still span-merged).
+            for (int y = 0; y < HEIGHT_PX; y++) {
+                const uint16_t* src = composeRow(y);
+                pushRun(panel, src, y, 0, WIDTH_PX);
+                memcpy(&shadow[y * WIDTH_PX], src, WIDTH_PX * sizeof(uint16_t));
+            }
+            changedPixels = PIXEL_COUNT;
+            shadowValid[backShadow] = true;
+        } else {
+            for (int y = 0; y < HEIGHT_PX; y++) {
+                const uint16_t* src = composeRow(y);
+                uint16_t* dst = &shadow[y * WIDTH_PX];
+                if (memcmp(src, dst, WIDTH_PX * sizeof(uint16_t)) == 0) continue;
+
+                int x = 0;
+                while (x < WIDTH_PX) {
+                    if (src[x] == dst[x]) { x++; continue; }
+                    const int start = x;
+                    while (x < WIDTH_PX && src[x] != dst[x]) {
+                        dst[x] = src[x];
+                        x++;
+                    }
+                    changedPixels += (uint16_t)(x - start);
+                    pushRun(panel, src, y, start, x);
+                }
+            }
+        }
+
+        presentFrame(panel);
+        backShadow = (uint8_t)((backShadow + 1) % shadowCount);
+        fadeLevel = 255;
+    }
+
+    // Stats from the last present() (useful for profiling / debug overlays).
+    uint16_t lastChangedPixels() const { return changedPixels; }
+    uint16_t lastPushedSpans() const { return pushedSpans; }
+
+private:
+    uint16_t frame[PIXEL_COUNT];
+    uint16_t background[PIXEL_COUNT] = {};
+    uint16_t shadows[MAX_SHADOWS][PIXEL_COUNT];
+    bool shadowValid[MAX_SHADOWS];
+    uint8_t backShadow = 0;
+
+    uint16_t changedPixels = 0;
+    uint16_t pushedSpans = 0;
+
+    // Present-time fade (see setFade()); LUTs hold the scaled channel already in place.
+    uint8_t fadeLevel = 255;
+    uint8_t lutLevel = 255;
+    int16_t fadeX0 = 0, fadeY0 = 0, fadeX1 = 0, fadeY1 = 0;
+    uint16_t lutR[32];
+    uint16_t lutG[64];
+    uint16_t lutB[32];
+    uint16_t fadedRow[WIDTH_PX];
+
+    void buildFadeLut(uint8_t level) {
+        for (uint16_t v = 0; v < 32; v++) {
+            const uint16_t s = (uint16_t)((v * (uint16_t)level + 127u) / 255u);
+            lutR[v] = (uint16_t)(s << 11);
+            lutB[v] = s;
+        }
+        for (uint16_t v = 0; v < 64; v++) lutG[v] = (uint16_t)(((v * (uint16_t)level + 127u) / 255u) << 5);
+        lutLevel = level;
+    }
+
+    /** Row y as it should appear on the panel (the frame row itself unless faded). */
+    const uint16_t* composeRow(int y) {
+        const uint16_t* row = &frame[y * WIDTH_PX];
+        if (fadeLevel == 255 || y < fadeY0 || y >= fadeY1) return row;
+        memcpy(fadedRow, row, sizeof(fadedRow));
+        for (int x = fadeX0; x < fadeX1; x++) {
+            const uint16_t c = row[x];
+            fadedRow[x] = (uint16_t)(lutR[c >> 11] | lutG[(c >> 5) & 0x3F] | lutB[c & 0x1F]);
+        }
+        return fadedRow;
+    }
+
+    static inline void fillSpan(uint16_t* dst, int n, uint16_t color) {
+        for (int i = 0; i < n; i++) dst[i] = color;
+    }
+
+    /**
+     * Emit row[x0..x1) (panel row y) to the panel, merging equal-colored neighbours
+     * into a single drawFastHLine (the DMA driver's cheapest multi-pixel write).
+     */
+    void pushRun(MatrixPanel_I2S_DMA* panel, const uint16_t* row, int y, int x0, int x1) {
+        int x = x0;
+        while (x < x1) {
+            const uint16_t c = row[x];
+            int end = x + 1;
+            while (end < x1 && row[end] == c) end++;
+            if (end - x == 1) panel->drawPixel((int16_t)x, (int16_t)y, c);
+            else panel->drawFastHLine((int16_t)x, (int16_t)y, (int16_t)(end - x), c);
+            pushedSpans++;
+            x = end;
+        }
+    }
+};
+
+/**
+ * Present a canvas-rendered frame to the panel (diff push + buffer flip).
+ */
+static inline void presentFrame(FrameCanvas* canvas, MatrixPanel_I2S_DMA* panel) {
+    if (canvas) canvas->present(panel);
+    else presentFrame(panel);
+}
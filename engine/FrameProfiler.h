@@ -0,0 +1,250 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
+#include "config.h"
+#include "../component/SmallFont.h"
+
+/**
+ * FrameProfiler
+ * -------------
+ * Lightweight frame-time instrumentation for the engine loop.
+ *
+ * - Records update / draw / present durations (µs) into fixed-size log histograms,
+ *   per context (the engine registers one context per AppState and one per game).
+ * - Reports p50 / p95 / p99 / max per phase plus rendered and missed frames
+ *   (a frame is "missed" when update+draw+present exceeded the render interval).
+ * - Optional 1-line SmallFont overlay with the last frame's timings.
+ * - Serial commands (see `handleCommand()`): `p` dump, `o` overlay, `e` enable, `r` reset.
+ *
+ * Overhead:
+ * - ENABLE_FRAME_PROFILER 0: every call is an empty inline function.
+ * - Compiled in but disabled: one bool test per call, no `micros()` reads.
+ *
+ * Memory: MAX_CONTEXTS * PHASE_COUNT histograms of BUCKET_COUNT uint16_t (~7 KB).
+ */
+class FrameProfiler {
+public:
+    enum Phase : uint8_t { PHASE_UPDATE, PHASE_DRAW, PHASE_PRESENT, PHASE_COUNT };
+
+    static constexpr uint8_t MAX_CONTEXTS = 20;
+    static constexpr uint8_t NO_CONTEXT = 0xFF;
+
+    // Log histogram: 2 buckets per power of two (~±25% resolution), up to ~1 s.
+    static constexpr uint8_t BUCKET_COUNT = 42;
+
+#if ENABLE_FRAME_PROFILER
+    FrameProfiler() { reset(); }
+
+    bool isEnabled() const { return enabled; }
+    void setEnabled(bool on) { enabled = on; }
+    bool overlayVisible() const { return overlay; }
+    void setOverlay(bool on) { overlay = on; }
+
+    /** Name a context (shown in the serial report). `name` must outlive the profiler. */
+    void setContextName(uint8_t ctx, const char* name) {
+        if (ctx < MAX_CONTEXTS) contexts[ctx].name = name;
+    }
+
+    void reset() {
+        for (uint8_t c = 0; c < MAX_CONTEXTS; c++) {
+            const char* keepName = contexts[c].name;
+            memset(&contexts[c], 0, sizeof(contexts[c]));
+            contexts[c].name = keepName;
+        }
+        memset(lastUs, 0, sizeof(lastUs));
+    }
+
+    /**
+     * Start an engine tick. Samples recorded until `endTick()` go to `ctxA` and (if set) `ctxB`
+     * (e.g. the AppState context and the running game's context).
+     * `budgetUs` is the render interval; rendered ticks slower than that count as missed.
+     */
+    void beginTick(uint8_t ctxA, uint8_t ctxB, uint32_t budgetUs) {
+        if (!enabled) return;
+        tickCtx[0] = ctxA;
+        tickCtx[1] = ctxB;
+        tickBudgetUs = budgetUs;
+        memset(tickUs, 0, sizeof(tickUs));
+        tickRendered = false;
+    }
+
+    /** Timestamp for `end()`; 0 when disabled (no clock read). */
+    uint32_t begin() const { return enabled ? (uint32_t)micros() : 0; }
+
+    void end(Phase phase, uint32_t startUs) {
+        if (!enabled) return;
+        const uint32_t us = (uint32_t)micros() - startUs;
+        tickUs[phase] += us;
+        if (phase == PHASE_PRESENT) tickRendered = true;
+    }
+
+    void endTick() {
+        if (!enabled) return;
+        uint32_t total = 0;
+        for (uint8_t p = 0; p < PHASE_COUNT; p++) total += tickUs[p];
+        for (uint8_t i = 0; i < 2; i++) {
+            const uint8_t c = tickCtx[i];
+            if (c >= MAX_CONTEXTS) continue;
+            Context& ctx = contexts[c];
+            ctx.ticks++;
+            for (uint8_t p = 0; p < PHASE_COUNT; p++) {
+                // Only rendered ticks feed draw/present histograms (idle ticks would hide the cost).
+                if (p != PHASE_UPDATE && !tickRendered) continue;
+                record(ctx.phases[p], tickUs[p]);
+            }
+            if (tickRendered) {
+                ctx.frames++;
+                if (tickBudgetUs != 0 && total > tickBudgetUs) ctx.missed++;
+            }
+        }
+        if (tickRendered) memcpy(lastUs, tickUs, sizeof(lastUs));
+    }
+
+    /** Draw the 1-line overlay (last rendered frame, ms) at the bottom of `display`. */
+    void drawOverlay(MatrixPanel_I2S_DMA* display) const {
+        if (!overlay || !display) return;
+        // "U<ms>.<tenth> D<ms>.<tenth> P<ms>.<tenth>", ms clamped to 4 digits.
+        static const char PHASE_TAGS[PHASE_COUNT] = { 'U', 'D', 'P' };
+        char line[PHASE_COUNT * 8];
+        uint8_t n = 0;
+        for (uint8_t p = 0; p < PHASE_COUNT; p++) {
+            const uint32_t tenths = lastUs[p] / 100;
+            const uint32_t ms = (tenths / 10 < 9999) ? tenths / 10 : 9999;
+            char num[5];
+            const uint8_t len = SmallFont::formatUInt(num, sizeof(num), ms);
+            if (p > 0) line[n++] = ' ';
+            line[n++] = PHASE_TAGS[p];
+            for (uint8_t i = 0; i < len; i++) line[n++] = num[i];
+            line[n++] = '.';
+            line[n++] = (char)('0' + tenths % 10);
+        }
+        line[n] = '\0';
+        display->fillRect(0, PANEL_RES_Y - 7, PANEL_RES_X * PANEL_CHAIN, 7, COLOR_BLACK);
+        SmallFont::drawString(display, 1, PANEL_RES_Y - 1, line, COLOR_YELLOW);
+    }
+
+    /** Print all contexts that have samples. */
+    void dump(Print& out) const {
+        static const char* const PHASE_NAMES[PHASE_COUNT] = { "update ", "draw   ", "present" };
+        out.println(F("[Prof] ---- frame profile (us) ----"));
+        for (uint8_t c = 0; c < MAX_CONTEXTS; c++) {
+            const Context& ctx = contexts[c];
+            if (ctx.ticks == 0) continue;
+            out.print(F("[Prof] "));
+            out.print(ctx.name ? ctx.name : "?");
+            out.print(F(" ticks="));
+            out.print(ctx.ticks);
+            out.print(F(" frames="));
+            out.print(ctx.frames);
+            out.print(F(" missed="));
+            out.println(ctx.missed);
+            for (uint8_t p = 0; p < PHASE_COUNT; p++) {
+                const Histogram& h = ctx.phases[p];
+                if (h.samples == 0) continue;
+                out.print(F("[Prof]   "));
+                out.print(PHASE_NAMES[p]);
+                out.print(F(" p50="));
+                out.print(percentile(h, 50));
+                out.print(F(" p95="));
+                out.print(percentile(h, 95));
+                out.print(F(" p99="));
+                out.print(percentile(h, 99));
+                out.print(F(" max="));
+                out.println(h.maxUs);
+            }
+        }
+    }
+
+    /** Handle a single-character serial command. Returns false if `c` is not a profiler command. */
+    bool handleCommand(char c) {
+        switch (c) {
+            case 'p': dump(Serial); return true;
+            case 'o': overlay = !overlay; if (overlay) enabled = true; return true;
+            case 'e': enabled = !enabled; return true;
+            case 'r': reset(); Serial.println(F("[Prof] reset")); return true;
+            default: return false;
+        }
+    }
+
+private:
+    struct Histogram {
+        uint16_t buckets[BUCKET_COUNT];
+        uint32_t samples;
+        uint32_t maxUs;
+    };
+    struct Context {
+        const char* name;
+        uint32_t ticks;
+        uint32_t frames;
+        uint32_t missed;
+        Histogram phases[PHASE_COUNT];
+    };
+
+    bool enabled = (FRAME_PROFILER_START_ENABLED != 0);
+    bool overlay = false;
+    Context contexts[MAX_CONTEXTS] = {};
+
+    uint8_t tickCtx[2] = { NO_CONTEXT, NO_CONTEXT };
+    uint32_t tickBudgetUs = 0;
+    uint32_t tickUs[PHASE_COUNT] = {};
+    bool tickRendered = false;
+    uint32_t lastUs[PHASE_COUNT] = {};
+
+    static inline uint8_t bucketFor(uint32_t us) {
+        if (us < 2) return (uint8_t)us;
+        const uint8_t msb = (uint8_t)(31 - __builtin_clz(us));
+        const uint8_t idx = (uint8_t)(2 * msb + ((us >> (msb - 1)) & 1));
+        return (idx < BUCKET_COUNT) ? idx : (uint8_t)(BUCKET_COUNT - 1);
+    }
+
+    // Upper bound (exclusive) of a bucket, used as the reported percentile value.
+    static inline uint32_t bucketUpperUs(uint8_t idx) {
+        if (idx < 2) return (uint32_t)idx + 1;
+        const uint8_t msb = (uint8_t)(idx / 2);
+        return (uint32_t)(3 + (idx & 1)) << (msb - 1);
+    }
+
+    static void record(Histogram& h, uint32_t us) {
+        uint16_t& b = h.buckets[bucketFor(us)];
+        if (b == 0xFFFF) {
+            // Saturated: halve everything so the shape is preserved.
+            for (uint8_t i = 0; i < BUCKET_COUNT; i++) h.buckets[i] >>= 1;
+        }
+        b++;
+        h.samples++;
+        if (us > h.maxUs) h.maxUs = us;
+    }
+
+    static uint32_t percentile(const Histogram& h, uint8_t pct) {
+        uint32_t total = 0;
+        for (uint8_t i = 0; i < BUCKET_COUNT; i++) total += h.buckets[i];
+        if (total == 0) return 0;
+        const uint32_t target = (total * pct + 99) / 100;
+        uint32_t acc = 0;
+        for (uint8_t i = 0; i < BUCKET_COUNT; i++) {
+            acc += h.buckets[i];
+            if (acc >= target) {
+                const uint32_t upper = bucketUpperUs(i);
+                return (upper < h.maxUs) ? upper : h.maxUs;
+            }
+        }
+        return h.maxUs;
+    }
+#else
+    // Compiled out: all calls are no-ops.
+    bool isEnabled() const { return false; }
+    void setEnabled(bool) {}
+    bool overlayVisible() const { return false; }
+    void setOverlay(bool) {}
+    void setContextName(uint8_t, const char*) {}
+    void reset() {}
+    void beginTick(uint8_t, uint8_t, uint32_t) {}
+    uint32_t begin() const { return 0; }
+    void end(Phase, uint32_t) {}
+    void endTick() {}
+    void drawOverlay(MatrixPanel_I2S_DMA*) const {}
+    void dump(Print&) const {}
+    bool handleCommand(char) { return false; }
+#endif
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include <Arduino.h>
+#include <stddef.h>
+#include "GameBase.h"
+#include "GameDescriptor.h"
+
+/**
+ * GameArena
+ * ---------
+ * One statically allocated, suitably aligned block that holds the running game.
+ *
+ * Why: games are big objects (Shooter pools, Tron trail grid, Snake board). Creating them
+ * with new/delete on every launch fragments the heap over hours of uptime until a launch
+ * fails; with the arena, launching is a placement-new into memory reserved at link time.
+ *
+ * `Size` / `Align` come from the game registry (largest / strictest registered game), so a
+ * game that does not fit cannot be registered without also growing the arena.
+ * Only one game lives here at a time: `create()` destroys the previous one first.
+ * Memory a game allocates internally is still its own business.
+ */
+template <size_t Size, size_t Align>
+class GameArena {
+public:
+    static constexpr size_t CAPACITY = Size;
+
+    GameArena() = default;
+    GameArena(const GameArena&) = delete;
+    GameArena& operator=(const GameArena&) = delete;
+
+    /** Destroy the current game (if any) and construct `desc`'s game in place. */
+    GameBase* create(const GameDescriptor& desc) {
+        destroy();
+        if (desc.staticBytes > Size || desc.alignBytes > Align) return nullptr;
+        live = desc.construct(storage);
+        return live;
+    }
+
+    /** Run the current game's destructor; the memory stays reserved. */
+    void destroy() {
+        if (!live) return;
+        live->~GameBase();
+        live = nullptr;
+    }
+
+    GameBase* current() const { return live; }
+
+private:
+    alignas(Align) uint8_t storage[Size];
+    GameBase* live = nullptr;
+};
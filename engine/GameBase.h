@@ -6,7 +6,15 @@
 class GameBase {
 public:
     virtual void start() = 0;
-    virtual void update(ControllerManager* input) = 0;
+    /**
+     * Legacy per-loop update (see `fixedStepMs()`). Games with a fixed step don't
+     * override this: the default runs one `step()` at the current time, for callers
+     * that drive games without the scheduler (e.g. the host bench).
+     */
+    virtual void update(ControllerManager* input) {
+        const uint16_t dtMs = fixedStepMs();
+        if (dtMs > 0) step(input, (uint32_t)millis(), dtMs);
+    }
     virtual void draw(MatrixPanel_I2S_DMA* display) = 0;
     virtual bool isGameOver() = 0;
     virtual void reset() = 0;
@@ -34,5 +42,85 @@ public:
      * Default: use the global game render FPS.
      */
     virtual uint16_t preferredRenderFps() const { return GAME_RENDER_FPS; }
+
+    /**
+     * Render FPS matching a simulation tick (10..GAME_RENDER_FPS; 0 ms = GAME_RENDER_FPS).
+     * constexpr so games can publish it as `RENDER_FPS` for the game registry.
+     */
+    static constexpr uint16_t renderFpsForTickMs(uint32_t tickMs) {
+        return (tickMs == 0) ? (uint16_t)GAME_RENDER_FPS
+             : (1000UL / tickMs < 10) ? (uint16_t)10
+             : (1000UL / tickMs > GAME_RENDER_FPS) ? (uint16_t)GAME_RENDER_FPS
+             : (uint16_t)(1000UL / tickMs);
+    }
+
+    // -----------------------------------------------------
+    // Optional: Fixed-timestep simulation
+    // -----------------------------------------------------
+    /**
+     * Fixed simulation step in ms (0 = legacy contract: engine calls `update()` every loop
+     * and the game throttles itself).
+     *
+     * Why: self-throttling (`if (now - lastUpdate < INTERVAL) return;`) silently drops
+     * simulation time whenever a frame runs long (e.g. an EEPROM leaderboard commit).
+     * With a fixed step the engine accumulates real time and calls `step()` as often as
+     * needed (bounded catch-up, see engine/FixedStepScheduler.h), so game speed is stable.
+     * Fixed-step games override this and `step()`, not `update()`.
+     */
+    virtual uint16_t fixedStepMs() const { return 0; }
+
+    /**
+     * Advance the simulation by exactly `dtMs` (== fixedStepMs()). No throttling inside.
+     * `nowMs` is the simulated time of this step: during catch-up the engine runs several
+     * steps in one loop pass, each `dtMs` apart, so step timers must use it, not `millis()`.
+     * Default: forward to `update()` (legacy games; fixed-step games must override).
+     */
+    virtual void step(ControllerManager* input, uint32_t nowMs, uint16_t dtMs) {
+        (void)nowMs;
+        (void)dtMs;
+        update(input);
+    }
+
+    /**
+     * Render with an interpolation factor `alpha` in [0..1]: how far real time has
+     * progressed from the last completed step towards the next one.
+     * Fixed-step games can blend previous/current positions for smooth motion when
+     * render and simulation rates differ. Default: ignore alpha and `draw()`.
+     */
+    virtual void drawInterpolated(MatrixPanel_I2S_DMA* display, float alpha) {
+        (void)alpha;
+        draw(display);
+    }
+
+    // -----------------------------------------------------
+    // Optional: Incremental rendering
+    // -----------------------------------------------------
+    /**
+     * The canvas no longer holds this game's previous frame: the engine drew over it
+     * (game start / resume / reset, pause snapshot, profiler overlay).
+     *
+     * Games that clear the screen in every `draw()` can ignore this. Games that repaint
+     * only what changed (see component/TileLayer.h) must repaint everything next draw.
+     */
+    virtual void onCanvasLost() {}
+
+    // -----------------------------------------------------
+    // Optional: Present-time fade
+    // -----------------------------------------------------
+    /** Brightness of a screen rect for the frame just drawn (w/h 0 = whole screen). */
+    struct PresentFade {
+        uint8_t level;   // 255 = no fade, 0 = black
+        int16_t x, y, w, h;
+    };
+
+    /**
+     * Fade applied while the engine presents the frame just drawn (FrameCanvas::setFade()).
+     * An RGB565 game can run a fade in/out or dim by returning a level here instead of
+     * recoloring its pixels in `draw()`: no extra draw time, and its colors stay constant
+     * (retained / incremental renderers are not invalidated by a fade). No game uses it
+     * yet; Labyrinth fades through its IndexedCanvas palette instead.
+     */
+    virtual PresentFade presentFade() const { return PresentFade{ 255, 0, 0, 0, 0 }; }
+
     virtual ~GameBase() {}
 };
@@ -0,0 +1,66 @@
+#pragma once
+#include <Arduino.h>
+#include <new>
+#include "GameBase.h"
+#include "config.h"
+
+/**
+ * GameDescriptor
+ * --------------
+ * Compile-time description of one launchable game / applet (see Games/GameRegistry.h).
+ *
+ * Build entries with `GameDescriptor::of<T>(...)` so the factory, render FPS and object
+ * size come from the game class itself:
+ * - `construct`    : placement-new of T into caller-provided storage (see engine/GameArena.h);
+ *                    the engine calls `start()` afterwards
+ * - `preferredFps` : `T::RENDER_FPS` if the class publishes it, else GAME_RENDER_FPS
+ * - `staticBytes`  : `sizeof(T)` / `alignBytes`: `alignof(T)` (sizes the game arena)
+ */
+struct GameDescriptor {
+    const char* name;            // menu label
+    const char* leaderboardId;   // stable leaderboard id (must match T::leaderboardId()), nullptr = no scores
+    uint8_t minPlayers;
+    uint8_t maxPlayers;
+    uint16_t preferredFps;
+    uint32_t staticBytes;
+    uint16_t alignBytes;
+    GameBase* (*construct)(void* storage);
+
+    bool acceptsPlayers(int players) const {
+        return players >= (int)minPlayers && players <= (int)maxPlayers;
+    }
+    bool hasLeaderboard() const { return leaderboardId != nullptr; }
+
+    template <typename T>
+    static constexpr GameDescriptor of(const char* name, const char* leaderboardId,
+                                       uint8_t minPlayers = 1, uint8_t maxPlayers = MAX_GAMEPADS) {
+        return GameDescriptor{ name, leaderboardId, minPlayers, maxPlayers,
+                               renderFps<T>(0), (uint32_t)sizeof(T), (uint16_t)alignof(T),
+                               &constructIn<T> };
+    }
+
+private:
+    template <typename T>
+    static GameBase* constructIn(void* storage) { return new (storage) T(); }
+
+    template <typename T>
+    static constexpr auto renderFps(int) -> decltype(T::RENDER_FPS, uint16_t()) { return (uint16_t)T::RENDER_FPS; }
+    template <typename T>
+    static constexpr uint16_t renderFps(...) { return (uint16_t)GAME_RENDER_FPS; }
+};
+
+/**
+ * Per-entry launch timing (construct + `start()`), filled in by the engine.
+ * Plain counters; reported over serial (see the engine's `g` command).
+ */
+struct GameLaunchStats {
+    uint32_t launches = 0;
+    uint32_t lastUs = 0;
+    uint32_t maxUs = 0;
+
+    void record(uint32_t us) {
+        launches++;
+        lastUs = us;
+        if (us > maxUs) maxUs = us;
+    }
+};
@@ -0,0 +1,105 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * GridBitset
+ * ----------
+ * One bit per cell of a W x H grid (occupancy / walls), one machine word per row.
+ *
+ * - `set()` / `reset()` / `test()` are O(1); games keep the bits in sync as things
+ *   move instead of rescanning their entity lists.
+ * - Rows are words (uint32_t up to 32 columns, uint64_t up to 64), so neighbourhood
+ *   tests are shifts and ANDs: `freeBoxes()` marks every top-left cell where a w x h box
+ *   fits on free cells.
+ * - `pickSet(k)` is rank/select: the k-th set cell in row-major order, via per-row
+ *   popcounts. Uniform random placement = `pickSet(random(0, count()))`, with no retry
+ *   loop, however crowded the grid is.
+ */
+namespace GridBitsetDetail {
+template <bool Narrow> struct RowWord { typedef uint64_t type; };
+template <> struct RowWord<true> { typedef uint32_t type; };
+
+static inline uint8_t popcount(uint32_t v) { return (uint8_t)__builtin_popcount(v); }
+static inline uint8_t popcount(uint64_t v) { return (uint8_t)__builtin_popcountll(v); }
+static inline uint8_t lowestBit(uint32_t v) { return (uint8_t)__builtin_ctz(v); }
+static inline uint8_t lowestBit(uint64_t v) { return (uint8_t)__builtin_ctzll(v); }
+} // namespace GridBitsetDetail
+
+template <uint8_t W, uint8_t H>
+class GridBitset {
+    static_assert(W >= 1 && W <= 64, "GridBitset supports 1..64 columns");
+
+public:
+    typedef typename GridBitsetDetail::RowWord<(W <= 32)>::type Row;
+    static constexpr Row ROW_MASK = (W == sizeof(Row) * 8) ? (Row)~(Row)0 : (Row)(((Row)1 << W) - 1);
+
+    GridBitset() { clear(); }
+
+    void clear() { memset(rows, 0, sizeof(rows)); }
+
+    bool test(int x, int y) const { return (rows[y] >> x) & 1u; }
+    void set(int x, int y) { rows[y] |= (Row)1 << x; }
+    void reset(int x, int y) { rows[y] &= (Row)~((Row)1 << x); }
+
+    Row row(uint8_t y) const { return rows[y]; }
+    void setRow(uint8_t y, Row bits) { rows[y] = (Row)(bits & ROW_MASK); }
+
+    void andNot(const GridBitset& o) {
+        for (uint8_t y = 0; y < H; y++) rows[y] &= (Row)~o.rows[y];
+    }
+
+    /** Set every cell of the w x h box at (x, y) (clipped to the grid). */
+    void setBox(int x, int y, int w, int h) {
+        for (int yy = max(0, y); yy < min((int)H, y + h); yy++) {
+            for (int xx = max(0, x); xx < min((int)W, x + w); xx++) set(xx, yy);
+        }
+    }
+
+    uint16_t count() const {
+        uint16_t c = 0;
+        for (uint8_t y = 0; y < H; y++) c += GridBitsetDetail::popcount(rows[y]);
+        return c;
+    }
+
+    /**
+     * Top-left cells (x < maxX, y < maxY) of every w x h box lying entirely on clear
+     * cells of `blocked`. Written into `out` (previous contents are replaced).
+     */
+    static void freeBoxes(const GridBitset& blocked, uint8_t w, uint8_t h, uint8_t maxX, uint8_t maxY, GridBitset& out) {
+        const Row xMask = (maxX >= W) ? ROW_MASK : (Row)(((Row)1 << maxX) - 1);
+        for (uint8_t y = 0; y < H; y++) {
+            if (y >= maxY || y + h > H) {
+                out.rows[y] = 0;
+                continue;
+            }
+            Row fits = ROW_MASK;
+            for (uint8_t dy = 0; dy < h; dy++) {
+                const Row freeRow = (Row)(~blocked.rows[y + dy] & ROW_MASK);
+                for (uint8_t dx = 0; dx < w; dx++) fits &= (Row)(freeRow >> dx);
+            }
+            out.rows[y] = (Row)(fits & xMask);
+        }
+    }
+
+    /** The k-th set cell (row-major, k < count()); false if there are not that many. */
+    bool pickSet(uint16_t k, int16_t& outX, int16_t& outY) const {
+        for (uint8_t y = 0; y < H; y++) {
+            Row bits = rows[y];
+            const uint8_t n = GridBitsetDetail::popcount(bits);
+            if (k >= n) {
+                k = (uint16_t)(k - n);
+                continue;
+            }
+            while (k-- > 0) bits &= (Row)(bits - 1); // drop the lowest k set bits
+            outX = (int16_t)GridBitsetDetail::lowestBit(bits);
+            outY = (int16_t)y;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    Row rows[H];
+};
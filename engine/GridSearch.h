@@ -0,0 +1,114 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+#include "GridBitset.h"
+
+/**
+ * GridSearch
+ * ----------
+ * Breadth-first search and flood fill on `GridBitset` grids, a whole row word at a time
+ * (for bots: Snake CPU opponents, Tron).
+ *
+ * - `Wavefront` is a BFS over 4-neighbourhoods: each `grow()` adds one distance layer
+ *   (every passable cell next to a reached one) using shifts / ORs per row, so a layer
+ *   costs O(H) word ops whatever the number of cells in it.
+ * - Distance to a cell = the number of `grow()` calls until `reached.test()` is true.
+ *   Seeding with several cells (e.g. all food cells) gives the distance to the nearest.
+ * - `wrap` connects opposite edges (Snake's playfield); without it edges are walls.
+ * - Callers drive the loop, so they can stop on a target, a step cap or a `WorkBudget`.
+ */
+namespace GridSearch {
+
+/**
+ * Search budget counted in row words processed (one `grow()`, `count()` or row-wise
+ * `andNot()` on an H-row grid = H).
+ *
+ * Bots budget their planning by work, not by `micros()`: where a search stops then
+ * depends only on the position, so a recorded game replays the same moves on any
+ * machine (engine/InputLog.h). `fromUs()` converts a time budget using
+ * ROW_WORDS_PER_US, a conservative estimate for the ESP32 at 240 MHz.
+ */
+class WorkBudget {
+public:
+    static constexpr uint32_t ROW_WORDS_PER_US = 4;
+    static constexpr uint32_t fromUs(uint32_t us) { return us * ROW_WORDS_PER_US; }
+
+    explicit WorkBudget(uint32_t rowWords) : left(rowWords) {}
+
+    /** Pay for `rowWords` of work; false (nothing paid, budget exhausted) if it doesn't fit. */
+    bool spend(uint32_t rowWords) {
+        if (rowWords > left) {
+            cut = true;
+            return false;
+        }
+        left -= rowWords;
+        return true;
+    }
+
+    uint32_t remaining() const { return left; }
+    /** Some search was cut short by this budget. */
+    bool exhausted() const { return cut; }
+
+private:
+    uint32_t left;
+    bool cut = false;
+};
+
+template <uint8_t W, uint8_t H>
+class Wavefront {
+public:
+    typedef GridBitset<W, H> Grid;
+    typedef typename Grid::Row Row;
+
+    Grid reached;
+    uint16_t steps = 0;
+
+    /** Start from `seeds` (kept even where not passable, like a head cell). */
+    void start(const Grid& seeds) {
+        reached = seeds;
+        steps = 0;
+    }
+
+    void start(int x, int y) {
+        reached.clear();
+        reached.set(x, y);
+        steps = 0;
+    }
+
+    /** Add one BFS layer through `passable`; false once nothing new was reached. */
+    bool grow(const Grid& passable, bool wrap) {
+        Row next[H];
+        bool changed = false;
+        for (uint8_t y = 0; y < H; y++) {
+            const Row r = reached.row(y);
+            Row n = (Row)((r << 1) | (r >> 1));
+            if (wrap) n |= (Row)((r >> (W - 1)) | ((r & 1) << (W - 1)));
+            if (y > 0) n |= reached.row(y - 1);
+            else if (wrap) n |= reached.row(H - 1);
+            if (y + 1 < H) n |= reached.row(y + 1);
+            else if (wrap) n |= reached.row(0);
+            next[y] = (Row)(r | (n & passable.row(y) & Grid::ROW_MASK));
+            changed = changed || (next[y] != r);
+        }
+        if (!changed) return false;
+        for (uint8_t y = 0; y < H; y++) reached.setRow(y, next[y]);
+        steps++;
+        return true;
+    }
+};
+
+/**
+ * Cells reachable from (x, y) through `passable`, counting (x, y) itself; stops early once
+ * `stopAt` cells are reached (0 = no limit) or `budget` runs out (count found so far).
+ */
+template <uint8_t W, uint8_t H>
+static uint16_t floodCount(const GridBitset<W, H>& passable, int x, int y, bool wrap, uint16_t stopAt, WorkBudget& budget) {
+    Wavefront<W, H> wave;
+    wave.start(x, y);
+    uint16_t n = 1;
+    // Each layer is two passes over the rows: grow() and count().
+    while ((stopAt == 0 || n < stopAt) && budget.spend(2 * H) && wave.grow(passable, wrap)) n = wave.reached.count();
+    return n;
+}
+
+} // namespace GridSearch
@@ -0,0 +1,171 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
+#include "config.h"
+
+/**
+ * IndexedCanvas
+ * -------------
+ * Optional 8-bit palette-indexed framebuffer (64x64 = 4 KB plus a 256-entry RGB565
+ * palette) for games whose look is a handful of colors that change together (fades).
+ *
+ * - It *is a* `MatrixPanel_I2S_DMA` (never `begin()`-ed) like FrameCanvas, so the usual
+ *   Adafruit_GFX / SmallFont / TileLayer drawing works. The low byte of every color
+ *   argument is a palette index.
+ * - Recoloring is a palette write (`setColor()`, `fadeColors()`): O(entries) instead
+ *   of touching every pixel.
+ * - `resolve(display)` converts to RGB565 at present time: rows whose indices or whose
+ *   colors changed are emitted as spans of equal index. Other rows are left as they are,
+ *   so the destination must still hold the last resolve (call `invalidate()` otherwise,
+ *   e.g. from `GameBase::onCanvasLost()`).
+ *
+ * One shared instance (`shared()`); it only takes RAM in builds where a game uses it.
+ * The buffer is retained between frames but not between games: a game that starts
+ * using it repaints everything first.
+ */
+class IndexedCanvas : public MatrixPanel_I2S_DMA {
+public:
+    static constexpr int WIDTH_PX = PANEL_RES_X * PANEL_CHAIN;
+    static constexpr int HEIGHT_PX = PANEL_RES_Y;
+    static constexpr int PIXEL_COUNT = WIDTH_PX * HEIGHT_PX;
+    static constexpr uint16_t PALETTE_SIZE = 256;
+
+    IndexedCanvas() : MatrixPanel_I2S_DMA(HUB75_I2S_CFG(PANEL_RES_X, PANEL_RES_Y, PANEL_CHAIN)) {
+        memset(index, 0, sizeof(index));
+        memset(palette, 0, sizeof(palette));
+        invalidate();
+    }
+
+    static IndexedCanvas& shared() {
+        static IndexedCanvas canvas;
+        return canvas;
+    }
+
+    // -----------------------------------------------------
+    // Drawing primitives (indices; RAM only)
+    // -----------------------------------------------------
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if ((uint16_t)x >= (uint16_t)WIDTH_PX || (uint16_t)y >= (uint16_t)HEIGHT_PX) return;
+        writeSpan(y, x, 1, (uint8_t)color);
+    }
+
+    void fillScreen(uint16_t color) override {
+        for (int y = 0; y < HEIGHT_PX; y++) writeSpan(y, 0, WIDTH_PX, (uint8_t)color);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        if ((uint16_t)y >= (uint16_t)HEIGHT_PX || w <= 0) return;
+        int x0 = x;
+        int x1 = (int)x + (int)w;
+        if (x0 < 0) x0 = 0;
+        if (x1 > WIDTH_PX) x1 = WIDTH_PX;
+        if (x0 >= x1) return;
+        writeSpan(y, x0, x1 - x0, (uint8_t)color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+        if ((uint16_t)x >= (uint16_t)WIDTH_PX || h <= 0) return;
+        int y0 = y;
+        int y1 = (int)y + (int)h;
+        if (y0 < 0) y0 = 0;
+        if (y1 > HEIGHT_PX) y1 = HEIGHT_PX;
+        for (int yy = y0; yy < y1; yy++) writeSpan(yy, x, 1, (uint8_t)color);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        if (w <= 0 || h <= 0) return;
+        int x0 = x, x1 = (int)x + (int)w;
+        int y0 = y, y1 = (int)y + (int)h;
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+        if (x1 > WIDTH_PX) x1 = WIDTH_PX;
+        if (y1 > HEIGHT_PX) y1 = HEIGHT_PX;
+        if (x0 >= x1 || y0 >= y1) return;
+        for (int yy = y0; yy < y1; yy++) writeSpan(yy, x0, x1 - x0, (uint8_t)color);
+    }
+
+    /** Direct access to the index buffer (row-major, WIDTH_PX stride); writers call `invalidate()`. */
+    uint8_t* indices() { return index; }
+    const uint8_t* indices() const { return index; }
+
+    // -----------------------------------------------------
+    // Palette
+    // -----------------------------------------------------
+    uint16_t color(uint8_t i) const { return palette[i]; }
+
+    void setColor(uint8_t i, uint16_t c) {
+        if (palette[i] == c) return;
+        palette[i] = c;
+        paletteChanged = true;
+    }
+
+    /** Entries first.. = `base` colors scaled toward black (alpha 0 = black, 255 = base). */
+    void fadeColors(uint8_t first, const uint16_t* base, uint16_t count, uint8_t alpha) {
+        for (uint16_t k = 0; k < count && first + k < PALETTE_SIZE; k++) {
+            setColor((uint8_t)(first + k), scaleColor(base[k], alpha));
+        }
+    }
+
+    /** RGB565 scaled toward black, rounded per channel (alpha 0..255). */
+    static inline uint16_t scaleColor(uint16_t c, uint8_t alpha) {
+        if (alpha == 255) return c;
+        const uint16_t r5 = (uint16_t)((c >> 11) & 0x1Fu);
+        const uint16_t g6 = (uint16_t)((c >> 5) & 0x3Fu);
+        const uint16_t b5 = (uint16_t)(c & 0x1Fu);
+        const uint16_t r5s = (uint16_t)((r5 * (uint16_t)alpha + 127u) / 255u);
+        const uint16_t g6s = (uint16_t)((g6 * (uint16_t)alpha + 127u) / 255u);
+        const uint16_t b5s = (uint16_t)((b5 * (uint16_t)alpha + 127u) / 255u);
+        return (uint16_t)((r5s << 11) | (g6s << 5) | b5s);
+    }
+
+    // -----------------------------------------------------
+    // Present
+    // -----------------------------------------------------
+    /** Forget what the destination holds; the next resolve() emits every row. */
+    void invalidate() { paletteChanged = true; }
+
+    /** Convert changed rows to RGB565 spans on `display`; returns rows emitted. */
+    uint16_t resolve(MatrixPanel_I2S_DMA* display) {
+        if (!display) return 0;
+        uint16_t rows = 0;
+        for (int y = 0; y < HEIGHT_PX; y++) {
+            if (!paletteChanged && !rowDirty(y)) continue;
+            const uint8_t* row = &index[y * WIDTH_PX];
+            int x = 0;
+            while (x < WIDTH_PX) {
+                const uint8_t v = row[x];
+                int end = x + 1;
+                while (end < WIDTH_PX && row[end] == v) end++;
+                display->drawFastHLine((int16_t)x, (int16_t)y, (int16_t)(end - x), palette[v]);
+                x = end;
+            }
+            rows++;
+        }
+        memset(dirtyRows, 0, sizeof(dirtyRows));
+        paletteChanged = false;
+        return rows;
+    }
+
+private:
+    static constexpr int ROW_WORDS = (HEIGHT_PX + 31) / 32;
+
+    uint8_t index[PIXEL_COUNT];
+    uint16_t palette[PALETTE_SIZE];
+    uint32_t dirtyRows[ROW_WORDS] = {};
+    bool paletteChanged = true;
+
+    bool rowDirty(int y) const { return (dirtyRows[y >> 5] & (1u << (y & 31))) != 0; }
+
+    // Only rows whose bytes actually change are re-emitted, so redrawing an unchanged
+    // HUD or clearing an already clear margin every frame costs nothing at present time.
+    inline void writeSpan(int y, int x0, int n, uint8_t v) {
+        uint8_t* p = &index[y * WIDTH_PX + x0];
+        for (int i = 0; i < n; i++) {
+            if (p[i] == v) continue;
+            memset(p + i, v, (size_t)(n - i));
+            dirtyRows[y >> 5] |= (1u << (y & 31));
+            return;
+        }
+    }
+};
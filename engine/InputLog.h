@@ -0,0 +1,374 @@
+#pragma once
+#include <Arduino.h>
+#include <string.h>
+#include "config.h"
+#include "ControllerManager.h"
+
+/**
+ * InputLog
+ * --------
+ * Deterministic input recording / replay for game runs.
+ *
+ * A recording starts when a game is created from the menu (`onGameStart()`):
+ * the RNG behind `random()` is reseeded with a fresh seed that is stored in the
+ * log header, then every engine tick's input snapshot (all MAX_GAMEPADS pads) is
+ * compared against the previous one and only changes are appended. Replaying
+ * reseeds `random()` with the same seed and overwrites the engine's snapshot
+ * with the logged pad states at the same ms offsets, so the game sees the exact
+ * same inputs. Host runs (virtual 1 ms clock) reproduce bit-exactly; logs taken on
+ * the ESP32 reproduce input and timing at 1 ms resolution.
+ *
+ * Binary format (little endian):
+ *   header: "SGIL" | u8 version | u8 padCount | u8 gameSlot | u8 reserved | u32 seed
+ *   record: varint msDelta | u8 presentMask | u8 changedMask | PadState x popcount(changedMask)
+ *   PadState (17 bytes): u8 dpad | u16 buttons | u16 misc | i16 ax,ay,rx,ry | u16 brake,throttle
+ *
+ * Replay needs a Controller whose state can be written, which only the host stub
+ * offers (see PadStateIO::apply). On the device, logs are recorded and dumped
+ * over serial for offline replay.
+ */
+struct InputPadState {
+    uint8_t dpad = 0;
+    uint16_t buttons = 0;
+    uint16_t misc = 0;
+    int16_t ax = 0, ay = 0, rx = 0, ry = 0;
+    uint16_t brake = 0, throttle = 0;
+
+    bool operator==(const InputPadState& o) const {
+        return dpad == o.dpad && buttons == o.buttons && misc == o.misc &&
+               ax == o.ax && ay == o.ay && rx == o.rx && ry == o.ry &&
+               brake == o.brake && throttle == o.throttle;
+    }
+    bool operator!=(const InputPadState& o) const { return !(*this == o); }
+};
+
+// Bluepad32 API surface varies by version/controller; bind whatever exists.
+struct PadStateIO {
+    template <typename T>
+    static auto dpad(T* c, int) -> decltype(c->dpad(), uint8_t()) { return (uint8_t)c->dpad(); }
+    template <typename T>
+    static uint8_t dpad(T*, ...) { return 0; }
+
+    template <typename T>
+    static auto buttons(T* c, int) -> decltype(c->buttons(), uint16_t()) { return (uint16_t)c->buttons(); }
+    template <typename T>
+    static uint16_t buttons(T*, ...) { return 0; }
+
+    template <typename T>
+    static auto misc(T* c, int) -> decltype(c->miscButtons(), uint16_t()) { return (uint16_t)c->miscButtons(); }
+    template <typename T>
+    static uint16_t misc(T*, ...) { return 0; }
+
+    template <typename T>
+    static auto axisX(T* c, int) -> decltype(c->axisX(), int16_t()) { return (int16_t)c->axisX(); }
+    template <typename T>
+    static int16_t axisX(T*, ...) { return 0; }
+
+    template <typename T>
+    static auto axisY(T* c, int) -> decltype(c->axisY(), int16_t()) { return (int16_t)c->axisY(); }
+    template <typename T>
+    static int16_t axisY(T*, ...) { return 0; }
+
+    template <typename T>
+    static auto axisRX(T* c, int) -> decltype(c->axisRX(), int16_t()) { return (int16_t)c->axisRX(); }
+    template <typename T>
+    static int16_t axisRX(T*, ...) { return 0; }
+
+    template <typename T>
+    static auto axisRY(T* c, int) -> decltype(c->axisRY(), int16_t()) { return (int16_t)c->axisRY(); }
+    template <typename T>
+    static int16_t axisRY(T*, ...) { return 0; }
+
+    template <typename T>
+    static auto brake(T* c, int) -> decltype(c->brake(), uint16_t()) { return (uint16_t)c->brake(); }
+    template <typename T>
+    static uint16_t brake(T*, ...) { return 0; }
+
+    template <typename T>
+    static auto throttle(T* c, int) -> decltype(c->throttle(), uint16_t()) { return (uint16_t)c->throttle(); }
+    template <typename T>
+    static uint16_t throttle(T*, ...) { return 0; }
+
+    static InputPadState capture(Controller* c) {
+        InputPadState s;
+        if (!c) return s;
+        s.dpad = dpad(c, 0);
+        s.buttons = buttons(c, 0);
+        s.misc = misc(c, 0);
+        s.ax = axisX(c, 0);
+        s.ay = axisY(c, 0);
+        s.rx = axisRX(c, 0);
+        s.ry = axisRY(c, 0);
+        s.brake = brake(c, 0);
+        s.throttle = throttle(c, 0);
+        return s;
+    }
+
+    // Writable controllers (host stub exposes its raw fields).
+    template <typename T>
+    static auto apply(T* c, const InputPadState& s, int) -> decltype(c->buttonBits = 0, bool()) {
+        c->connected = true;
+        c->dpadBits = s.dpad;
+        c->buttonBits = s.buttons;
+        c->miscBits = s.misc;
+        c->ax = s.ax;
+        c->ay = s.ay;
+        c->rx = s.rx;
+        c->ry = s.ry;
+        c->brakeVal = s.brake;
+        c->throttleVal = s.throttle;
+        return true;
+    }
+    template <typename T>
+    static bool apply(T*, const InputPadState&, ...) { return false; }
+
+    static bool canApply() { return applySupported((Controller*)nullptr, 0); }
+
+private:
+    template <typename T>
+    static auto applySupported(T* c, int) -> decltype(c->buttonBits = 0, bool()) { return true; }
+    template <typename T>
+    static bool applySupported(T*, ...) { return false; }
+};
+
+class InputLog {
+public:
+    enum Mode : uint8_t { MODE_IDLE, MODE_ARMED_RECORD, MODE_RECORDING, MODE_ARMED_REPLAY, MODE_REPLAYING };
+
+    static constexpr uint32_t CAPACITY = INPUT_LOG_BYTES;
+    static constexpr uint8_t VERSION = 1;
+    static constexpr uint8_t HEADER_BYTES = 12;
+    static constexpr uint8_t PAD_BYTES = 17;
+    static constexpr uint8_t ANY_GAME = 0xFF;
+
+    Mode mode() const { return currentMode; }
+    bool isReplaying() const { return currentMode == MODE_REPLAYING; }
+
+    const uint8_t* data() const { return buf; }
+    uint32_t size() const { return len; }
+    uint8_t gameSlot() const { return len >= HEADER_BYTES ? buf[6] : ANY_GAME; }
+    uint32_t seed() const { return len >= HEADER_BYTES ? readU32(&buf[8]) : 0; }
+    bool overflowed() const { return overflow; }
+
+    /** Record the next game run started from the menu. */
+    void armRecording() {
+        currentMode = MODE_ARMED_RECORD;
+        len = 0;
+        overflow = false;
+    }
+
+    /**
+     * Load a log and replay it when the logged game (`gameSlot()`) is next started from
+     * the menu. Returns false if the data is not a valid log or replay is unsupported
+     * on this target.
+     */
+    bool armReplay(const uint8_t* data, uint32_t size) {
+        if (!PadStateIO::canApply()) return false;
+        if (!data || size < HEADER_BYTES || size > CAPACITY) return false;
+        if (memcmp(data, "SGIL", 4) != 0 || data[4] != VERSION || data[5] != MAX_GAMEPADS) return false;
+        memcpy(buf, data, size);
+        len = size;
+        currentMode = MODE_ARMED_REPLAY;
+        return true;
+    }
+
+    /** Stop recording / replay (the recorded bytes stay available). */
+    void stop() {
+        currentMode = MODE_IDLE;
+    }
+
+    /**
+     * Engine hook: called right before a game instance is created from the menu
+     * (so constructors and start() already draw from the seeded RNG).
+     */
+    void onGameStart(uint8_t slot, uint32_t nowMs) {
+        if (currentMode == MODE_ARMED_RECORD) {
+            const uint32_t s = freshSeed();
+            randomSeed(s);
+            len = 0;
+            memcpy(buf, "SGIL", 4);
+            buf[4] = VERSION;
+            buf[5] = MAX_GAMEPADS;
+            buf[6] = slot;
+            buf[7] = 0;
+            writeU32(&buf[8], s);
+            len = HEADER_BYTES;
+            startMs = lastRecordMs = nowMs;
+            hasPrev = false;
+            currentMode = MODE_RECORDING;
+        } else if (currentMode == MODE_ARMED_REPLAY && slot == gameSlot()) {
+            randomSeed(seed());
+            readPos = HEADER_BYTES;
+            startMs = lastRecordMs = nowMs;
+            replayMask = 0;
+            for (uint8_t i = 0; i < MAX_GAMEPADS; i++) replayPads[i] = InputPadState();
+            nextRecordMs = 0;
+            hasNext = readHeaderOfNextRecord();
+            currentMode = MODE_REPLAYING;
+        }
+    }
+
+    /** Engine hook: the game run ended (back to menu). */
+    void onGameEnd() {
+        if (currentMode == MODE_RECORDING || currentMode == MODE_REPLAYING) currentMode = MODE_IDLE;
+    }
+
+    /**
+     * Engine hook: once per tick, right after `acquireSnapshot()`.
+     * Recording: append the snapshot if it changed. Replay: overwrite the snapshot.
+     */
+    void tick(ControllerManager* input, uint32_t nowMs) {
+        if (!input) return;
+        if (currentMode == MODE_RECORDING) record(input, nowMs);
+        else if (currentMode == MODE_REPLAYING) replay(input, nowMs);
+    }
+
+    /** Hex dump of the log (device -> host transfer over serial). */
+    void dumpHex(Print& out) const {
+        out.print(F("[InputLog] bytes="));
+        out.println(len);
+        for (uint32_t i = 0; i < len; i++) {
+            if (buf[i] < 16) out.print('0');
+            out.print(buf[i], HEX);
+            if ((i % 32) == 31 || i + 1 == len) out.println();
+        }
+    }
+
+private:
+    uint8_t buf[CAPACITY];
+    uint32_t len = 0;
+    Mode currentMode = MODE_IDLE;
+    bool overflow = false;
+
+    uint32_t startMs = 0;
+    uint32_t lastRecordMs = 0;
+
+    // Recording
+    bool hasPrev = false;
+    uint8_t prevMask = 0;
+    InputPadState prevPads[MAX_GAMEPADS];
+
+    // Replay
+    uint32_t readPos = 0;
+    bool hasNext = false;
+    uint32_t nextRecordMs = 0;
+    uint8_t replayMask = 0;
+    InputPadState replayPads[MAX_GAMEPADS];
+
+    static uint32_t freshSeed() {
+        uint32_t s = (uint32_t)esp_random();
+        return s ? s : 1u;
+    }
+
+    static void writeU16(uint8_t* p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+    static void writeU32(uint8_t* p, uint32_t v) { for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i)); }
+    static uint16_t readU16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+    static uint32_t readU32(const uint8_t* p) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    static void encodePad(uint8_t* p, const InputPadState& s) {
+        p[0] = s.dpad;
+        writeU16(p + 1, s.buttons);
+        writeU16(p + 3, s.misc);
+        writeU16(p + 5, (uint16_t)s.ax);
+        writeU16(p + 7, (uint16_t)s.ay);
+        writeU16(p + 9, (uint16_t)s.rx);
+        writeU16(p + 11, (uint16_t)s.ry);
+        writeU16(p + 13, s.brake);
+        writeU16(p + 15, s.throttle);
+    }
+
+    static InputPadState decodePad(const uint8_t* p) {
+        InputPadState s;
+        s.dpad = p[0];
+        s.buttons = readU16(p + 1);
+        s.misc = readU16(p + 3);
+        s.ax = (int16_t)readU16(p + 5);
+        s.ay = (int16_t)readU16(p + 7);
+        s.rx = (int16_t)readU16(p + 9);
+        s.ry = (int16_t)readU16(p + 11);
+        s.brake = readU16(p + 13);
+        s.throttle = readU16(p + 15);
+        return s;
+    }
+
+    void record(ControllerManager* input, uint32_t nowMs) {
+        const uint8_t mask = input->snapshotPresentMask();
+        InputPadState pads[MAX_GAMEPADS];
+        uint8_t changed = 0;
+        for (uint8_t i = 0; i < MAX_GAMEPADS; i++) {
+            if (mask & (1u << i)) pads[i] = PadStateIO::capture(input->getController(i));
+            if (!hasPrev || pads[i] != prevPads[i]) changed |= (uint8_t)(1u << i);
+        }
+        if (hasPrev && changed == 0 && mask == prevMask) return;
+
+        // varint + masks + changed pads
+        uint8_t changedCount = 0;
+        for (uint8_t i = 0; i < MAX_GAMEPADS; i++) if (changed & (1u << i)) changedCount++;
+        const uint32_t need = 5 + 2 + (uint32_t)changedCount * PAD_BYTES;
+        if (len + need > CAPACITY) {
+            overflow = true;
+            currentMode = MODE_IDLE;
+            return;
+        }
+
+        uint32_t delta = nowMs - lastRecordMs;
+        lastRecordMs = nowMs;
+        do {
+            uint8_t b = (uint8_t)(delta & 0x7F);
+            delta >>= 7;
+            if (delta) b |= 0x80;
+            buf[len++] = b;
+        } while (delta);
+        buf[len++] = mask;
+        buf[len++] = changed;
+        for (uint8_t i = 0; i < MAX_GAMEPADS; i++) {
+            if (!(changed & (1u << i))) continue;
+            encodePad(&buf[len], pads[i]);
+            len += PAD_BYTES;
+            prevPads[i] = pads[i];
+        }
+        prevMask = mask;
+        hasPrev = true;
+    }
+
+    // Reads the varint time of the next record (cursor stays on its masks).
+    bool readHeaderOfNextRecord() {
+        uint32_t delta = 0;
+        uint8_t shift = 0;
+        while (readPos < len) {
+            const uint8_t b = buf[readPos++];
+            delta |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) {
+                nextRecordMs = lastRecordMs + delta;
+                lastRecordMs = nextRecordMs;
+                return readPos + 2 <= len;
+            }
+            shift += 7;
+            if (shift > 28) break;
+        }
+        return false;
+    }
+
+    void replay(ControllerManager* input, uint32_t nowMs) {
+        while (hasNext && (int32_t)(nowMs - nextRecordMs) >= 0) {
+            replayMask = buf[readPos++];
+            const uint8_t changed = buf[readPos++];
+            for (uint8_t i = 0; i < MAX_GAMEPADS; i++) {
+                if (!(changed & (1u << i))) continue;
+                if (readPos + PAD_BYTES > len) { hasNext = false; break; }
+                replayPads[i] = decodePad(&buf[readPos]);
+                readPos += PAD_BYTES;
+            }
+            if (hasNext) hasNext = readHeaderOfNextRecord();
+        }
+
+        // Re-apply every tick: acquireSnapshot() may have swapped in a fresh live snapshot.
+        // After the last record the final logged state is held until the game ends.
+        input->setSnapshotPresentMask(replayMask);
+        for (uint8_t i = 0; i < MAX_GAMEPADS; i++) {
+            if (replayMask & (1u << i)) PadStateIO::apply(input->snapshotPad(i), replayPads[i], 0);
+        }
+    }
+};
@@ -0,0 +1,111 @@
+#include "InputTracker.h"
+
+InputTracker globalInput;
+
+namespace {
+// Bluepad32 API surface varies by version/controller; bind whatever exists.
+struct StartButton {
+    template <typename T>
+    static auto miscButtons(T* c, int) -> decltype(c->miscButtons(), uint16_t()) { return (uint16_t)c->miscButtons(); }
+    template <typename T>
+    static uint16_t miscButtons(T*, ...) { return 0; }
+
+    template <typename T>
+    static auto start(T* c, int) -> decltype(c->start(), bool()) { return (bool)c->start(); }
+    template <typename T>
+    static bool start(T*, ...) { return false; }
+};
+} // namespace
+
+InputTracker::InputTracker() : tickMs(0), prevTickMs(0), lockUntilMs(0) {
+    for (int p = 0; p < MAX_GAMEPADS; p++) {
+        pads[p].downBits = 0;
+        pads[p].pressedBits = 0;
+        pads[p].releasedBits = 0;
+        for (int b = 0; b < BTN_COUNT; b++) pads[p].downSinceMs[b] = 0;
+    }
+}
+
+bool InputTracker::isStartDown(ControllerPtr ctl) {
+    if (!ctl) return false;
+    // Prefer a dedicated start() accessor if present.
+    if (StartButton::start(ctl, 0)) return true;
+    // Otherwise fall back to miscButtons() bitmask (Bluepad32: START is 0x04).
+    return (StartButton::miscButtons(ctl, 0) & 0x04) != 0;
+}
+
+uint16_t InputTracker::sample(ControllerPtr ctl) {
+    if (!ctl) return 0;
+    const uint8_t dpad = ctl->dpad();
+    uint16_t bits = 0;
+    if (ctl->a()) bits |= bit(BTN_A);
+    if (ctl->b()) bits |= bit(BTN_B);
+    if (ctl->x()) bits |= bit(BTN_X);
+    if (ctl->y()) bits |= bit(BTN_Y);
+    if (isStartDown(ctl)) bits |= bit(BTN_START);
+    if (dpad & 0x01) bits |= bit(BTN_UP);
+    if (dpad & 0x02) bits |= bit(BTN_DOWN);
+    if (dpad & 0x04) bits |= bit(BTN_RIGHT);
+    if (dpad & 0x08) bits |= bit(BTN_LEFT);
+    return bits;
+}
+
+void InputTracker::update(ControllerManager* input, uint32_t nowMs) {
+    prevTickMs = tickMs;
+    tickMs = nowMs;
+    const bool locked = lockedOut();
+    for (int p = 0; p < MAX_GAMEPADS; p++) {
+        PadState& s = pads[p];
+        const uint16_t now = sample(input ? input->getController(p) : nullptr);
+        const uint16_t went = (uint16_t)(now & ~s.downBits);
+        s.releasedBits = (uint16_t)(s.downBits & ~now);
+        s.pressedBits = locked ? 0 : went;
+        s.downBits = now;
+        // A press swallowed by a lockout never starts a hold (0), so it cannot repeat
+        // later either: it has to be released and pressed again.
+        for (int b = 0; b < BTN_COUNT; b++) {
+            if (went & bit((Button)b)) s.downSinceMs[b] = locked ? 0 : nowMs;
+        }
+    }
+}
+
+bool InputTracker::down(uint8_t pad, Button b) const {
+    return pad < MAX_GAMEPADS && (pads[pad].downBits & bit(b)) != 0;
+}
+
+bool InputTracker::pressed(uint8_t pad, Button b) const {
+    return pad < MAX_GAMEPADS && (pads[pad].pressedBits & bit(b)) != 0;
+}
+
+bool InputTracker::released(uint8_t pad, Button b) const {
+    return pad < MAX_GAMEPADS && (pads[pad].releasedBits & bit(b)) != 0;
+}
+
+uint32_t InputTracker::heldMs(uint8_t pad, Button b) const {
+    if (!down(pad, b) || pads[pad].downSinceMs[b] == 0) return 0;
+    return (uint32_t)(tickMs - pads[pad].downSinceMs[b]);
+}
+
+bool InputTracker::repeat(uint8_t pad, Button b, uint16_t delayMs, uint16_t intervalMs) const {
+    if (pressed(pad, b)) return true;
+    if (!down(pad, b) || lockedOut() || pads[pad].downSinceMs[b] == 0) return false;
+    const uint32_t since = pads[pad].downSinceMs[b];
+    const uint32_t held = (uint32_t)(tickMs - since);
+    const uint32_t heldBefore = (uint32_t)(prevTickMs - since);
+    if (held < delayMs) return false;
+    if (heldBefore < delayMs) return true;
+    if (intervalMs == 0) return true;
+    return (held - delayMs) / intervalMs != (heldBefore - delayMs) / intervalMs;
+}
+
+int8_t InputTracker::firstPadPressed(Button b) const {
+    for (uint8_t p = 0; p < MAX_GAMEPADS; p++) {
+        if (pressed(p, b)) return (int8_t)p;
+    }
+    return NO_PAD;
+}
+
+void InputTracker::lockout(uint16_t ms) {
+    const uint32_t until = tickMs + ms;
+    if ((int32_t)(until - lockUntilMs) > 0) lockUntilMs = until;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <Arduino.h>
+#include <Bluepad32.h>
+#include "config.h"
+#include "ControllerManager.h"
+
+/**
+ * InputTracker
+ * ------------
+ * Per-pad, per-button edge / hold / auto-repeat state for UI and engine flow, updated once
+ * per engine tick from the input snapshot (after any input-log replay override).
+ *
+ * Replaces `delay()` debounces and function-local "last pressed" statics:
+ * - `pressed()` is true on the tick a button goes down, for every caller in that tick
+ *   (callers no longer "consume" each other's edges).
+ * - `repeat()` adds hold-to-repeat on top of the press edge (menus, value adjusters).
+ * - `lockout(ms)` suppresses new presses for a window after a screen change, instead of
+ *   freezing the whole loop. A button held across the window does not fire when it ends;
+ *   it has to be released and pressed again.
+ *
+ * Engine side only (not thread-safe); games keep reading their controllers directly.
+ */
+class InputTracker {
+public:
+    enum Button : uint8_t {
+        BTN_A, BTN_B, BTN_X, BTN_Y, BTN_START,
+        BTN_UP, BTN_DOWN, BTN_LEFT, BTN_RIGHT,
+        BTN_COUNT
+    };
+
+    static constexpr int8_t NO_PAD = -1;
+
+    InputTracker();
+
+    /** Sample all pads (call once per engine tick, right after the snapshot is final). */
+    void update(ControllerManager* input, uint32_t nowMs);
+
+    /** Level state. */
+    bool down(uint8_t pad, Button b) const;
+    /** Went down this tick (and not inside a lockout window). */
+    bool pressed(uint8_t pad, Button b) const;
+    /** Went up this tick. */
+    bool released(uint8_t pad, Button b) const;
+    /** How long the button has been held (0 if up). */
+    uint32_t heldMs(uint8_t pad, Button b) const;
+    /**
+     * Press edge, then again every `intervalMs` once held for `delayMs`.
+     * Stateless for the caller: any number of screens can query the same button.
+     */
+    bool repeat(uint8_t pad, Button b, uint16_t delayMs, uint16_t intervalMs) const;
+
+    /** First pad whose button went down this tick, or NO_PAD. */
+    int8_t firstPadPressed(Button b) const;
+
+    /** Ignore new presses on all pads for `ms` (screen transitions, confirm carry-over). */
+    void lockout(uint16_t ms);
+    bool lockedOut() const { return (int32_t)(lockUntilMs - tickMs) > 0; }
+
+    /** START, whichever way the controller reports it. */
+    static bool isStartDown(ControllerPtr ctl);
+
+private:
+    struct PadState {
+        uint16_t downBits;
+        uint16_t pressedBits;
+        uint16_t releasedBits;
+        uint32_t downSinceMs[BTN_COUNT];
+    };
+
+    PadState pads[MAX_GAMEPADS];
+    uint32_t tickMs;
+    uint32_t prevTickMs;
+    uint32_t lockUntilMs;
+
+    static uint16_t sample(ControllerPtr ctl);
+    static uint16_t bit(Button b) { return (uint16_t)(1u << b); }
+};
+
+extern InputTracker globalInput;
@@ -0,0 +1,110 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+#include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
+#include "config.h"
+#include "FixedPoint.h"
+
+/**
+ * ParticleSystem
+ * --------------
+ * Shared spark / debris particles (Shooter, Breakout, Tetris).
+ *
+ * - Structure of arrays (x, y, vx, vy, color, endMs) with a dense live range
+ *   [0, count()): spawn appends, expiry swap-removes. Spawn is O(1) and update / draw
+ *   touch only live particles, so cost follows what is on screen, not the pool size.
+ * - Motion is Q16.16 fixed point (engine/FixedPoint.h): per tick
+ *   `pos += vel; vel *= drag; vy += gravity`, one pass per array.
+ * - `Capacity` is the game's budget (its `*Config.h`). When the pool is full, `spawn()`
+ *   returns false and the live particles are never evicted; emitters check `full()` to
+ *   stop early (no random() calls spent on particles that would not fit).
+ */
+template <uint16_t Capacity>
+class ParticleSystem {
+public:
+    static constexpr uint16_t CAPACITY = Capacity;
+
+    /** Per-game motion and clipping. Drawing skips pixels outside [clipX0, clipX1) x [clipY0, clipY1). */
+    struct Params {
+        Fixed::q16 drag = Fixed::ONE;
+        Fixed::q16 gravity = 0;
+        int16_t clipX0 = 0;
+        int16_t clipY0 = 0;
+        int16_t clipX1 = PANEL_RES_X;
+        int16_t clipY1 = PANEL_RES_Y;
+    };
+
+    ParticleSystem() = default;
+    explicit ParticleSystem(const Params& p) : params(p) {}
+
+    void setParams(const Params& p) { params = p; }
+
+    void clear() { live = 0; }
+    uint16_t count() const { return live; }
+    bool full() const { return live >= Capacity; }
+
+    /** Add one particle; false when the budget is full. */
+    bool spawn(Fixed::q16 px, Fixed::q16 py, Fixed::q16 pvx, Fixed::q16 pvy, uint16_t c, uint32_t end) {
+        if (live >= Capacity) return false;
+        const uint16_t i = live++;
+        x[i] = px;
+        y[i] = py;
+        vx[i] = pvx;
+        vy[i] = pvy;
+        color[i] = c;
+        endMs[i] = end;
+        return true;
+    }
+
+    /** Expire finished particles, then integrate the survivors one tick. */
+    void update(uint32_t now) {
+        for (uint16_t i = 0; i < live;) {
+            if ((int32_t)(endMs[i] - now) <= 0) removeAt(i);
+            else i++;
+        }
+        const uint16_t n = live;
+        for (uint16_t i = 0; i < n; i++) x[i] += vx[i];
+        for (uint16_t i = 0; i < n; i++) y[i] += vy[i];
+        if (params.drag != Fixed::ONE) {
+            for (uint16_t i = 0; i < n; i++) vx[i] = Fixed::mul(vx[i], params.drag);
+            for (uint16_t i = 0; i < n; i++) vy[i] = Fixed::mul(vy[i], params.drag);
+        }
+        if (params.gravity != 0) {
+            for (uint16_t i = 0; i < n; i++) vy[i] += params.gravity;
+        }
+    }
+
+    /** One pixel per live particle (already expired ones are skipped). */
+    void draw(MatrixPanel_I2S_DMA* display, uint32_t now) const {
+        if (!display) return;
+        for (uint16_t i = 0; i < live; i++) {
+            if ((int32_t)(endMs[i] - now) <= 0) continue;
+            const int px = Fixed::toInt(x[i]);
+            const int py = Fixed::toInt(y[i]);
+            if (px < params.clipX0 || px >= params.clipX1 || py < params.clipY0 || py >= params.clipY1) continue;
+            display->drawPixel((int16_t)px, (int16_t)py, color[i]);
+        }
+    }
+
+private:
+    Params params;
+    uint16_t live = 0;
+
+    Fixed::q16 x[Capacity];
+    Fixed::q16 y[Capacity];
+    Fixed::q16 vx[Capacity];
+    Fixed::q16 vy[Capacity];
+    uint16_t color[Capacity];
+    uint32_t endMs[Capacity];
+
+    void removeAt(uint16_t i) {
+        const uint16_t last = --live;
+        if (i == last) return;
+        x[i] = x[last];
+        y[i] = y[last];
+        vx[i] = vx[last];
+        vy[i] = vy[last];
+        color[i] = color[last];
+        endMs[i] = endMs[last];
+    }
+};
@@ -0,0 +1,165 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+#include "config.h"
+
+/**
+ * Pool
+ * ----
+ * Fixed-capacity object pool for game entities (bullets, enemies, pickups, bricks, ...).
+ *
+ * - Objects live in `N` stable slots (addresses never move while live) and are handed
+ *   out from a free-list stack: `acquire()` / `release()` are O(1).
+ * - Live objects are also listed densely, so loops visit `size()` entries instead of
+ *   all `N` slots: `pool[k]` for k in [0, size()).
+ * - `release()` swap-removes from the dense list. To release while iterating, walk it
+ *   backwards (`for (uint16_t k = pool.size(); k-- > 0;)`); releasing the current entry
+ *   is then safe.
+ * - `Handle` = slot + generation: `get(h)` returns nullptr once the object was released,
+ *   even if the slot was reused (safe "target" references, e.g. homing rockets).
+ * - A full pool makes `acquire()` return nullptr and counts the failure; `failures()`
+ *   and `highWater()` tell how big the pool really needs to be (`DEBUG_POOLS` logs them).
+ *
+ * `acquire()` returns the slot as it was left; callers initialize every field.
+ */
+template <typename T, uint16_t N>
+class Pool {
+public:
+    static constexpr uint16_t CAPACITY = N;
+
+    struct Handle {
+        uint16_t slot;
+        uint16_t gen;
+    };
+    static Handle noHandle() { return Handle{ 0xFFFF, 0 }; }
+
+    Pool() { clear(); }
+
+    /** Release everything (stats are kept; see `resetStats()`). */
+    void clear() {
+        live = 0;
+        for (uint16_t i = 0; i < N; i++) {
+            freeSlots[i] = (uint16_t)(N - 1 - i); // slot 0 is handed out first
+            densePos[i] = NOT_LIVE;
+            gen[i]++;
+        }
+        freeCount = N;
+    }
+
+    /** A free object, or nullptr (counted in `failures()`) when the pool is full. */
+    T* acquire() {
+        if (freeCount == 0) {
+            failCount++;
+            return nullptr;
+        }
+        const uint16_t slot = freeSlots[--freeCount];
+        densePos[slot] = live;
+        dense[live++] = slot;
+        if (live > peak) peak = live;
+        return &slots[slot];
+    }
+
+    void release(const T* item) {
+        const uint16_t slot = slotOf(item);
+        if (slot >= N || densePos[slot] == NOT_LIVE) return;
+        const uint16_t pos = densePos[slot];
+        const uint16_t last = dense[--live];
+        dense[pos] = last;
+        densePos[last] = pos;
+        densePos[slot] = NOT_LIVE;
+        gen[slot]++;
+        freeSlots[freeCount++] = slot;
+    }
+
+    /** Release the k-th live object (dense index). */
+    void releaseAt(uint16_t k) {
+        if (k < live) release(&slots[dense[k]]);
+    }
+
+    // -----------------------------------------------------
+    // Dense iteration
+    // -----------------------------------------------------
+    uint16_t size() const { return live; }
+    bool empty() const { return live == 0; }
+    bool full() const { return freeCount == 0; }
+
+    T& operator[](uint16_t k) { return slots[dense[k]]; }
+    const T& operator[](uint16_t k) const { return slots[dense[k]]; }
+
+    bool isLive(const T* item) const {
+        const uint16_t slot = slotOf(item);
+        return slot < N && densePos[slot] != NOT_LIVE;
+    }
+
+    /** Dense index of a live object (N when it is not live). */
+    uint16_t indexOf(const T* item) const {
+        const uint16_t slot = slotOf(item);
+        return (slot < N && densePos[slot] != NOT_LIVE) ? densePos[slot] : N;
+    }
+
+    // -----------------------------------------------------
+    // Slots (stable ids, e.g. for spatial grids)
+    // -----------------------------------------------------
+    /** Slot of an object from this pool (N for foreign pointers); stable while it is live. */
+    uint16_t slotIndex(const T* item) const {
+        const uint16_t slot = slotOf(item);
+        return (slot < N) ? slot : N;
+    }
+
+    /** The live object in `slot`, or nullptr. */
+    T* atSlot(uint16_t slot) {
+        if (slot >= N || densePos[slot] == NOT_LIVE) return nullptr;
+        return &slots[slot];
+    }
+
+    // -----------------------------------------------------
+    // Handles
+    // -----------------------------------------------------
+    Handle handleOf(const T* item) const {
+        const uint16_t slot = slotOf(item);
+        if (slot >= N || densePos[slot] == NOT_LIVE) return noHandle();
+        return Handle{ slot, gen[slot] };
+    }
+
+    T* get(Handle h) {
+        if (h.slot >= N || densePos[h.slot] == NOT_LIVE || gen[h.slot] != h.gen) return nullptr;
+        return &slots[h.slot];
+    }
+
+    // -----------------------------------------------------
+    // Telemetry
+    // -----------------------------------------------------
+    uint32_t failures() const { return failCount; }
+    uint16_t highWater() const { return peak; }
+    void resetStats() {
+        failCount = 0;
+        peak = live;
+    }
+
+    void logStats(const char* name) const {
+#if DEBUG_POOLS
+        Serial.printf("[Pool] %s: cap=%u peak=%u live=%u failures=%lu\n",
+                      name, (unsigned)N, (unsigned)peak, (unsigned)live, (unsigned long)failCount);
+#else
+        (void)name;
+#endif
+    }
+
+private:
+    static constexpr uint16_t NOT_LIVE = 0xFFFF;
+
+    T slots[N] = {};
+    uint16_t dense[N];
+    uint16_t densePos[N];
+    uint16_t freeSlots[N];
+    uint16_t gen[N] = {};
+    uint16_t live = 0;
+    uint16_t freeCount = 0;
+    uint16_t peak = 0;
+    uint32_t failCount = 0;
+
+    uint16_t slotOf(const T* item) const {
+        if (item < slots || item >= slots + N) return NOT_LIVE;
+        return (uint16_t)(item - slots);
+    }
+};
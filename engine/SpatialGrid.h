@@ -0,0 +1,61 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+#include <string.h>
+#include "config.h"
+
+/**
+ * SpatialGrid
+ * -----------
+ * Uniform broadphase grid over the playfield for point-vs-box tests (projectiles vs targets).
+ *
+ * - Cells are `1 << CellShift` px square. Each cell holds a bitmask of the item ids
+ *   (0..31, e.g. pool slot indices) whose box overlaps it; `query()` returns the mask of
+ *   the point's cell.
+ * - Boxes and query points are clamped into the grid, so items partly (or fully) off the
+ *   field sit in the border cells: a point inside an item's box always gets that item
+ *   back as a candidate.
+ * - Candidates are a superset; callers still run their exact test on each one.
+ */
+template <uint8_t CellShift, uint16_t Width = PANEL_RES_X, uint16_t Height = PANEL_RES_Y>
+class SpatialGrid {
+public:
+    typedef uint32_t Mask;
+    static constexpr uint8_t MAX_ITEMS = 32;
+    static constexpr uint16_t COLS = (uint16_t)((Width + (1u << CellShift) - 1) >> CellShift);
+    static constexpr uint16_t ROWS = (uint16_t)((Height + (1u << CellShift) - 1) >> CellShift);
+
+    SpatialGrid() { clear(); }
+
+    void clear() { memset(cells, 0, sizeof(cells)); }
+
+    /** Add item `id` (< MAX_ITEMS) with the box [x, x + w) x [y, y + h). */
+    void insert(uint8_t id, int x, int y, int w, int h) {
+        if (id >= MAX_ITEMS || w <= 0 || h <= 0) return;
+        const uint16_t c0 = colOf(x);
+        const uint16_t c1 = colOf(x + w - 1);
+        const uint16_t r0 = rowOf(y);
+        const uint16_t r1 = rowOf(y + h - 1);
+        const Mask bit = (Mask)1 << id;
+        for (uint16_t r = r0; r <= r1; r++) {
+            for (uint16_t c = c0; c <= c1; c++) cells[r][c] |= bit;
+        }
+    }
+
+    /** Ids whose boxes may contain (x, y). */
+    Mask query(int x, int y) const { return cells[rowOf(y)][colOf(x)]; }
+
+private:
+    Mask cells[ROWS][COLS];
+
+    static uint16_t colOf(int x) {
+        if (x < 0) return 0;
+        if (x >= (int)Width) return (uint16_t)(COLS - 1);
+        return (uint16_t)((unsigned)x >> CellShift);
+    }
+    static uint16_t rowOf(int y) {
+        if (y < 0) return 0;
+        if (y >= (int)Height) return (uint16_t)(ROWS - 1);
+        return (uint16_t)((unsigned)y >> CellShift);
+    }
+};
@@ -0,0 +1,205 @@
+#pragma once
+#include <Arduino.h>
+#include <stddef.h>
+#include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
+#include "config.h"
+
+/**
+ * SpriteBlit
+ * ----------
+ * Index-map sprites (0 = transparent, 1..3 = palette slot) compiled at build time into
+ * horizontal opaque runs, then drawn with one `drawFastHLine` per run instead of one
+ * `drawPixel` per pixel.
+ *
+ * - `SpanSheet<Frames, Runs>`: every frame of a sprite table in one flat run array
+ *   (4 bytes per run) plus a per-frame run range and w×h box. Build it with
+ *   `compile<countRuns(table)>(table)`; both are constexpr, so the sheet is a flash constant.
+ *   Tables that only use the top-left part of each grid pass per-frame widths/heights.
+ * - `blit()`: the palette is resolved once per call (optionally scaled by `brightness`),
+ *   then each run is clipped against a rectangle (default: the whole panel).
+ *   FLIP_X / FLIP_Y mirror inside the frame's w×h box.
+ *
+ * A run ends wherever the palette slot changes, so an outlined sprite costs a few spans
+ * per row and a solid one costs one.
+ */
+namespace SpriteBlit {
+
+static constexpr uint8_t PALETTE_SIZE = 4;  // slot 0 is transparent
+static constexpr uint8_t SLOT_MASK = 3;
+
+static constexpr uint8_t FLIP_X = 0x01;
+static constexpr uint8_t FLIP_Y = 0x02;
+
+struct Run {
+    uint8_t y;
+    uint8_t x;
+    uint8_t len;
+    uint8_t slot;   // 1..3
+};
+
+struct Frame {
+    uint16_t first; // index into the sheet's runs
+    uint16_t count;
+    uint8_t w;
+    uint8_t h;
+};
+
+template <size_t Frames, size_t Runs>
+struct SpanSheet {
+    static constexpr size_t FRAME_COUNT = Frames;
+    static constexpr size_t RUN_COUNT = Runs;
+
+    Frame frames[Frames];
+    Run runs[Runs > 0 ? Runs : 1];
+};
+
+/** Half-open clip box: x0 <= x < x1, y0 <= y < y1. */
+struct ClipRect {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+};
+
+static constexpr ClipRect PANEL_CLIP = { 0, 0, (int16_t)(PANEL_RES_X * PANEL_CHAIN), (int16_t)PANEL_RES_Y };
+
+// ---------------------------------------------------------
+// Compile step (constexpr)
+// ---------------------------------------------------------
+
+template <size_t H, size_t W>
+constexpr uint16_t countFrameRuns(const uint8_t (&grid)[H][W], size_t w, size_t h) {
+    uint16_t n = 0;
+    for (size_t y = 0; y < h && y < H; y++) {
+        uint8_t prev = 0;
+        for (size_t x = 0; x < w && x < W; x++) {
+            const uint8_t s = (uint8_t)(grid[y][x] & SLOT_MASK);
+            if (s != 0 && s != prev) n++;
+            prev = s;
+        }
+    }
+    return n;
+}
+
+template <size_t H, size_t W>
+constexpr uint16_t emitFrameRuns(const uint8_t (&grid)[H][W], size_t w, size_t h, Run* out) {
+    uint16_t n = 0;
+    for (size_t y = 0; y < h && y < H; y++) {
+        size_t x = 0;
+        while (x < w && x < W) {
+            const uint8_t s = (uint8_t)(grid[y][x] & SLOT_MASK);
+            size_t end = x + 1;
+            while (end < w && end < W && (uint8_t)(grid[y][end] & SLOT_MASK) == s) end++;
+            if (s != 0) out[n++] = Run{ (uint8_t)y, (uint8_t)x, (uint8_t)(end - x), s };
+            x = end;
+        }
+    }
+    return n;
+}
+
+/** Run count of a single sprite / a sprite table (sizes the sheet). */
+template <size_t H, size_t W>
+constexpr size_t countRuns(const uint8_t (&grid)[H][W]) {
+    return countFrameRuns(grid, W, H);
+}
+
+template <size_t N, size_t H, size_t W>
+constexpr size_t countRuns(const uint8_t (&table)[N][H][W]) {
+    size_t n = 0;
+    for (size_t i = 0; i < N; i++) n += countFrameRuns(table[i], W, H);
+    return n;
+}
+
+template <size_t N, size_t H, size_t W>
+constexpr size_t countRuns(const uint8_t (&table)[N][H][W], const uint8_t (&ws)[N], const uint8_t (&hs)[N]) {
+    size_t n = 0;
+    for (size_t i = 0; i < N; i++) n += countFrameRuns(table[i], ws[i], hs[i]);
+    return n;
+}
+
+/** Single sprite -> one-frame sheet. */
+template <size_t Runs, size_t H, size_t W>
+constexpr SpanSheet<1, Runs> compile(const uint8_t (&grid)[H][W]) {
+    SpanSheet<1, Runs> sheet{};
+    sheet.frames[0] = Frame{ 0, emitFrameRuns(grid, W, H, sheet.runs), (uint8_t)W, (uint8_t)H };
+    return sheet;
+}
+
+/** Sprite table -> sheet with one frame per table entry. */
+template <size_t Runs, size_t N, size_t H, size_t W>
+constexpr SpanSheet<N, Runs> compile(const uint8_t (&table)[N][H][W]) {
+    SpanSheet<N, Runs> sheet{};
+    uint16_t at = 0;
+    for (size_t i = 0; i < N; i++) {
+        const uint16_t n = emitFrameRuns(table[i], W, H, sheet.runs + at);
+        sheet.frames[i] = Frame{ at, n, (uint8_t)W, (uint8_t)H };
+        at = (uint16_t)(at + n);
+    }
+    return sheet;
+}
+
+/** Sprite table whose entries use only the top-left ws[i]×hs[i] of each grid. */
+template <size_t Runs, size_t N, size_t H, size_t W>
+constexpr SpanSheet<N, Runs> compile(const uint8_t (&table)[N][H][W], const uint8_t (&ws)[N], const uint8_t (&hs)[N]) {
+    SpanSheet<N, Runs> sheet{};
+    uint16_t at = 0;
+    for (size_t i = 0; i < N; i++) {
+        const uint16_t n = emitFrameRuns(table[i], ws[i], hs[i], sheet.runs + at);
+        sheet.frames[i] = Frame{ at, n, ws[i], hs[i] };
+        at = (uint16_t)(at + n);
+    }
+    return sheet;
+}
+
+// ---------------------------------------------------------
+// Blitter
+// ---------------------------------------------------------
+
+/** RGB565 channel scale, mul 0..255 (255 = unchanged). */
+static inline uint16_t scale565(uint16_t c, uint8_t mul) {
+    if (mul == 255) return c;
+    const uint16_t r = (uint16_t)((((c >> 11) & 0x1F) * mul) / 255);
+    const uint16_t g = (uint16_t)((((c >> 5) & 0x3F) * mul) / 255);
+    const uint16_t b = (uint16_t)(((c & 0x1F) * mul) / 255);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static inline void blitRuns(MatrixPanel_I2S_DMA* display, const Frame& f, const Run* runs,
+                            int x, int y, const uint16_t (&palette)[PALETTE_SIZE],
+                            uint8_t flags, uint8_t brightness, const ClipRect& clip) {
+    if (!display) return;
+    // Whole-frame reject before touching any run.
+    if (x >= clip.x1 || y >= clip.y1 || x + (int)f.w <= clip.x0 || y + (int)f.h <= clip.y0) return;
+
+    uint16_t pal[PALETTE_SIZE];
+    pal[0] = 0;
+    for (uint8_t s = 1; s < PALETTE_SIZE; s++) pal[s] = scale565(palette[s], brightness);
+
+    const bool flipX = (flags & FLIP_X) != 0;
+    const bool flipY = (flags & FLIP_Y) != 0;
+    for (uint16_t i = 0; i < f.count; i++) {
+        const Run& r = runs[f.first + i];
+        const int py = y + (flipY ? ((int)f.h - 1 - (int)r.y) : (int)r.y);
+        if (py < clip.y0 || py >= clip.y1) continue;
+        int x0 = x + (flipX ? ((int)f.w - (int)r.x - (int)r.len) : (int)r.x);
+        int x1 = x0 + (int)r.len;
+        if (x0 < clip.x0) x0 = clip.x0;
+        if (x1 > clip.x1) x1 = clip.x1;
+        if (x0 >= x1) continue;
+        display->drawFastHLine((int16_t)x0, (int16_t)py, (int16_t)(x1 - x0), pal[r.slot]);
+    }
+}
+
+/**
+ * Draw `frame` of `sheet` with its top-left at (x, y).
+ * `palette[1..3]` are the colors for slots 1..3 (`palette[0]` is ignored).
+ */
+template <size_t Frames, size_t Runs>
+static inline void blit(MatrixPanel_I2S_DMA* display, const SpanSheet<Frames, Runs>& sheet, size_t frame,
+                        int x, int y, const uint16_t (&palette)[PALETTE_SIZE],
+                        uint8_t flags = 0, uint8_t brightness = 255, const ClipRect& clip = PANEL_CLIP) {
+    if (frame >= Frames) return;
+    blitRuns(display, sheet.frames[frame], sheet.runs, x, y, palette, flags, brightness, clip);
+}
+
+} // namespace SpriteBlit
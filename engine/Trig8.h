@@ -0,0 +1,110 @@
+#pragma once
+#include <Arduino.h>
+#include <stdint.h>
+
+/**
+ * Trig8
+ * -----
+ * 256-step angles (`Angle`, one full turn = 256, wraps for free in a uint8_t) with a
+ * constexpr sine table in Q14 (16384 = 1.0) and an integer atan2.
+ *
+ * Why: `cosf/sinf/atan2f` per frame are slow on the ESP32 and not bit-exact across
+ * toolchains; table lookups are cheap and identical on device and host (replays).
+ *
+ * Angle convention matches screen coordinates (+Y down): 0 = right, 64 = down,
+ * 128 = left, 192 = up.
+ */
+namespace Trig8 {
+
+typedef uint8_t Angle;
+
+static constexpr int32_t ONE = 16384; // Q14
+static constexpr uint8_t Q = 14;
+
+static constexpr Angle RIGHT = 0;
+static constexpr Angle DOWN = 64;
+static constexpr Angle LEFT = 128;
+static constexpr Angle UP = 192;
+
+namespace detail {
+// Taylor series on [0, pi/2] (compile time only).
+constexpr double sinQuarter(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 12; n++) {
+        term *= -x * x / (double)((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+struct SinTable {
+    int16_t v[256];
+};
+
+constexpr SinTable buildSinTable() {
+    SinTable t{};
+    const double step = 6.283185307179586 / 256.0;
+    for (int i = 0; i < 256; i++) {
+        const int q = i & 63;
+        const int quadrant = i >> 6;
+        // Mirror into the first quadrant.
+        const int k = (quadrant & 1) ? (64 - q) : q;
+        const double s = sinQuarter((double)k * step);
+        const double scaled = s * (double)ONE;
+        const int r = (int)(scaled + 0.5);
+        t.v[i] = (int16_t)((quadrant & 2) ? -r : r);
+    }
+    return t;
+}
+} // namespace detail
+
+static constexpr detail::SinTable SIN_TABLE = detail::buildSinTable();
+
+/** sin / cos in Q14. */
+static constexpr int16_t sinQ14(Angle a) { return SIN_TABLE.v[a]; }
+static constexpr int16_t cosQ14(Angle a) { return SIN_TABLE.v[(uint8_t)(a + 64)]; }
+
+/** Float views for code that still integrates in float. */
+static inline float sinF(Angle a) { return (float)sinQ14(a) * (1.0f / (float)ONE); }
+static inline float cosF(Angle a) { return (float)cosQ14(a) * (1.0f / (float)ONE); }
+
+/** `r * cos(a)` / `r * sin(a)` for an integer radius, in Q`shift` (default: whole pixels ×256). */
+static constexpr int32_t cosMul(Angle a, int32_t r, uint8_t shift = 8) { return (cosQ14(a) * r) >> (Q - shift); }
+static constexpr int32_t sinMul(Angle a, int32_t r, uint8_t shift = 8) { return (sinQ14(a) * r) >> (Q - shift); }
+
+/** Nearest 256-step angle of the vector (x, y); (0, 0) gives 0. Integer only. */
+static inline Angle atan2(int32_t y, int32_t x) {
+    if (x == 0 && y == 0) return 0;
+    const int64_t ax = (x < 0) ? -(int64_t)x : (int64_t)x;
+    const int64_t ay = (y < 0) ? -(int64_t)y : (int64_t)y;
+
+    // First quadrant: f(a) = sin(a)*ax - cos(a)*ay grows with a and crosses 0 at the
+    // vector's angle. Find the first a in [0, 64] with f(a) >= 0, then pick the nearer
+    // of a and a-1.
+    uint8_t lo = 0;
+    uint8_t hi = 64;
+    while (lo < hi) {
+        const uint8_t mid = (uint8_t)((lo + hi) >> 1);
+        const int64_t f = (int64_t)sinQ14(mid) * ax - (int64_t)cosQ14(mid) * ay;
+        if (f >= 0) hi = mid;
+        else lo = (uint8_t)(mid + 1);
+    }
+    uint8_t a = lo;
+    if (a > 0) {
+        const int64_t fa = (int64_t)sinQ14(a) * ax - (int64_t)cosQ14(a) * ay;
+        const int64_t fb = (int64_t)cosQ14((Angle)(a - 1)) * ay - (int64_t)sinQ14((Angle)(a - 1)) * ax;
+        if (fb < fa) a--;
+    }
+
+    if (x >= 0) return (Angle)((y >= 0) ? a : (256 - a));
+    return (Angle)((y >= 0) ? (128 - a) : (128 + a));
+}
+
+/** Radians -> nearest 256-step angle (for setup code and tuning constants). */
+static inline Angle fromRadians(float rad) {
+    const float turns = rad * (256.0f / 6.28318531f);
+    return (Angle)(int32_t)lroundf(turns);
+}
+
+} // namespace Trig8
@@ -0,0 +1,113 @@
+#pragma once
+#include <Arduino.h>
+#include <stdlib.h>
+#include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
+#include "config.h"
+
+/**
+ * VectorRaster
+ * ------------
+ * Integer Bresenham lines for vector-style games, drawn inside a wrapping playfield:
+ * a line that leaves one edge continues at the opposite one (objects straddling the
+ * wrap seam are drawn on both sides instead of being clipped).
+ *
+ * - Same pixel walk as Adafruit_GFX `writeLine()` (identical pixels when nothing wraps).
+ * - Endpoints may lie outside the field; every pixel is folded back into
+ *   [x0, x1) × [y0, y1) of the `WrapField`.
+ * - Horizontal steps on the same row are merged into one `drawFastHLine` span.
+ */
+namespace VectorRaster {
+
+/** Wrapping playfield, half-open: x0 <= x < x1, y0 <= y < y1. */
+struct WrapField {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+};
+
+static constexpr WrapField PANEL_FIELD = { 0, 0, (int16_t)(PANEL_RES_X * PANEL_CHAIN), (int16_t)PANEL_RES_Y };
+
+static inline int wrapInto(int v, int lo, int hi) {
+    const int span = hi - lo;
+    int r = (v - lo) % span;
+    if (r < 0) r += span;
+    return lo + r;
+}
+
+namespace detail {
+// Collects consecutive pixels of one row into a span.
+struct SpanWriter {
+    MatrixPanel_I2S_DMA* display;
+    const WrapField& field;
+    uint16_t color;
+    int runX = 0;
+    int runY = 0;
+    int runLen = 0;
+
+    SpanWriter(MatrixPanel_I2S_DMA* d, const WrapField& f, uint16_t c) : display(d), field(f), color(c) {}
+
+    void flush() {
+        if (runLen == 0) return;
+        if (runLen == 1) display->drawPixel((int16_t)runX, (int16_t)runY, color);
+        else display->drawFastHLine((int16_t)runX, (int16_t)runY, (int16_t)runLen, color);
+        runLen = 0;
+    }
+
+    void plot(int x, int y) {
+        x = wrapInto(x, field.x0, field.x1);
+        y = wrapInto(y, field.y0, field.y1);
+        if (runLen > 0 && y == runY) {
+            if (x == runX + runLen) { runLen++; return; }
+            if (x == runX - 1) { runX = x; runLen++; return; }
+        }
+        flush();
+        runX = x;
+        runY = y;
+        runLen = 1;
+    }
+};
+} // namespace detail
+
+/** Line from (x0, y0) to (x1, y1), both inclusive, wrapped into `field`. */
+static inline void drawLine(MatrixPanel_I2S_DMA* display, int x0, int y0, int x1, int y1, uint16_t color,
+                            const WrapField& field = PANEL_FIELD) {
+    if (!display || field.x1 <= field.x0 || field.y1 <= field.y0) return;
+    detail::SpanWriter out(display, field, color);
+
+    const bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        int t = x0; x0 = y0; y0 = t;
+        t = x1; x1 = y1; y1 = t;
+    }
+    if (x0 > x1) {
+        int t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+    const int dx = x1 - x0;
+    const int dy = abs(y1 - y0);
+    int err = dx / 2;
+    const int ystep = (y0 < y1) ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+        if (steep) out.plot(y0, x0);
+        else out.plot(x0, y0);
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+    out.flush();
+}
+
+/** Closed polygon through `n` vertices (xs[i], ys[i]). */
+static inline void drawPolygon(MatrixPanel_I2S_DMA* display, const int* xs, const int* ys, uint8_t n, uint16_t color,
+                               const WrapField& field = PANEL_FIELD) {
+    if (n < 2) return;
+    for (uint8_t i = 0; i < n; i++) {
+        const uint8_t j = (uint8_t)((i + 1 == n) ? 0 : i + 1);
+        drawLine(display, xs[i], ys[i], xs[j], ys[j], color, field);
+    }
+}
+
+} // namespace VectorRaster
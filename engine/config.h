@@ -26,6 +26,34 @@
 #define MENU_RENDER_FPS 30
 #define GAME_RENDER_FPS 30
 
+// Pause screen: the frozen game stays behind the menu at 1/2^N brightness
+// (rendered once on entry, see FrameCanvas::captureBackground()).
+#define PAUSE_BACKGROUND_DIM_SHIFT 1
+
+// SmallFont HUD text-run cache (component/SmallFont.h): fields drawn with
+// SmallFont::drawValue() replay their rasterized spans until the value changes.
+#define SMALLFONT_RUN_CACHE_SLOTS 10
+#define SMALLFONT_RUN_CACHE_SPANS 48
+
+// =======================================================
+// Task Layout (dual core)
+// =======================================================
+// 1: Bluepad32 + audio run in an input task pinned to core 0 and publish an
+//    input snapshot; the state machine (game update + render + present) runs in
+//    an engine task pinned to core 1. The Arduino loop() just idles.
+// 0: Everything runs serially in loop() (original single-core behavior).
+#ifndef ENABLE_DUAL_CORE
+#define ENABLE_DUAL_CORE 1
+#endif
+#define INPUT_TASK_CORE 0
+#define ENGINE_TASK_CORE 1
+#define INPUT_TASK_STACK 4096
+#define ENGINE_TASK_STACK 12288
+#define INPUT_TASK_PRIORITY 2
+#define ENGINE_TASK_PRIORITY 1
+// How often the input task polls Bluepad32 / drives audio (ms).
+#define INPUT_TASK_PERIOD_MS 2
+
 // HUB75 Pins
 #define R1_PIN 25
 #define G1_PIN 26
@@ -88,4 +116,20 @@
 // Debug toggles
 // =======================================================
 // Set to 1 to enable verbose serial logs for leaderboard/EEPROM flows.
-#define DEBUG_LEADERBOARD 0
\ No newline at end of file
+#define DEBUG_LEADERBOARD 0
+
+// Set to 1 to log entity pool telemetry (capacity / peak / failed spawns, engine/Pool.h)
+// when a game ends; use it to size the MAX_* pool constants in the game configs.
+#define DEBUG_POOLS 0
+
+// Frame-time profiler (engine/FrameProfiler.h): per-state / per-game histograms of
+// update/draw/present time. Compiled in but idle until enabled over serial
+// ('e' enable, 'o' overlay, 'p' dump, 'r' reset). Set to 0 to compile it out entirely.
+#define ENABLE_FRAME_PROFILER 1
+#define FRAME_PROFILER_START_ENABLED 0
+
+// Input record/replay buffer (engine/InputLog.h). Serial: 'R' record next game,
+// 'X' stop, 'D' hex dump. Only changed inputs are stored (~20 bytes per change).
+#ifndef INPUT_LOG_BYTES
+#define INPUT_LOG_BYTES 8192
+#endif
\ No newline at end of file
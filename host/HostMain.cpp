@@ -0,0 +1,362 @@
+/**
+ * HostMain.cpp
+ * ------------
+ * Headless desktop runner for the sketch (see CMakeLists.txt, target `snake_host`).
+ *
+ * The whole sketch (engine, applets, games) is compiled against the stubs in
+ * `host/stubs/`: a RAM-backed `MatrixPanel_I2S_DMA`, plain-data Bluepad32
+ * controllers, and a virtual clock. `loop()` is then driven as fast as the CPU
+ * allows; each call advances simulated time by the sketch's own `delay(1)`.
+ *
+ * Script:
+ * 1. connect N pads, confirm the user-select screen with A
+ * 2. move the menu cursor to the requested game and press A
+ * 3. run the requested number of loop() ticks with a deterministic "bot"
+ *    (d-pad / sticks / A / trigger changes every ~100 ms; never START or B),
+ *    or feed a recorded input log instead (`--replay`, see engine/InputLog.h)
+ *
+ * Usage:
+ *   snake_host [--game N] [--frames N] [--players N] [--seed N]
+ *              [--record FILE | --replay FILE]
+ *              [--realtime] [--ascii] [--ppm FILE] [--eeprom FILE] [--verbose]
+ *   snake_host --ai-bench GAMES [--seed N]
+ *
+ * `--replay` takes the game from the log; device logs (serial 'D' hex dump, minus
+ * the `[InputLog]` header line) can be converted with `xxd -r -p`.
+ *
+ * Output: one summary line (ticks, simulated/wall time, ticks/s, presents,
+ * panel pixel writes, checksum of the shown frame). The checksum is stable for a
+ * given build + arguments, so it doubles as a quick regression check.
+ *
+ * `--ai-bench` skips the menu script and plays GAMES Snake rounds with a CPU snake in
+ * every slot, stepping `SnakeGame::update()` once per move tick. It prints averages
+ * (round length, best score), planner work (searches cut short by the work budget =
+ * `cutoffs`, largest plan in row words = `max_plan_work`), the time per tick and how
+ * many ticks went over AI_TICK_BUDGET_US on this machine. Ticks are timed in wall time
+ * and in thread CPU time; `over_budget_ticks` uses CPU time, so a tick that was
+ * preempted by the OS is not blamed on the planner. The planners budget work, not time,
+ * so everything except the timings is deterministic for a given seed.
+ */
+#include "../SnakeGameLedPanel.ino"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <time.h>
+
+namespace {
+
+struct HostOptions {
+  int game = 0;
+  long frames = 5000;
+  int players = 1;
+  uint32_t seed = 1;
+  bool realtime = false;
+  bool ascii = false;
+  bool verbose = false;
+  const char* ppmPath = nullptr;
+  const char* eepromPath = nullptr;
+  const char* recordPath = nullptr;
+  const char* replayPath = nullptr;
+  long aiBenchGames = 0;
+};
+
+void usage() {
+  printf("usage: snake_host [--game N] [--frames N] [--players N] [--seed N]\n"
+         "                  [--record FILE | --replay FILE]\n"
+         "                  [--realtime] [--ascii] [--ppm FILE] [--eeprom FILE] [--verbose]\n"
+         "       snake_host --ai-bench GAMES [--seed N]\n");
+}
+
+bool parseArgs(int argc, char** argv, HostOptions& o) {
+  for (int i = 1; i < argc; i++) {
+    const std::string a = argv[i];
+    const bool hasValue = (i + 1 < argc);
+    if (a == "--game" && hasValue) o.game = atoi(argv[++i]);
+    else if (a == "--frames" && hasValue) o.frames = atol(argv[++i]);
+    else if (a == "--players" && hasValue) o.players = atoi(argv[++i]);
+    else if (a == "--seed" && hasValue) o.seed = (uint32_t)strtoul(argv[++i], nullptr, 10);
+    else if (a == "--ppm" && hasValue) o.ppmPath = argv[++i];
+    else if (a == "--eeprom" && hasValue) o.eepromPath = argv[++i];
+    else if (a == "--record" && hasValue) o.recordPath = argv[++i];
+    else if (a == "--replay" && hasValue) o.replayPath = argv[++i];
+    else if (a == "--ai-bench" && hasValue) o.aiBenchGames = atol(argv[++i]);
+    else if (a == "--realtime") o.realtime = true;
+    else if (a == "--ascii") o.ascii = true;
+    else if (a == "--verbose") o.verbose = true;
+    else return false;
+  }
+  if (o.players < 1) o.players = 1;
+  if (o.players > MAX_GAMEPADS) o.players = MAX_GAMEPADS;
+  return o.game >= 0 && o.game < GameRegistry::COUNT && o.frames >= 0 && o.aiBenchGames >= 0 &&
+         !(o.recordPath && o.replayPath);
+}
+
+bool loadReplay(const char* path, HostOptions& o) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  static uint8_t data[InputLog::CAPACITY];
+  const size_t n = fread(data, 1, sizeof(data), f);
+  fclose(f);
+  if (!inputLog.armReplay(data, (uint32_t)n)) return false;
+  o.game = inputLog.gameSlot();
+  return true;
+}
+
+bool saveRecording(const char* path) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  const size_t n = fwrite(inputLog.data(), 1, inputLog.size(), f);
+  fclose(f);
+  return n == inputLog.size();
+}
+
+// ---------------------------------------------------------
+// Driving the sketch
+// ---------------------------------------------------------
+// With ENABLE_DUAL_CORE the sketch runs in its own threads and we only wait;
+// otherwise we pump loop() until simulated time has advanced.
+void runForMs(uint32_t ms) {
+#if ENABLE_DUAL_CORE
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+#else
+  const unsigned long t0 = millis();
+  while ((unsigned long)(millis() - t0) < ms) loop();
+#endif
+}
+
+// Scripted presses are staged in the stub and applied by the input side's BP32.update().
+void pressButton(int pad, uint16_t mask) {
+  BP32.hostSetButtons(pad, mask);
+  runForMs(60);
+  BP32.hostSetButtons(pad, 0);
+  runForMs(400);
+}
+
+void pressDpad(int pad, uint8_t bits) {
+  BP32.hostSetDpad(pad, bits);
+  runForMs(60);
+  BP32.hostSetDpad(pad, 0);
+  runForMs(400);
+}
+
+// Deterministic gameplay input (independent of the sketch's random()).
+uint32_t gBotState = 1;
+uint32_t gBotNextMs = 0;
+
+uint32_t botRand() {
+  uint32_t x = gBotState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  gBotState = x;
+  return x;
+}
+
+void botInputHook(Bluepad32& bp) {
+  const uint32_t now = (uint32_t)millis();
+  if ((int32_t)(now - gBotNextMs) < 0) return;
+  gBotNextMs = now + 60 + (botRand() % 80);
+
+  for (int i = 0; i < MAX_GAMEPADS; i++) {
+    Controller& c = bp.hostController(i);
+    if (!c.connected) continue;
+    static const uint8_t DIRS[] = { 0x00, 0x01, 0x02, 0x04, 0x08 };
+    c.dpadBits = DIRS[botRand() % 5];
+    c.ax = (int32_t)(botRand() % 1025) - 512;
+    c.ay = (int32_t)(botRand() % 1025) - 512;
+    c.rx = (int32_t)(botRand() % 1025) - 512;
+    c.ry = (int32_t)(botRand() % 1025) - 512;
+    c.throttleVal = (botRand() % 3 == 0) ? 1023 : 0;
+    c.buttonBits = (botRand() % 4 == 0) ? Controller::BUTTON_A : 0;
+  }
+}
+
+// ---------------------------------------------------------
+// Snake AI benchmark
+// ---------------------------------------------------------
+// Rounds that outlive this many ticks are stopped and counted as timeouts.
+constexpr long AI_BENCH_MAX_TICKS = 20000;
+
+double threadCpuUs() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (double)ts.tv_sec * 1e6 + (double)ts.tv_nsec / 1e3;
+}
+
+int runAiBench(long games) {
+  static SnakeGame game; // large (fixed-size bodies): keep it off the stack
+  long ticksTotal = 0;
+  long timeouts = 0;
+  long scoreTotal = 0;
+  int scoreMax = 0;
+  double tickUsTotal = 0.0;
+  double tickUsMax = 0.0;
+  double tickCpuUsMax = 0.0;
+  long overBudgetTicks = 0;
+  const auto wall0 = std::chrono::steady_clock::now();
+
+  for (long g = 0; g < games; g++) {
+    game.startAiMatch();
+    long ticks = 0;
+    while (!game.isGameOver() && ticks < AI_BENCH_MAX_TICKS) {
+      HostClock::advanceUs((uint64_t)SnakeGameConfig::MOVE_TICK_MS * 1000ULL);
+      const auto t0 = std::chrono::steady_clock::now();
+      const double cpu0 = threadCpuUs();
+      game.update(globalControllerManager);
+      const double cpuUs = threadCpuUs() - cpu0;
+      const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+      tickUsTotal += us;
+      if (us > tickUsMax) tickUsMax = us;
+      if (cpuUs > tickCpuUsMax) tickCpuUsMax = cpuUs;
+      if (cpuUs > (double)SnakeGameConfig::AI_TICK_BUDGET_US) overBudgetTicks++;
+      ticks++;
+    }
+    if (!game.isGameOver()) timeouts++;
+    const int best = game.bestScore(true);
+    scoreTotal += best;
+    if (best > scoreMax) scoreMax = best;
+    ticksTotal += ticks;
+  }
+
+  const double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall0).count();
+  const SnakeGame::AiStats& st = game.aiStats();
+  printf("ai_bench games=%ld timeouts=%ld avg_ticks=%.1f avg_best_score=%.2f max_best_score=%d "
+         "plans=%lu cutoffs=%lu max_plan_work=%lu avg_tick_us=%.2f max_tick_us=%.1f max_tick_cpu_us=%.1f over_budget_ticks=%ld "
+         "budget_us=%lu wall_ms=%.1f\n",
+         games, timeouts, games ? (double)ticksTotal / games : 0.0, games ? (double)scoreTotal / games : 0.0, scoreMax,
+         (unsigned long)st.plans, (unsigned long)st.cutoffs, (unsigned long)st.maxPlanWork,
+         ticksTotal ? tickUsTotal / ticksTotal : 0.0, tickUsMax, tickCpuUsMax, overBudgetTicks,
+         (unsigned long)SnakeGameConfig::AI_TICK_BUDGET_US, wallMs);
+  fflush(stdout);
+  return 0;
+}
+
+// ---------------------------------------------------------
+// Output
+// ---------------------------------------------------------
+void dumpAscii(const uint16_t* frame) {
+  for (int y = 0; y < PANEL_RES_Y; y++) {
+    std::string row;
+    for (int x = 0; x < PANEL_RES_X * PANEL_CHAIN; x++) row += frame[y * PANEL_RES_X * PANEL_CHAIN + x] ? '#' : '.';
+    puts(row.c_str());
+  }
+}
+
+bool writePpm(const char* path, const uint16_t* frame) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  const int w = PANEL_RES_X * PANEL_CHAIN;
+  fprintf(f, "P6\n%d %d\n255\n", w, PANEL_RES_Y);
+  for (int i = 0; i < w * PANEL_RES_Y; i++) {
+    const uint16_t c = frame[i];
+    const uint8_t rgb[3] = {
+      (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+      (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+      (uint8_t)((c & 0x1F) * 255 / 31)
+    };
+    fwrite(rgb, 1, 3, f);
+  }
+  fclose(f);
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  HostOptions opt;
+  if (!parseArgs(argc, argv, opt)) {
+    usage();
+    return 2;
+  }
+
+#if ENABLE_DUAL_CORE
+  // Two threads cannot share the virtual clock: dual-core host runs use wall time.
+  opt.realtime = true;
+#endif
+  HostClock::setRealtime(opt.realtime);
+  Serial.hostSetMuted(!opt.verbose);
+  randomSeed(opt.seed);
+  if (opt.eepromPath) EEPROM.hostSetBackingFile(opt.eepromPath);
+  if (opt.replayPath && !loadReplay(opt.replayPath, opt)) {
+    fprintf(stderr, "could not load input log %s\n", opt.replayPath);
+    return 2;
+  }
+  if (opt.recordPath) inputLog.armRecording();
+
+  if (opt.aiBenchGames > 0) {
+    setup();
+#if ENABLE_DUAL_CORE
+    // The bench drives its own SnakeGame on this thread: park the sketch tasks, then
+    // the virtual clock can be used again.
+    HostTasks::haltAll();
+    HostClock::setRealtime(false);
+    const int rc = runAiBench(opt.aiBenchGames);
+    _Exit(rc); // see the end of main()
+#else
+    return runAiBench(opt.aiBenchGames);
+#endif
+  }
+
+  for (int i = 0; i < opt.players; i++) BP32.hostConnect(i);
+  setup();
+  runForMs(500);
+
+  // User select -> menu
+  pressButton(0, Controller::BUTTON_A);
+  runForMs(500);
+
+  // Menu -> game (the cursor walks visible options only)
+  int downs = 0;
+  for (int i = 0; i < opt.game; i++) {
+    if (menu.isOptionVisible(i, opt.players)) downs++;
+  }
+  if (!menu.isOptionVisible(opt.game, opt.players)) {
+    fprintf(stderr, "game %d is not available with %d players\n", opt.game, opt.players);
+    return 2;
+  }
+  for (int i = 0; i < downs; i++) pressDpad(0, 0x02);
+  pressButton(0, Controller::BUTTON_A);
+
+  // Gameplay
+  gBotState = opt.seed ? opt.seed : 1;
+  gBotNextMs = (uint32_t)millis();
+  if (!opt.replayPath) BP32.hostSetInputHook(&botInputHook);
+
+  const uint64_t writes0 = dma_display->hostPixelWrites();
+  const uint32_t flips0 = dma_display->hostFlips();
+  const unsigned long sim0 = millis();
+  const auto wall0 = std::chrono::steady_clock::now();
+#if ENABLE_DUAL_CORE
+  runForMs((uint32_t)opt.frames);
+  // Park the input/engine tasks between ticks: the frame, input log and counters
+  // below are then read without racing them.
+  HostTasks::haltAll();
+#else
+  for (long i = 0; i < opt.frames; i++) loop();
+#endif
+  const double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall0).count();
+
+  const uint16_t* shown = dma_display->hostShownFrame();
+  if (opt.ascii) dumpAscii(shown);
+  if (opt.ppmPath && !writePpm(opt.ppmPath, shown)) {
+    fprintf(stderr, "could not write %s\n", opt.ppmPath);
+  }
+  if (opt.recordPath) {
+    if (inputLog.overflowed()) fprintf(stderr, "input log full (INPUT_LOG_BYTES), recording truncated\n");
+    if (!saveRecording(opt.recordPath)) fprintf(stderr, "could not write %s\n", opt.recordPath);
+  }
+
+  printf("game=%d state=%d ticks=%ld sim_ms=%lu wall_ms=%.1f ticks_per_s=%.0f presents=%u pixel_writes=%llu checksum=%08x\n",
+         opt.game, (int)currentState, opt.frames, (unsigned long)(millis() - sim0), wallMs,
+         wallMs > 0.0 ? (double)opt.frames * 1000.0 / wallMs : 0.0,
+         (unsigned)(dma_display->hostFlips() - flips0),
+         (unsigned long long)(dma_display->hostPixelWrites() - writes0),
+         (unsigned)dma_display->hostFrameChecksum());
+  fflush(stdout);
+#if ENABLE_DUAL_CORE
+  // Sketch tasks are parked for good; don't run static destructors under them.
+  _Exit(0);
+#endif
+  return 0;
+}
@@ -0,0 +1,233 @@
+/**
+ * HostArduino.cpp
+ * ---------------
+ * Host implementations for the Arduino.h / EEPROM.h / Print.h stubs.
+ */
+#include <Arduino.h>
+#include <EEPROM.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+EEPROMClass EEPROM;
+
+// ---------------------------------------------------------------------------
+// Clock
+// ---------------------------------------------------------------------------
+namespace {
+std::atomic<bool> gRealtime{false};
+std::atomic<uint64_t> gVirtualUs{0};
+const auto gEpoch = std::chrono::steady_clock::now();
+
+uint64_t wallUs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - gEpoch).count();
+}
+}
+
+namespace HostClock {
+void setRealtime(bool on) { gRealtime = on; }
+bool isRealtime() { return gRealtime; }
+void advanceUs(uint64_t us) { if (!gRealtime) gVirtualUs += us; }
+uint64_t nowUs() { return gRealtime ? wallUs() : gVirtualUs.load(); }
+}
+
+unsigned long millis() { return (unsigned long)(HostClock::nowUs() / 1000ULL); }
+unsigned long micros() { return (unsigned long)HostClock::nowUs(); }
+
+void delay(unsigned long ms) {
+  if (gRealtime) std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  else HostClock::advanceUs((uint64_t)ms * 1000ULL);
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (gRealtime) std::this_thread::sleep_for(std::chrono::microseconds(us));
+  else HostClock::advanceUs(us);
+}
+
+void yield() {
+  if (gRealtime) std::this_thread::yield();
+}
+
+// ---------------------------------------------------------------------------
+// Tasks
+// ---------------------------------------------------------------------------
+namespace {
+std::mutex gTaskMutex;
+std::condition_variable gTaskCv;
+int gTasksRegistered = 0;
+int gTasksParked = 0;
+bool gTasksHalt = false;
+}
+
+namespace HostTasks {
+void registerTask() {
+  std::lock_guard<std::mutex> lock(gTaskMutex);
+  gTasksRegistered++;
+}
+
+void checkpoint() {
+  std::unique_lock<std::mutex> lock(gTaskMutex);
+  if (!gTasksHalt) return;
+  gTasksParked++;
+  gTaskCv.notify_all();
+  gTaskCv.wait(lock, [] { return false; }); // parked until the process exits
+}
+
+void haltAll() {
+  std::unique_lock<std::mutex> lock(gTaskMutex);
+  gTasksHalt = true;
+  gTaskCv.wait(lock, [] { return gTasksParked == gTasksRegistered; });
+}
+}
+
+uint32_t EspClass::getCycleCount() { return (uint32_t)(HostClock::nowUs() * 240ULL); }
+void EspClass::restart() { exit(0); }
+
+// ---------------------------------------------------------------------------
+// Random (deterministic xorshift so host runs are reproducible)
+// ---------------------------------------------------------------------------
+namespace {
+uint32_t gRngState = 0x2545F491u;
+uint32_t nextRand() {
+  uint32_t x = gRngState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  gRngState = x;
+  return x;
+}
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  return (long)(nextRand() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) gRngState = (uint32_t)seed;
+}
+
+uint32_t esp_random() { return nextRand(); }
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  const long dividend = out_max - out_min;
+  const long divisor = in_max - in_min;
+  if (divisor == 0) return -1;
+  return (x - in_min) * dividend / divisor + out_min;
+}
+
+// ---------------------------------------------------------------------------
+// Print
+// ---------------------------------------------------------------------------
+size_t Print::printNumber(unsigned long n, int base) {
+  char buf[8 * sizeof(long) + 1];
+  char* str = &buf[sizeof(buf) - 1];
+  *str = '\0';
+  if (base < 2) base = 10;
+  do {
+    const char c = (char)(n % (unsigned long)base);
+    n /= (unsigned long)base;
+    *--str = (char)(c < 10 ? c + '0' : c + 'A' - 10);
+  } while (n);
+  return write(str);
+}
+
+size_t Print::print(double v, int digits) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", digits, v);
+  return write(buf);
+}
+
+// ---------------------------------------------------------------------------
+// Serial
+// ---------------------------------------------------------------------------
+namespace {
+std::mutex gRxMutex;
+std::deque<char> gRx;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (!mutedOut) fputc((int)c, stdout);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  if (!mutedOut) fwrite(buffer, 1, size, stdout);
+  return size;
+}
+
+int HardwareSerial::available() {
+  std::lock_guard<std::mutex> lock(gRxMutex);
+  return (int)gRx.size();
+}
+
+int HardwareSerial::read() {
+  std::lock_guard<std::mutex> lock(gRxMutex);
+  if (gRx.empty()) return -1;
+  const char c = gRx.front();
+  gRx.pop_front();
+  return (uint8_t)c;
+}
+
+int HardwareSerial::peek() {
+  std::lock_guard<std::mutex> lock(gRxMutex);
+  return gRx.empty() ? -1 : (uint8_t)gRx.front();
+}
+
+void HardwareSerial::hostInject(const char* text) {
+  std::lock_guard<std::mutex> lock(gRxMutex);
+  while (text && *text) gRx.push_back(*text++);
+}
+
+// ---------------------------------------------------------------------------
+// EEPROM
+// ---------------------------------------------------------------------------
+bool EEPROMClass::begin(size_t sz) {
+  if (data) return true;
+  data = new uint8_t[sz];
+  size = sz;
+  memset(data, 0xFF, sz);
+  if (backingFile) {
+    if (FILE* f = fopen(backingFile, "rb")) {
+      const size_t n = fread(data, 1, sz, f);
+      (void)n;
+      fclose(f);
+    }
+  }
+  return true;
+}
+
+uint8_t EEPROMClass::read(int address) const {
+  if (!data || address < 0 || (size_t)address >= size) return 0;
+  return data[address];
+}
+
+void EEPROMClass::write(int address, uint8_t value) {
+  if (!data || address < 0 || (size_t)address >= size) return;
+  data[address] = value;
+}
+
+bool EEPROMClass::commit() {
+  if (!data) return false;
+  if (backingFile) {
+    FILE* f = fopen(backingFile, "wb");
+    if (!f) return false;
+    fwrite(data, 1, size, f);
+    fclose(f);
+  }
+  return true;
+}
+
+void EEPROMClass::hostSetBackingFile(const char* path) { backingFile = path; }
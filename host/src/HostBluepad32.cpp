@@ -0,0 +1,53 @@
+/**
+ * HostBluepad32.cpp
+ * -----------------
+ * Host implementation of the Bluepad32 stub.
+ */
+#include <Bluepad32.h>
+
+Bluepad32 BP32;
+
+void Bluepad32::setup(GamepadCallback onConnect, GamepadCallback onDisconnect) {
+  onConnected = onConnect;
+  onDisconnected = onDisconnect;
+}
+
+bool Bluepad32::update() {
+  void (*hook)(Bluepad32&) = inputHook.load();
+  if (hook) hook(*this);
+  for (int i = 0; i < MAX_CONTROLLERS; i++) {
+    if (pendingButtons[i].exchange(false)) pads[i].buttonBits = stagedButtons[i].load();
+    if (pendingDpad[i].exchange(false)) pads[i].dpadBits = stagedDpad[i].load();
+    if (pendingDisconnect[i].exchange(false) && pads[i].connected) {
+      pads[i].connected = false;
+      if (onDisconnected) onDisconnected(&pads[i]);
+    }
+    if (pendingConnect[i].exchange(false) && !pads[i].connected) {
+      pads[i].connected = true;
+      if (onConnected) onConnected(&pads[i]);
+    }
+  }
+  return true;
+}
+
+void Bluepad32::hostSetButtons(int i, uint16_t bits) {
+  if (i < 0 || i >= MAX_CONTROLLERS) return;
+  stagedButtons[i] = bits;
+  pendingButtons[i] = true;
+}
+
+void Bluepad32::hostSetDpad(int i, uint8_t bits) {
+  if (i < 0 || i >= MAX_CONTROLLERS) return;
+  stagedDpad[i] = bits;
+  pendingDpad[i] = true;
+}
+
+void Bluepad32::hostConnect(int i) {
+  if (i < 0 || i >= MAX_CONTROLLERS) return;
+  pendingConnect[i] = true;
+}
+
+void Bluepad32::hostDisconnect(int i) {
+  if (i < 0 || i >= MAX_CONTROLLERS) return;
+  pendingDisconnect[i] = true;
+}
@@ -0,0 +1,353 @@
+/**
+ * HostGfx.cpp
+ * -----------
+ * Adafruit_GFX subset + HUB75 panel stub. Shape algorithms follow the
+ * Adafruit_GFX reference implementations so pixel output matches the device.
+ */
+#include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
+
+#define GFX_SWAP(a, b) do { int16_t t_ = a; a = b; b = t_; } while (0)
+
+// ---------------------------------------------------------------------------
+// Adafruit_GFX
+// ---------------------------------------------------------------------------
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  const bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) { GFX_SWAP(x0, y0); GFX_SWAP(x1, y1); }
+  if (x0 > x1) { GFX_SWAP(x0, x1); GFX_SWAP(y0, y1); }
+  const int16_t dx = (int16_t)(x1 - x0);
+  const int16_t dy = (int16_t)abs(y1 - y0);
+  int16_t err = (int16_t)(dx / 2);
+  const int16_t ystep = (y0 < y1) ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep) writePixel(y0, x0, color);
+    else writePixel(x0, y0, color);
+    err = (int16_t)(err - dy);
+    if (err < 0) { y0 = (int16_t)(y0 + ystep); err = (int16_t)(err + dx); }
+  }
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  startWrite();
+  writeLine(x, y, x, (int16_t)(y + h - 1), color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  startWrite();
+  writeLine(x, y, (int16_t)(x + w - 1), y, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  startWrite();
+  for (int16_t i = x; i < x + w; i++) writeFastVLine(i, y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  if (x0 == x1) {
+    if (y0 > y1) GFX_SWAP(y0, y1);
+    drawFastVLine(x0, y0, (int16_t)(y1 - y0 + 1), color);
+  } else if (y0 == y1) {
+    if (x0 > x1) GFX_SWAP(x0, x1);
+    drawFastHLine(x0, y0, (int16_t)(x1 - x0 + 1), color);
+  } else {
+    startWrite();
+    writeLine(x0, y0, x1, y1, color);
+    endWrite();
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  startWrite();
+  writeFastHLine(x, y, w, color);
+  writeFastHLine(x, (int16_t)(y + h - 1), w, color);
+  writeFastVLine(x, y, h, color);
+  writeFastVLine((int16_t)(x + w - 1), y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  int16_t f = (int16_t)(1 - r);
+  int16_t ddF_x = 1;
+  int16_t ddF_y = (int16_t)(-2 * r);
+  int16_t x = 0;
+  int16_t y = r;
+  startWrite();
+  writePixel(x0, (int16_t)(y0 + r), color);
+  writePixel(x0, (int16_t)(y0 - r), color);
+  writePixel((int16_t)(x0 + r), y0, color);
+  writePixel((int16_t)(x0 - r), y0, color);
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y = (int16_t)(ddF_y + 2); f = (int16_t)(f + ddF_y); }
+    x++;
+    ddF_x = (int16_t)(ddF_x + 2);
+    f = (int16_t)(f + ddF_x);
+    writePixel((int16_t)(x0 + x), (int16_t)(y0 + y), color);
+    writePixel((int16_t)(x0 - x), (int16_t)(y0 + y), color);
+    writePixel((int16_t)(x0 + x), (int16_t)(y0 - y), color);
+    writePixel((int16_t)(x0 - x), (int16_t)(y0 - y), color);
+    writePixel((int16_t)(x0 + y), (int16_t)(y0 + x), color);
+    writePixel((int16_t)(x0 - y), (int16_t)(y0 + x), color);
+    writePixel((int16_t)(x0 + y), (int16_t)(y0 - x), color);
+    writePixel((int16_t)(x0 - y), (int16_t)(y0 - x), color);
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color) {
+  int16_t f = (int16_t)(1 - r);
+  int16_t ddF_x = 1;
+  int16_t ddF_y = (int16_t)(-2 * r);
+  int16_t x = 0;
+  int16_t y = r;
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y = (int16_t)(ddF_y + 2); f = (int16_t)(f + ddF_y); }
+    x++;
+    ddF_x = (int16_t)(ddF_x + 2);
+    f = (int16_t)(f + ddF_x);
+    if (cornername & 0x4) { writePixel((int16_t)(x0 + x), (int16_t)(y0 + y), color); writePixel((int16_t)(x0 + y), (int16_t)(y0 + x), color); }
+    if (cornername & 0x2) { writePixel((int16_t)(x0 + x), (int16_t)(y0 - y), color); writePixel((int16_t)(x0 + y), (int16_t)(y0 - x), color); }
+    if (cornername & 0x8) { writePixel((int16_t)(x0 - y), (int16_t)(y0 + x), color); writePixel((int16_t)(x0 - x), (int16_t)(y0 + y), color); }
+    if (cornername & 0x1) { writePixel((int16_t)(x0 - y), (int16_t)(y0 - x), color); writePixel((int16_t)(x0 - x), (int16_t)(y0 - y), color); }
+  }
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  startWrite();
+  writeFastVLine(x0, (int16_t)(y0 - r), (int16_t)(2 * r + 1), color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
+  int16_t f = (int16_t)(1 - r);
+  int16_t ddF_x = 1;
+  int16_t ddF_y = (int16_t)(-2 * r);
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+  delta++;
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y = (int16_t)(ddF_y + 2); f = (int16_t)(f + ddF_y); }
+    x++;
+    ddF_x = (int16_t)(ddF_x + 2);
+    f = (int16_t)(f + ddF_x);
+    if (x < (y + 1)) {
+      if (corners & 1) writeFastVLine((int16_t)(x0 + x), (int16_t)(y0 - y), (int16_t)(2 * y + delta), color);
+      if (corners & 2) writeFastVLine((int16_t)(x0 - x), (int16_t)(y0 - y), (int16_t)(2 * y + delta), color);
+    }
+    if (y != py) {
+      if (corners & 1) writeFastVLine((int16_t)(x0 + py), (int16_t)(y0 - px), (int16_t)(2 * px + delta), color);
+      if (corners & 2) writeFastVLine((int16_t)(x0 - py), (int16_t)(y0 - px), (int16_t)(2 * px + delta), color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  int16_t a, b, y, last;
+  if (y0 > y1) { GFX_SWAP(y0, y1); GFX_SWAP(x0, x1); }
+  if (y1 > y2) { GFX_SWAP(y2, y1); GFX_SWAP(x2, x1); }
+  if (y0 > y1) { GFX_SWAP(y0, y1); GFX_SWAP(x0, x1); }
+  startWrite();
+  if (y0 == y2) {
+    a = b = x0;
+    if (x1 < a) a = x1; else if (x1 > b) b = x1;
+    if (x2 < a) a = x2; else if (x2 > b) b = x2;
+    writeFastHLine(a, y0, (int16_t)(b - a + 1), color);
+    endWrite();
+    return;
+  }
+  const int16_t dx01 = (int16_t)(x1 - x0), dy01 = (int16_t)(y1 - y0), dx02 = (int16_t)(x2 - x0),
+                dy02 = (int16_t)(y2 - y0), dx12 = (int16_t)(x2 - x1), dy12 = (int16_t)(y2 - y1);
+  int32_t sa = 0, sb = 0;
+  last = (y1 == y2) ? y1 : (int16_t)(y1 - 1);
+  for (y = y0; y <= last; y++) {
+    a = (int16_t)(x0 + sa / dy01);
+    b = (int16_t)(x0 + sb / dy02);
+    sa += dx01;
+    sb += dx02;
+    if (a > b) GFX_SWAP(a, b);
+    writeFastHLine(a, y, (int16_t)(b - a + 1), color);
+  }
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = (int16_t)(x1 + sa / dy12);
+    b = (int16_t)(x0 + sb / dy02);
+    sa += dx12;
+    sb += dx02;
+    if (a > b) GFX_SWAP(a, b);
+    writeFastHLine(a, y, (int16_t)(b - a + 1), color);
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  const int16_t maxRadius = (int16_t)(((w < h) ? w : h) / 2);
+  if (r > maxRadius) r = maxRadius;
+  startWrite();
+  writeFastHLine((int16_t)(x + r), y, (int16_t)(w - 2 * r), color);
+  writeFastHLine((int16_t)(x + r), (int16_t)(y + h - 1), (int16_t)(w - 2 * r), color);
+  writeFastVLine(x, (int16_t)(y + r), (int16_t)(h - 2 * r), color);
+  writeFastVLine((int16_t)(x + w - 1), (int16_t)(y + r), (int16_t)(h - 2 * r), color);
+  drawCircleHelper((int16_t)(x + r), (int16_t)(y + r), r, 1, color);
+  drawCircleHelper((int16_t)(x + w - r - 1), (int16_t)(y + r), r, 2, color);
+  drawCircleHelper((int16_t)(x + w - r - 1), (int16_t)(y + h - r - 1), r, 4, color);
+  drawCircleHelper((int16_t)(x + r), (int16_t)(y + h - r - 1), r, 8, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  const int16_t maxRadius = (int16_t)(((w < h) ? w : h) / 2);
+  if (r > maxRadius) r = maxRadius;
+  startWrite();
+  writeFillRect((int16_t)(x + r), y, (int16_t)(w - 2 * r), h, color);
+  fillCircleHelper((int16_t)(x + w - r - 1), (int16_t)(y + r), r, 1, (int16_t)(h - 2 * r - 1), color);
+  fillCircleHelper((int16_t)(x + r), (int16_t)(y + r), r, 2, (int16_t)(h - 2 * r - 1), color);
+  endWrite();
+}
+
+void Adafruit_GFX::setFont(const GFXfont* f) {
+  if (f && !gfxFont) cursor_y = (int16_t)(cursor_y + 6);
+  else if (!f && gfxFont) cursor_y = (int16_t)(cursor_y - 6);
+  gfxFont = f;
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+  (void)bg;
+  if (!gfxFont) return; // classic font not bundled on host
+  c = (unsigned char)(c - gfxFont->first);
+  const GFXglyph* glyph = &gfxFont->glyph[c];
+  const uint8_t* bitmap = gfxFont->bitmap;
+  uint16_t bo = glyph->bitmapOffset;
+  const uint8_t w = glyph->width, h = glyph->height;
+  const int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+  uint8_t bits = 0, bit = 0;
+  startWrite();
+  for (uint8_t yy = 0; yy < h; yy++) {
+    for (uint8_t xx = 0; xx < w; xx++) {
+      if (!(bit++ & 7)) bits = bitmap[bo++];
+      if (bits & 0x80) {
+        if (size == 1) writePixel((int16_t)(x + xo + xx), (int16_t)(y + yo + yy), color);
+        else writeFillRect((int16_t)(x + (xo + xx) * size), (int16_t)(y + (yo + yy) * size), size, size, color);
+      }
+      bits = (uint8_t)(bits << 1);
+    }
+  }
+  endWrite();
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (!gfxFont) {
+    if (c == '\n') { cursor_x = 0; cursor_y = (int16_t)(cursor_y + textsize_y * 8); }
+    else if (c != '\r') cursor_x = (int16_t)(cursor_x + textsize_x * 6);
+    return 1;
+  }
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y = (int16_t)(cursor_y + (int16_t)textsize_y * gfxFont->yAdvance);
+  } else if (c != '\r') {
+    if (c >= gfxFont->first && c <= gfxFont->last) {
+      const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+      const uint8_t w = glyph->width, h = glyph->height;
+      if (w > 0 && h > 0) {
+        const int16_t xo = glyph->xOffset;
+        if (wrap && ((cursor_x + textsize_x * (xo + w)) > _width)) {
+          cursor_x = 0;
+          cursor_y = (int16_t)(cursor_y + (int16_t)textsize_y * gfxFont->yAdvance);
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x);
+      }
+      cursor_x = (int16_t)(cursor_x + glyph->xAdvance * (int16_t)textsize_x);
+    }
+  }
+  return 1;
+}
+
+// ---------------------------------------------------------------------------
+// MatrixPanel_I2S_DMA (host)
+// ---------------------------------------------------------------------------
+MatrixPanel_I2S_DMA::MatrixPanel_I2S_DMA(const HUB75_I2S_CFG& opts)
+    : Adafruit_GFX((int16_t)(opts.mx_width * opts.chain_length), (int16_t)opts.mx_height), cfg(opts) {}
+
+MatrixPanel_I2S_DMA::~MatrixPanel_I2S_DMA() {
+  delete[] buffers[0];
+  delete[] buffers[1];
+}
+
+bool MatrixPanel_I2S_DMA::begin() {
+  if (initialized) return true;
+  const size_t n = (size_t)_width * (size_t)_height;
+  buffers[0] = new uint16_t[n]();
+  buffers[1] = cfg.double_buff ? new uint16_t[n]() : nullptr;
+  backIndex = cfg.double_buff ? 1 : 0;
+  initialized = true;
+  return true;
+}
+
+void MatrixPanel_I2S_DMA::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (!initialized) return;
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+  buffers[backIndex][(size_t)y * (size_t)_width + (size_t)x] = color;
+  pixelWrites.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MatrixPanel_I2S_DMA::fillBack(uint16_t color) {
+  if (!initialized) return;
+  const size_t n = (size_t)_width * (size_t)_height;
+  uint16_t* buf = buffers[backIndex];
+  for (size_t i = 0; i < n; i++) buf[i] = color;
+  pixelWrites.fetch_add((uint64_t)n, std::memory_order_relaxed);
+}
+
+void MatrixPanel_I2S_DMA::fillScreen(uint16_t color) { fillBack(color); }
+
+void MatrixPanel_I2S_DMA::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  for (int16_t i = 0; i < h; i++) drawPixel(x, (int16_t)(y + i), color);
+}
+
+void MatrixPanel_I2S_DMA::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  for (int16_t i = 0; i < w; i++) drawPixel((int16_t)(x + i), y, color);
+}
+
+void MatrixPanel_I2S_DMA::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t j = 0; j < h; j++) drawFastHLine(x, (int16_t)(y + j), w, color);
+}
+
+void MatrixPanel_I2S_DMA::flipDMABuffer() {
+  if (!initialized || !cfg.double_buff) return;
+  backIndex ^= 1;
+  flips.fetch_add(1, std::memory_order_relaxed);
+}
+
+const uint16_t* MatrixPanel_I2S_DMA::hostShownFrame() const {
+  if (!initialized) return nullptr;
+  return cfg.double_buff ? buffers[backIndex ^ 1] : buffers[0];
+}
+
+uint32_t MatrixPanel_I2S_DMA::hostFrameChecksum() const {
+  const uint16_t* f = hostShownFrame();
+  if (!f) return 0;
+  uint32_t h = 2166136261u;
+  const size_t n = (size_t)_width * (size_t)_height;
+  for (size_t i = 0; i < n; i++) {
+    h ^= f[i];
+    h *= 16777619u;
+  }
+  return h;
+}
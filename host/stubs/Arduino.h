@@ -0,0 +1,148 @@
+/**
+ * Arduino.h (host stub)
+ * ---------------------
+ * Minimal subset of the Arduino-ESP32 core surface used by this sketch, so the
+ * engine, applets and games can be compiled and run on a desktop machine.
+ *
+ * Time is virtual by default: `millis()` / `micros()` only advance when the
+ * sketch calls `delay()` (or the host harness calls `HostClock::advanceUs()`),
+ * which lets the loop() state machine run thousands of frames per second while
+ * games still observe a plausible timeline.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <ctype.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "Print.h"
+
+using std::min;
+using std::max;
+using std::abs;
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_pointer(addr) ((void*)*(addr))
+#define IRAM_ATTR
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+
+#define HEX 16
+#define DEC 10
+#define BIN 2
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// ---------------------------------------------------------------------------
+// Clock
+// ---------------------------------------------------------------------------
+namespace HostClock {
+  // When true, millis()/micros() follow the wall clock and delay() sleeps.
+  void setRealtime(bool on);
+  bool isRealtime();
+  void advanceUs(uint64_t us);
+  uint64_t nowUs();
+}
+
+// ---------------------------------------------------------------------------
+// Tasks (ENABLE_DUAL_CORE host runs, see engine/EngineTasks.h)
+// ---------------------------------------------------------------------------
+namespace HostTasks {
+  // Count one more task thread (EngineTasks::spawnPinned(), before the thread starts).
+  void registerTask();
+  // Called by task threads between iterations (EngineTasks::sleepMs()); parks the
+  // calling thread for good once haltAll() was requested.
+  void checkpoint();
+  // Park every registered task at its next checkpoint and wait until they all are:
+  // afterwards the harness may read sketch state without racing the tasks.
+  void haltAll();
+}
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// ---------------------------------------------------------------------------
+// Random (Arduino semantics: random(max) in [0,max), random(min,max) in [min,max))
+// ---------------------------------------------------------------------------
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+uint32_t esp_random();
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+// ---------------------------------------------------------------------------
+// GPIO / LEDC (no-ops on host)
+// ---------------------------------------------------------------------------
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return 0; }
+inline int analogRead(uint8_t) { return 0; }
+inline double ledcSetup(uint8_t, double freq, uint8_t) { return freq; }
+inline void ledcAttachPin(uint8_t, uint8_t) {}
+inline double ledcWriteTone(uint8_t, double freq) { return freq; }
+inline void ledcWrite(uint8_t, uint32_t) {}
+
+// ---------------------------------------------------------------------------
+// Serial
+// ---------------------------------------------------------------------------
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  void end() {}
+  void flush() { fflush(stdout); }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+
+  // Host harness can feed bytes (e.g. serial commands) into the RX queue.
+  int available();
+  int read();
+  int peek();
+  void hostInject(const char* text);
+
+  // Host harness can silence console output (benchmarks).
+  void hostSetMuted(bool muted) { mutedOut = muted; }
+
+  operator bool() const { return true; }
+
+private:
+  bool mutedOut = false;
+};
+
+extern HardwareSerial Serial;
+
+// ---------------------------------------------------------------------------
+// ESP system helpers
+// ---------------------------------------------------------------------------
+class EspClass {
+public:
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getCycleCount();
+  void restart();
+};
+
+extern EspClass ESP;
@@ -0,0 +1,109 @@
+/**
+ * Bluepad32.h (host stub)
+ * -----------------------
+ * Plain-data stand-in for Bluepad32 controllers. `BP32.update()` runs the host
+ * input hook (which may edit the pads directly: it runs inside update()), applies
+ * button / d-pad changes staged by the harness, then delivers pending
+ * connect/disconnect callbacks, like the real library does from within update().
+ *
+ * The `host*` setters only stage changes (atomics), so the harness may call them
+ * from its own thread while the input task runs update() (HOST_DUAL_CORE).
+ */
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+class Controller {
+public:
+  // Button masks (subset of Bluepad32 conventions).
+  static constexpr uint16_t BUTTON_A = 0x0001;
+  static constexpr uint16_t BUTTON_B = 0x0002;
+  static constexpr uint16_t BUTTON_X = 0x0004;
+  static constexpr uint16_t BUTTON_Y = 0x0008;
+  static constexpr uint16_t BUTTON_SHOULDER_L = 0x0010;
+  static constexpr uint16_t BUTTON_SHOULDER_R = 0x0020;
+  static constexpr uint16_t BUTTON_TRIGGER_L = 0x0040;
+  static constexpr uint16_t BUTTON_TRIGGER_R = 0x0080;
+
+  static constexpr uint8_t MISC_SYSTEM = 0x01;
+  static constexpr uint8_t MISC_SELECT = 0x02;
+  static constexpr uint8_t MISC_START = 0x04;
+
+  bool isConnected() const { return connected; }
+  uint8_t dpad() const { return dpadBits; }
+  uint16_t buttons() const { return buttonBits; }
+  uint16_t miscButtons() const { return miscBits; }
+  bool a() const { return (buttonBits & BUTTON_A) != 0; }
+  bool b() const { return (buttonBits & BUTTON_B) != 0; }
+  bool x() const { return (buttonBits & BUTTON_X) != 0; }
+  bool y() const { return (buttonBits & BUTTON_Y) != 0; }
+  bool l1() const { return (buttonBits & BUTTON_SHOULDER_L) != 0; }
+  bool r1() const { return (buttonBits & BUTTON_SHOULDER_R) != 0; }
+  bool l2() const { return (buttonBits & BUTTON_TRIGGER_L) != 0; }
+  bool r2() const { return (buttonBits & BUTTON_TRIGGER_R) != 0; }
+  int32_t axisX() const { return ax; }
+  int32_t axisY() const { return ay; }
+  int32_t axisRX() const { return rx; }
+  int32_t axisRY() const { return ry; }
+  int32_t brake() const { return brakeVal; }
+  int32_t throttle() const { return throttleVal; }
+
+  void setRumble(uint8_t, uint8_t) {}
+  void playDualRumble(uint16_t, uint16_t, uint8_t, uint8_t) {}
+  void setColorLED(uint8_t, uint8_t, uint8_t) {}
+  void setPlayerLEDs(uint8_t) {}
+
+  // Host-side state (written by the harness).
+  bool connected = false;
+  uint8_t dpadBits = 0;
+  uint16_t buttonBits = 0;
+  uint16_t miscBits = 0;
+  int32_t ax = 0;
+  int32_t ay = 0;
+  int32_t rx = 0;
+  int32_t ry = 0;
+  int32_t brakeVal = 0;
+  int32_t throttleVal = 0;
+};
+
+typedef Controller* ControllerPtr;
+
+typedef void (*GamepadCallback)(ControllerPtr);
+
+class Bluepad32 {
+public:
+  static constexpr int MAX_CONTROLLERS = 4;
+
+  void setup(GamepadCallback onConnect, GamepadCallback onDisconnect);
+  bool update();
+  void enableVirtualDevice(bool) {}
+  void forgetBluetoothKeys() {}
+  void enableNewBluetoothConnections(bool) {}
+
+  // ---- host-only ----
+  // Called at the start of every update(); the harness uses it to advance
+  // scripted input for the current simulated time.
+  void hostSetInputHook(void (*hook)(Bluepad32&)) { inputHook = hook; }
+  // Pad state; only for code running inside update() (the input hook).
+  Controller& hostController(int i) { return pads[i]; }
+  // Staged for the next update().
+  void hostSetButtons(int i, uint16_t bits);
+  void hostSetDpad(int i, uint8_t bits);
+  void hostConnect(int i);
+  void hostDisconnect(int i);
+
+private:
+  Controller pads[MAX_CONTROLLERS];
+  std::atomic<bool> pendingConnect[MAX_CONTROLLERS] = {};
+  std::atomic<bool> pendingDisconnect[MAX_CONTROLLERS] = {};
+  std::atomic<uint16_t> stagedButtons[MAX_CONTROLLERS] = {};
+  std::atomic<uint8_t> stagedDpad[MAX_CONTROLLERS] = {};
+  std::atomic<bool> pendingButtons[MAX_CONTROLLERS] = {};
+  std::atomic<bool> pendingDpad[MAX_CONTROLLERS] = {};
+  GamepadCallback onConnected = nullptr;
+  GamepadCallback onDisconnected = nullptr;
+  std::atomic<void (*)(Bluepad32&)> inputHook{nullptr};
+};
+
+extern Bluepad32 BP32;
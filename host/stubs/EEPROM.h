@@ -0,0 +1,42 @@
+/**
+ * EEPROM.h (host stub)
+ * --------------------
+ * RAM-backed EEPROM emulation. The host harness may load/save the image from a
+ * file so settings, users and leaderboards persist between host runs.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+class EEPROMClass {
+public:
+  bool begin(size_t size);
+  uint8_t read(int address) const;
+  void write(int address, uint8_t value);
+  bool commit();
+  size_t length() const { return size; }
+
+  template <typename T>
+  T& get(int address, T& t) const {
+    if (address >= 0 && (size_t)address + sizeof(T) <= size) memcpy(&t, data + address, sizeof(T));
+    return t;
+  }
+
+  template <typename T>
+  const T& put(int address, const T& t) {
+    if (address >= 0 && (size_t)address + sizeof(T) <= size) memcpy(data + address, &t, sizeof(T));
+    return t;
+  }
+
+  // Host-only: optional backing file (loaded in begin(), written on commit()).
+  void hostSetBackingFile(const char* path);
+
+private:
+  uint8_t* data = nullptr;
+  size_t size = 0;
+  const char* backingFile = nullptr;
+};
+
+extern EEPROMClass EEPROM;
@@ -0,0 +1,95 @@
+/**
+ * ESP32-HUB75-MatrixPanel-I2S-DMA.h (host stub)
+ * ---------------------------------------------
+ * Stand-in for the HUB75 DMA driver. Renders into in-memory RGB565 buffers
+ * (two when `double_buff` is set, mirroring the real driver's flip semantics:
+ * after a flip, drawing continues into the buffer that was shown before).
+ *
+ * Host-only extras are prefixed with `host` (pixel write counters, access to
+ * the shown frame for screenshots / checksums).
+ */
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <Arduino.h>
+#include "Adafruit_GFX.h"
+
+struct HUB75_I2S_CFG {
+  enum shift_driver { SHIFTREG = 0, FM6124, FM6126A, ICN2038S, MBI5124, SM5266P, DP3246_SM5368 };
+  enum clk_speed { HZ_8M = 8000000, HZ_10M = 10000000, HZ_15M = 15000000, HZ_20M = 20000000 };
+
+  struct i2s_pins {
+    int8_t r1, g1, b1, r2, g2, b2, a, b, c, d, e, lat, oe, clk;
+  } gpio;
+
+  uint16_t mx_width;
+  uint16_t mx_height;
+  uint16_t chain_length;
+  shift_driver driver;
+  clk_speed i2sspeed;
+  bool double_buff;
+  uint8_t latch_blanking;
+  bool clkphase;
+  uint16_t min_refresh_rate;
+
+  HUB75_I2S_CFG(uint16_t w = 64, uint16_t h = 32, uint16_t chain = 1)
+      : gpio(), mx_width(w), mx_height(h), chain_length(chain), driver(SHIFTREG),
+        i2sspeed(HZ_8M), double_buff(false), latch_blanking(1), clkphase(true),
+        min_refresh_rate(60) {}
+};
+
+class MatrixPanel_I2S_DMA : public Adafruit_GFX {
+public:
+  explicit MatrixPanel_I2S_DMA(const HUB75_I2S_CFG& opts);
+  ~MatrixPanel_I2S_DMA() override;
+
+  bool begin();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+  void drawPixelRGB888(int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b) { drawPixel(x, y, color565(r, g, b)); }
+  void fillScreenRGB888(uint8_t r, uint8_t g, uint8_t b) { fillScreen(color565(r, g, b)); }
+  void clearScreen() { fillBack(0); }
+
+  void setBrightness8(uint8_t b) { brightness = b; }
+  void setBrightness(uint8_t b) { brightness = b; }
+  void setPanelBrightness(uint8_t b) { brightness = b; }
+
+  void flipDMABuffer();
+
+  static uint16_t color444(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r & 0xF) << 12) | ((r & 0x8) << 8) | ((g & 0xF) << 7) | ((g & 0xC) << 3) | ((b & 0xF) << 1) | ((b & 0x8) >> 3));
+  }
+  static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+  }
+  static uint16_t color333(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r & 0x7) << 13) | ((r & 0x6) << 10) | ((g & 0x7) << 8) | ((g & 0x7) << 5) | ((b & 0x7) << 2) | ((b & 0x6) >> 1));
+  }
+
+  // ---- host-only introspection ----
+  const uint16_t* hostShownFrame() const;
+  uint8_t hostBrightness() const { return brightness; }
+  // Counters are atomic: the harness may sample them while the engine task presents.
+  uint64_t hostPixelWrites() const { return pixelWrites.load(std::memory_order_relaxed); }
+  uint32_t hostFlips() const { return flips.load(std::memory_order_relaxed); }
+  uint32_t hostFrameChecksum() const;
+
+protected:
+  HUB75_I2S_CFG cfg;
+
+private:
+  uint16_t* buffers[2] = { nullptr, nullptr };
+  uint8_t backIndex = 0;
+  bool initialized = false;
+  uint8_t brightness = 128;
+  std::atomic<uint64_t> pixelWrites{0};
+  std::atomic<uint32_t> flips{0};
+
+  void fillBack(uint16_t color);
+};
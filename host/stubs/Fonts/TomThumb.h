@@ -0,0 +1,128 @@
+/**
+ * Fonts/TomThumb.h (host stub)
+ * ----------------------------
+ * 3x5 font in Adafruit GFXfont format with TomThumb metrics (xAdvance 4,
+ * yAdvance 6, baseline at the bottom row). Glyph art is approximate; it only
+ * needs to look right enough for host screenshots.
+ */
+#pragma once
+#include "../gfxfont.h"
+
+const uint8_t TomThumbBitmaps[] PROGMEM = {
+  0x00, 0x49, 0x04, 0xB4, 0x00, 0xBE, 0xFA, 0x79, 0xE4, 0x85, 0x42, 0xDB,
+  0xDE, 0x48, 0x00, 0x29, 0x22, 0x89, 0x28, 0xAA, 0x80, 0x0B, 0xA0, 0x00,
+  0x28, 0x03, 0x80, 0x00, 0x04, 0x25, 0x48, 0x76, 0xDC, 0x59, 0x24, 0xC5,
+  0x4E, 0xC5, 0x1C, 0xB7, 0x92, 0xF3, 0x1C, 0x73, 0xDE, 0xE5, 0x48, 0xF7,
+  0xDE, 0xF7, 0x9C, 0x08, 0x20, 0x08, 0x28, 0x2A, 0x22, 0x1C, 0x70, 0x88,
+  0xA8, 0xE5, 0x04, 0x57, 0xC6, 0x57, 0xDA, 0xD7, 0x5C, 0x72, 0x46, 0xD6,
+  0xDC, 0xF3, 0xCE, 0xF3, 0xC8, 0x73, 0xD6, 0xB7, 0xDA, 0xE9, 0x2E, 0x24,
+  0xD4, 0xB7, 0x5A, 0x92, 0x4E, 0xBF, 0xDA, 0xBF, 0xFA, 0x56, 0xD4, 0xD7,
+  0x48, 0x56, 0xF6, 0xD7, 0xEA, 0x71, 0x1C, 0xE9, 0x24, 0xB6, 0xD6, 0xB6,
+  0xA4, 0xB7, 0xFA, 0xB5, 0x5A, 0xB5, 0x24, 0xE5, 0x4E, 0xF2, 0x4E, 0x11,
+  0x10, 0xE4, 0x9E, 0x54, 0x00, 0x00, 0x0E, 0x88, 0x00, 0x57, 0xDA, 0xD7,
+  0x5C, 0x72, 0x46, 0xD6, 0xDC, 0xF3, 0xCE, 0xF3, 0xC8, 0x73, 0xD6, 0xB7,
+  0xDA, 0xE9, 0x2E, 0x24, 0xD4, 0xB7, 0x5A, 0x92, 0x4E, 0xBF, 0xDA, 0xBF,
+  0xFA, 0x56, 0xD4, 0xD7, 0x48, 0x56, 0xF6, 0xD7, 0xEA, 0x71, 0x1C, 0xE9,
+  0x24, 0xB6, 0xD6, 0xB6, 0xA4, 0xB7, 0xFA, 0xB5, 0x5A, 0xB5, 0x24, 0xE5,
+  0x4E, 0x6A, 0x26, 0x48, 0x24, 0xC8, 0xAC, 0x78, 0x00,
+};
+
+const GFXglyph TomThumbGlyphs[] PROGMEM = {
+  {    0, 1, 1, 2, 0, -5}, // 0x20  
+  {    1, 3, 5, 4, 0, -5}, // 0x21 !
+  {    3, 3, 5, 4, 0, -5}, // 0x22 "
+  {    5, 3, 5, 4, 0, -5}, // 0x23 #
+  {    7, 3, 5, 4, 0, -5}, // 0x24 $
+  {    9, 3, 5, 4, 0, -5}, // 0x25 %
+  {   11, 3, 5, 4, 0, -5}, // 0x26 &
+  {   13, 3, 5, 4, 0, -5}, // 0x27 '
+  {   15, 3, 5, 4, 0, -5}, // 0x28 (
+  {   17, 3, 5, 4, 0, -5}, // 0x29 )
+  {   19, 3, 5, 4, 0, -5}, // 0x2A *
+  {   21, 3, 5, 4, 0, -5}, // 0x2B +
+  {   23, 3, 5, 4, 0, -5}, // 0x2C ,
+  {   25, 3, 5, 4, 0, -5}, // 0x2D -
+  {   27, 3, 5, 4, 0, -5}, // 0x2E .
+  {   29, 3, 5, 4, 0, -5}, // 0x2F /
+  {   31, 3, 5, 4, 0, -5}, // 0x30 0
+  {   33, 3, 5, 4, 0, -5}, // 0x31 1
+  {   35, 3, 5, 4, 0, -5}, // 0x32 2
+  {   37, 3, 5, 4, 0, -5}, // 0x33 3
+  {   39, 3, 5, 4, 0, -5}, // 0x34 4
+  {   41, 3, 5, 4, 0, -5}, // 0x35 5
+  {   43, 3, 5, 4, 0, -5}, // 0x36 6
+  {   45, 3, 5, 4, 0, -5}, // 0x37 7
+  {   47, 3, 5, 4, 0, -5}, // 0x38 8
+  {   49, 3, 5, 4, 0, -5}, // 0x39 9
+  {   51, 3, 5, 4, 0, -5}, // 0x3A :
+  {   53, 3, 5, 4, 0, -5}, // 0x3B ;
+  {   55, 3, 5, 4, 0, -5}, // 0x3C <
+  {   57, 3, 5, 4, 0, -5}, // 0x3D =
+  {   59, 3, 5, 4, 0, -5}, // 0x3E >
+  {   61, 3, 5, 4, 0, -5}, // 0x3F ?
+  {   63, 3, 5, 4, 0, -5}, // 0x40 @
+  {   65, 3, 5, 4, 0, -5}, // 0x41 A
+  {   67, 3, 5, 4, 0, -5}, // 0x42 B
+  {   69, 3, 5, 4, 0, -5}, // 0x43 C
+  {   71, 3, 5, 4, 0, -5}, // 0x44 D
+  {   73, 3, 5, 4, 0, -5}, // 0x45 E
+  {   75, 3, 5, 4, 0, -5}, // 0x46 F
+  {   77, 3, 5, 4, 0, -5}, // 0x47 G
+  {   79, 3, 5, 4, 0, -5}, // 0x48 H
+  {   81, 3, 5, 4, 0, -5}, // 0x49 I
+  {   83, 3, 5, 4, 0, -5}, // 0x4A J
+  {   85, 3, 5, 4, 0, -5}, // 0x4B K
+  {   87, 3, 5, 4, 0, -5}, // 0x4C L
+  {   89, 3, 5, 4, 0, -5}, // 0x4D M
+  {   91, 3, 5, 4, 0, -5}, // 0x4E N
+  {   93, 3, 5, 4, 0, -5}, // 0x4F O
+  {   95, 3, 5, 4, 0, -5}, // 0x50 P
+  {   97, 3, 5, 4, 0, -5}, // 0x51 Q
+  {   99, 3, 5, 4, 0, -5}, // 0x52 R
+  {  101, 3, 5, 4, 0, -5}, // 0x53 S
+  {  103, 3, 5, 4, 0, -5}, // 0x54 T
+  {  105, 3, 5, 4, 0, -5}, // 0x55 U
+  {  107, 3, 5, 4, 0, -5}, // 0x56 V
+  {  109, 3, 5, 4, 0, -5}, // 0x57 W
+  {  111, 3, 5, 4, 0, -5}, // 0x58 X
+  {  113, 3, 5, 4, 0, -5}, // 0x59 Y
+  {  115, 3, 5, 4, 0, -5}, // 0x5A Z
+  {  117, 3, 5, 4, 0, -5}, // 0x5B [
+  {  119, 3, 5, 4, 0, -5}, // 0x5C backslash
+  {  121, 3, 5, 4, 0, -5}, // 0x5D ]
+  {  123, 3, 5, 4, 0, -5}, // 0x5E ^
+  {  125, 3, 5, 4, 0, -5}, // 0x5F _
+  {  127, 3, 5, 4, 0, -5}, // 0x60 `
+  {  129, 3, 5, 4, 0, -5}, // 0x61 a
+  {  131, 3, 5, 4, 0, -5}, // 0x62 b
+  {  133, 3, 5, 4, 0, -5}, // 0x63 c
+  {  135, 3, 5, 4, 0, -5}, // 0x64 d
+  {  137, 3, 5, 4, 0, -5}, // 0x65 e
+  {  139, 3, 5, 4, 0, -5}, // 0x66 f
+  {  141, 3, 5, 4, 0, -5}, // 0x67 g
+  {  143, 3, 5, 4, 0, -5}, // 0x68 h
+  {  145, 3, 5, 4, 0, -5}, // 0x69 i
+  {  147, 3, 5, 4, 0, -5}, // 0x6A j
+  {  149, 3, 5, 4, 0, -5}, // 0x6B k
+  {  151, 3, 5, 4, 0, -5}, // 0x6C l
+  {  153, 3, 5, 4, 0, -5}, // 0x6D m
+  {  155, 3, 5, 4, 0, -5}, // 0x6E n
+  {  157, 3, 5, 4, 0, -5}, // 0x6F o
+  {  159, 3, 5, 4, 0, -5}, // 0x70 p
+  {  161, 3, 5, 4, 0, -5}, // 0x71 q
+  {  163, 3, 5, 4, 0, -5}, // 0x72 r
+  {  165, 3, 5, 4, 0, -5}, // 0x73 s
+  {  167, 3, 5, 4, 0, -5}, // 0x74 t
+  {  169, 3, 5, 4, 0, -5}, // 0x75 u
+  {  171, 3, 5, 4, 0, -5}, // 0x76 v
+  {  173, 3, 5, 4, 0, -5}, // 0x77 w
+  {  175, 3, 5, 4, 0, -5}, // 0x78 x
+  {  177, 3, 5, 4, 0, -5}, // 0x79 y
+  {  179, 3, 5, 4, 0, -5}, // 0x7A z
+  {  181, 3, 5, 4, 0, -5}, // 0x7B {
+  {  183, 3, 5, 4, 0, -5}, // 0x7C |
+  {  185, 3, 5, 4, 0, -5}, // 0x7D }
+  {  187, 3, 5, 4, 0, -5}, // 0x7E ~
+};
+
+const GFXfont TomThumb PROGMEM = {(uint8_t*)TomThumbBitmaps, (GFXglyph*)TomThumbGlyphs, 0x20, 0x7E, 6};
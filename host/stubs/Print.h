@@ -0,0 +1,55 @@
+/**
+ * Print.h (host stub)
+ * -------------------
+ * Arduino `Print` base class (subset) shared by `Serial` and the GFX stub.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+class __FlashStringHelper;
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char* str) {
+    if (!str) return 0;
+    return write((const uint8_t*)str, strlen(str));
+  }
+
+  size_t print(const __FlashStringHelper* s) { return write(reinterpret_cast<const char*>(s)); }
+  size_t print(const char* s) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char v, int base = 10) { return printNumber((unsigned long)v, base); }
+  size_t print(int v, int base = 10) { return printSigned((long)v, base); }
+  size_t print(unsigned int v, int base = 10) { return printNumber((unsigned long)v, base); }
+  size_t print(long v, int base = 10) { return printSigned(v, base); }
+  size_t print(unsigned long v, int base = 10) { return printNumber(v, base); }
+  size_t print(long long v, int base = 10) { return printSigned((long)v, base); }
+  size_t print(unsigned long long v, int base = 10) { return printNumber((unsigned long)v, base); }
+  size_t print(double v, int digits = 2);
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(T v) { size_t n = print(v); return n + println(); }
+  template <typename T>
+  size_t println(T v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+
+private:
+  size_t printNumber(unsigned long n, int base);
+  size_t printSigned(long n, int base) {
+    if (base == 10 && n < 0) {
+      size_t c = write((uint8_t)'-');
+      return c + printNumber((unsigned long)(-n), 10);
+    }
+    return printNumber((unsigned long)n, base);
+  }
+};